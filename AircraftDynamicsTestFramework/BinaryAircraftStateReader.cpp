@@ -0,0 +1,98 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "framework/BinaryAircraftStateReader.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+#include "framework/BinaryAircraftStateFormat.h"
+
+using namespace fmacm::binary_aircraft_state_format;
+
+fmacm::BinaryAircraftStateReader::BinaryAircraftStateReader(const std::string &file_name)
+   : m_column_names(), m_row_count(0), m_columns() {
+   std::ifstream is(file_name, std::ios_base::in | std::ios_base::binary);
+   if (!is.is_open()) {
+      throw std::runtime_error("Cannot open " + file_name);
+   }
+   const std::vector<char> bytes{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+
+   if (bytes.size() < FIXED_HEADER_SIZE || std::string(bytes.data(), MAGIC.size()) != MAGIC) {
+      throw std::runtime_error(file_name + " is not a binary aircraft state file");
+   }
+   const auto version = DecodeLittleEndian<std::uint32_t>(&bytes[8]);
+   if (version != FORMAT_VERSION) {
+      throw std::runtime_error(file_name + " has unsupported format version " + std::to_string(version));
+   }
+   const auto column_count = DecodeLittleEndian<std::uint32_t>(&bytes[12]);
+   m_row_count = DecodeLittleEndian<std::uint64_t>(&bytes[16]);
+   const auto data_offset = DecodeLittleEndian<std::uint64_t>(&bytes[24]);
+   // divide rather than multiply so that a corrupt row count cannot overflow the size check
+   if (data_offset < FIXED_HEADER_SIZE || data_offset > bytes.size()) {
+      throw std::runtime_error(file_name + " has an invalid data offset");
+   }
+   if (column_count == 0 ? m_row_count != 0
+                         : m_row_count > (bytes.size() - data_offset) / (column_count * sizeof(double))) {
+      throw std::runtime_error(file_name + " is truncated");
+   }
+
+   std::size_t position = FIXED_HEADER_SIZE;
+   for (std::uint32_t column = 0; column < column_count; ++column) {
+      if (position + sizeof(std::uint32_t) > data_offset) {
+         throw std::runtime_error(file_name + " has a malformed column name table");
+      }
+      const auto name_length = DecodeLittleEndian<std::uint32_t>(&bytes[position]);
+      position += sizeof(std::uint32_t);
+      if (position + name_length > data_offset) {
+         throw std::runtime_error(file_name + " has a malformed column name table");
+      }
+      m_column_names.emplace_back(&bytes[position], name_length);
+      position += name_length;
+   }
+
+   m_columns.resize(column_count, std::vector<double>(m_row_count));
+   for (std::uint32_t column = 0; column < column_count; ++column) {
+      const char *column_start = &bytes[data_offset + column * m_row_count * sizeof(double)];
+      for (std::size_t row = 0; row < m_row_count; ++row) {
+         m_columns[column][row] = DecodeLittleEndian<double>(column_start + row * sizeof(double));
+      }
+   }
+}
+
+void fmacm::BinaryAircraftStateReader::WriteCsv(std::ostream &os) const {
+   WriteCsv(os, std::numeric_limits<double>::max_digits10);
+}
+
+void fmacm::BinaryAircraftStateReader::WriteCsv(std::ostream &os, int precision) const {
+   for (std::size_t column = 0; column < m_column_names.size(); ++column) {
+      os << (column == 0 ? "" : ",") << m_column_names[column];
+   }
+   os << '\n';
+   os << std::setprecision(precision);
+   for (std::size_t row = 0; row < m_row_count; ++row) {
+      for (std::size_t column = 0; column < m_columns.size(); ++column) {
+         os << (column == 0 ? "" : ",") << m_columns[column][row];
+      }
+      os << '\n';
+   }
+}
@@ -30,7 +30,7 @@ log4cplus::Logger GuidanceFromStaticData::m_logger = log4cplus::Logger::getInsta
 
 GuidanceFromStaticData::GuidanceFromStaticData()
    : m_vertical_data(),
-     m_horizontal_trajectory(),
+     m_horizontal_path(ExtendedHorizontalPath::Empty()),
      m_decrementing_distance_calculator(),
      m_decrementing_position_calculator(),
      m_estimated_distance_to_go(Units::infinity()) {}
@@ -38,13 +38,13 @@ GuidanceFromStaticData::GuidanceFromStaticData()
 GuidanceFromStaticData::GuidanceFromStaticData(const std::vector<HorizontalPath> &horizontal_path,
                                                const VerticalData &vertcal_path,
                                                const PlannedDescentParameters &planned_descent_parameters) {
-   m_horizontal_trajectory = horizontal_path;
+   m_horizontal_path = ExtendedHorizontalPath::Of(horizontal_path);
    m_vertical_data = vertcal_path;
    m_estimated_distance_to_go = Units::infinity();
    m_decrementing_distance_calculator =
-         AlongPathDistanceCalculator(m_horizontal_trajectory, TrajectoryIndexProgressionDirection::DECREMENTING);
+         AlongPathDistanceCalculator(m_horizontal_path, TrajectoryIndexProgressionDirection::DECREMENTING);
    m_decrementing_position_calculator =
-         PositionCalculator(m_horizontal_trajectory, TrajectoryIndexProgressionDirection::DECREMENTING);
+         PositionCalculator(m_horizontal_path, TrajectoryIndexProgressionDirection::DECREMENTING);
    m_planned_descent_parameters = planned_descent_parameters;
 }
 
@@ -81,32 +81,11 @@ aaesim::open_source::Guidance GuidanceFromStaticData::CalculateVerticalGuidance(
    vertical_guidance.m_active_guidance_phase = aaesim::open_source::GuidanceFlightPhase::CRUISE_DESCENT;
 
    if (estimated_distance_to_go.value() <= fabs(m_vertical_data.m_distance_to_go_meters.back())) {
-      double altitude_target;
-      double ias_target;
-      double altitude_rate_target;
-      double groundspeed_target;
-      int current_trajectory_index =
-            CoreUtils::FindNearestIndex(estimated_distance_to_go.value(), m_vertical_data.m_distance_to_go_meters);
-
-      if (current_trajectory_index == 0) {
-         altitude_target = m_vertical_data.m_altitude_meters[current_trajectory_index];
-         ias_target = m_vertical_data.m_ias_mps[current_trajectory_index];
-         altitude_rate_target = m_vertical_data.m_vertical_speed_mps[current_trajectory_index];
-         groundspeed_target = m_vertical_data.m_ground_speed_mps[current_trajectory_index];
-      } else {
-         altitude_target = CoreUtils::LinearlyInterpolate(current_trajectory_index, estimated_distance_to_go.value(),
-                                                          m_vertical_data.m_distance_to_go_meters,
-                                                          m_vertical_data.m_altitude_meters);
-         ias_target =
-               CoreUtils::LinearlyInterpolate(current_trajectory_index, estimated_distance_to_go.value(),
-                                              m_vertical_data.m_distance_to_go_meters, m_vertical_data.m_ias_mps);
-         altitude_rate_target = CoreUtils::LinearlyInterpolate(
-               current_trajectory_index, estimated_distance_to_go.value(), m_vertical_data.m_distance_to_go_meters,
-               m_vertical_data.m_vertical_speed_mps);
-         groundspeed_target = CoreUtils::LinearlyInterpolate(current_trajectory_index, estimated_distance_to_go.value(),
-                                                             m_vertical_data.m_distance_to_go_meters,
-                                                             m_vertical_data.m_ground_speed_mps);
-      }
+      const auto [altitude_target, ias_target, altitude_rate_target, groundspeed_target] =
+            m_profile_interpolator.Interpolate(
+                  estimated_distance_to_go.value(), m_vertical_data.m_distance_to_go_meters,
+                  m_vertical_data.m_altitude_meters, m_vertical_data.m_ias_mps, m_vertical_data.m_vertical_speed_mps,
+                  m_vertical_data.m_ground_speed_mps);
 
       vertical_guidance.m_reference_altitude = Units::MetersLength(altitude_target);
       vertical_guidance.m_vertical_speed = Units::MetersPerSecondSpeed(altitude_rate_target);
@@ -126,6 +105,7 @@ aaesim::open_source::Guidance GuidanceFromStaticData::CalculateVerticalGuidance(
 aaesim::open_source::Guidance GuidanceFromStaticData::CalculateHorizontalGuidance(
       const aaesim::open_source::AircraftState &state, const Units::MetersLength &estimated_distance_to_go,
       const Units::UnsignedAngle &estimated_course) {
+   const auto &horizontal_trajectory = m_horizontal_path->GetUnmodifiedPath();
    aaesim::open_source::Guidance horizontal_guidance;
    horizontal_guidance.m_cross_track_error = Units::ZERO_LENGTH;
    horizontal_guidance.m_use_cross_track = false;
@@ -137,32 +117,34 @@ aaesim::open_source::Guidance GuidanceFromStaticData::CalculateHorizontalGuidanc
    m_decrementing_position_calculator.CalculatePositionFromAlongPathDistance(
          m_estimated_distance_to_go, estimated_position_on_path_x, estimated_position_on_path_y, course_at_position);
    auto traj_index = m_decrementing_position_calculator.GetCurrentTrajectoryIndex();
-   if (traj_index == m_horizontal_trajectory.size() - 1) {
+   if (traj_index >= horizontal_trajectory.size()) {
+      traj_index = 0;  // beyond the end of the path, on its extension past the last waypoint
+   } else if (traj_index == horizontal_trajectory.size() - 1) {
       traj_index--;
    }
 
    horizontal_guidance.m_enu_track_angle = course_at_position;
    if (horizontal_guidance.m_ground_speed <= Units::zero()) horizontal_guidance.m_ground_speed = state.GetGroundSpeed();
-   if (m_horizontal_trajectory[traj_index].m_segment_type == HorizontalPath::SegmentType::TURN) {
+   if (horizontal_trajectory[traj_index].m_segment_type == HorizontalPath::SegmentType::TURN) {
       Units::Length unsigned_cross_track =
             Units::sqrt(Units::sqr(state.GetPositionEnuX() - estimated_position_on_path_x) +
                         Units::sqr(state.GetPositionEnuY() - estimated_position_on_path_y));
 
       Units::Length center_distance = Units::sqrt(
             Units::sqr(state.GetPositionEnuX() -
-                       Units::MetersLength(m_horizontal_trajectory[traj_index].m_turn_info.x_position_meters)) +
+                       Units::MetersLength(horizontal_trajectory[traj_index].m_turn_info.x_position_meters)) +
             Units::sqr(state.GetPositionEnuY() -
-                       Units::MetersLength(m_horizontal_trajectory[traj_index].m_turn_info.y_position_meters)));
+                       Units::MetersLength(horizontal_trajectory[traj_index].m_turn_info.y_position_meters)));
 
       Units::FeetLength distance_to_waypoint =
             m_estimated_distance_to_go -
-            Units::MetersLength(m_horizontal_trajectory[traj_index].m_path_length_cumulative_meters);
+            Units::MetersLength(horizontal_trajectory[traj_index].m_path_length_cumulative_meters);
       Units::SecondsTime time_to_waypoint = distance_to_waypoint / horizontal_guidance.m_ground_speed;
 
       static const Units::DegreesPerSecondAngularSpeed roll_rate(3.0);
       double dimensionless_roll_factor = 1;
-      if (traj_index > 0 && (m_horizontal_trajectory[traj_index - 1].m_turn_info.radius.value() < 1)) {
-         Units::SecondsTime time_to_bank = m_horizontal_trajectory[traj_index].m_turn_info.bankAngle / roll_rate;
+      if (traj_index > 0 && (horizontal_trajectory[traj_index - 1].m_turn_info.radius.value() < 1)) {
+         Units::SecondsTime time_to_bank = horizontal_trajectory[traj_index].m_turn_info.bankAngle / roll_rate;
 
          if (time_to_waypoint <= time_to_bank) {
             dimensionless_roll_factor = time_to_waypoint / time_to_bank;
@@ -170,7 +152,7 @@ aaesim::open_source::Guidance GuidanceFromStaticData::CalculateHorizontalGuidanc
       }
 
       Units::Angle aircraft_course = Units::UnsignedRadiansAngle(
-            Units::RadiansAngle(m_horizontal_trajectory[traj_index].m_path_course) + Units::PI_RADIANS_ANGLE);
+            Units::RadiansAngle(horizontal_trajectory[traj_index].m_path_course) + Units::PI_RADIANS_ANGLE);
       Units::SignedRadiansAngle course_change = Units::ToSigned(estimated_course - aircraft_course);
 
       TurnDirection turn_direction = GetTurnDirection(course_change);
@@ -179,18 +161,18 @@ aaesim::open_source::Guidance GuidanceFromStaticData::CalculateHorizontalGuidanc
       // if right turn, distance < radius is right of m_path_course, distance > radius is left of m_path_course
       if (turn_direction == LEFT) {
          horizontal_guidance.m_reference_bank_angle =
-               dimensionless_roll_factor * m_horizontal_trajectory[traj_index].m_turn_info.bankAngle;
+               dimensionless_roll_factor * horizontal_trajectory[traj_index].m_turn_info.bankAngle;
 
-         if (center_distance < Units::MetersLength(m_horizontal_trajectory[traj_index].m_turn_info.radius)) {
+         if (center_distance < Units::MetersLength(horizontal_trajectory[traj_index].m_turn_info.radius)) {
             horizontal_guidance.m_cross_track_error = Units::MetersLength(unsigned_cross_track);
          } else {
             horizontal_guidance.m_cross_track_error = Units::MetersLength(-unsigned_cross_track);
          }
       } else {
          horizontal_guidance.m_reference_bank_angle =
-               -dimensionless_roll_factor * m_horizontal_trajectory[traj_index].m_turn_info.bankAngle;
+               -dimensionless_roll_factor * horizontal_trajectory[traj_index].m_turn_info.bankAngle;
 
-         if (center_distance < Units::MetersLength(m_horizontal_trajectory[traj_index].m_turn_info.radius)) {
+         if (center_distance < Units::MetersLength(horizontal_trajectory[traj_index].m_turn_info.radius)) {
             horizontal_guidance.m_cross_track_error = Units::MetersLength(-unsigned_cross_track);
          } else {
             horizontal_guidance.m_cross_track_error = Units::MetersLength(unsigned_cross_track);
@@ -198,9 +180,9 @@ aaesim::open_source::Guidance GuidanceFromStaticData::CalculateHorizontalGuidanc
       }
    } else {
       horizontal_guidance.m_cross_track_error =
-            -(state.GetPositionEnuY() - Units::MetersLength(m_horizontal_trajectory[traj_index].GetYPositionMeters())) *
+            -(state.GetPositionEnuY() - Units::MetersLength(horizontal_trajectory[traj_index].GetYPositionMeters())) *
                   Units::cos(estimated_course) +
-            (state.GetPositionEnuX() - Units::MetersLength(m_horizontal_trajectory[traj_index].GetXPositionMeters())) *
+            (state.GetPositionEnuX() - Units::MetersLength(horizontal_trajectory[traj_index].GetXPositionMeters())) *
                   Units::sin(estimated_course);
    }
 
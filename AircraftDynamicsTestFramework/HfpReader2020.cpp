@@ -54,6 +54,11 @@ HfpReader2020::HfpReader2020(std::shared_ptr<std::istream> input_stream, int hea
    SetColumnIndexesFromHeader(header_lines);
 }
 
+HfpReader2020::HfpReader2020(std::shared_ptr<const CsvFile> csv_file, int header_lines)
+   : DataReader(std::move(csv_file), 0, 0) {
+   SetColumnIndexesFromHeader(header_lines);
+}
+
 HfpReader2020::~HfpReader2020() = default;
 
 void HfpReader2020::SetColumnIndexesFromHeader(const int header_lines) {
@@ -21,7 +21,7 @@
 #include <fstream>
 #include <string>
 #include <stdlib.h>
-#include "utility/CsvParser.h"
+#include "public/CsvFile.h"
 
 IMSpeedCommandFile::IMSpeedCommandFile() : m_ias_hist(), m_apply_pilot_delay(false) {
 
@@ -53,32 +53,25 @@ bool IMSpeedCommandFile::load(DecodedStream *strm) {
 }
 
 void IMSpeedCommandFile::ReadData() {
-   std::ifstream file(m_file_path.c_str());
+   auto csv_file = aaesim::open_source::CsvFile::Open(m_file_path);
 
-   if (!file.is_open()) {
+   if (!csv_file) {
       std::cout << "Speed file " << m_file_path.c_str() << " not found" << std::endl;
       exit(-46);
    }
 
-   bool hdrrcd = true;
-
-   for (CsvParser::CsvIterator csviter(file); csviter != CsvParser::CsvIterator(); ++csviter) {
-
-      if (hdrrcd) {
-         hdrrcd = false;
-         continue;
-      }
+   aaesim::open_source::CsvCursor csv_row(csv_file);
+   csv_row.SkipLines(1);
 
+   while (csv_row.Advance()) {
       SpeedRecord spd;
 
       m_speed_data.push_back(spd);
 
       int ix = m_speed_data.size() - 1;
 
-      for (int fieldix = 0; fieldix < (*csviter).Size(); ++fieldix) {
-         std::string field = (*csviter)[fieldix];
-
-         double val = atof(field.c_str());
+      for (int fieldix = 0; fieldix < csv_row.Size(); ++fieldix) {
+         double val = csv_row.GetDouble(fieldix);
 
          if (fieldix == 0) {
             m_speed_data[ix].mTime = Units::SecondsTime(val);
@@ -91,8 +84,6 @@ void IMSpeedCommandFile::ReadData() {
          }
       }
    }
-
-   file.close();
 }
 
 aaesim::open_source::Guidance IMSpeedCommandFile::Update(Units::Time time) {
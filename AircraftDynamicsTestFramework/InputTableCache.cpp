@@ -0,0 +1,54 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "framework/InputTableCache.h"
+
+using namespace fmacm;
+
+std::size_t InputTableCache::GetSize() const {
+   std::lock_guard<std::mutex> lock(m_mutex);
+   return m_entries.size();
+}
+
+void InputTableCache::Clear() {
+   std::lock_guard<std::mutex> lock(m_mutex);
+   m_entries.clear();
+   m_content_keys.clear();
+}
+
+std::optional<InputTableCache::FileStamp> InputTableCache::GetFileStamp(const std::string &file_name) {
+   std::error_code error;
+   const auto canonical_path = std::filesystem::canonical(file_name, error);
+   if (error) return std::nullopt;
+   const auto file_size = std::filesystem::file_size(canonical_path, error);
+   if (error) return std::nullopt;
+   const auto last_write_time = std::filesystem::last_write_time(canonical_path, error);
+   if (error) return std::nullopt;
+   return FileStamp(canonical_path.string(), file_size, last_write_time);
+}
+
+std::optional<InputTableCache::Entry> InputTableCache::FindEntry(const std::type_index &table_type,
+                                                                 const FileStamp &file_stamp) const {
+   std::lock_guard<std::mutex> lock(m_mutex);
+   const auto content_key = m_content_keys.find(file_stamp);
+   if (content_key == m_content_keys.end()) return std::nullopt;
+   const auto found = m_entries.find(Key(table_type, content_key->second.first, content_key->second.second));
+   if (found == m_entries.end()) return std::nullopt;
+   return found->second;
+}
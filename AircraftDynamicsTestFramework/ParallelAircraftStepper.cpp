@@ -0,0 +1,89 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "framework/ParallelAircraftStepper.h"
+
+#include <algorithm>
+
+using namespace aaesim::open_source;
+
+fmacm::ParallelAircraftStepper::ParallelAircraftStepper(
+      const std::vector<std::shared_ptr<TestFrameworkAircraft>> &aircraft, unsigned int number_of_threads)
+   : m_aircraft(aircraft),
+     m_number_of_slices(std::clamp<unsigned int>(number_of_threads, 1, std::max<std::size_t>(aircraft.size(), 1))),
+     m_aircraft_finished(aircraft.size(), false),
+     m_slice_failures(m_number_of_slices),
+     m_current_time(nullptr),
+     m_stop_requested(false),
+     m_cycle_start(m_number_of_slices),
+     m_cycle_end(m_number_of_slices),
+     m_workers() {
+   // the simulation time step is held per thread, so the workers adopt the step of the thread that owns the scenario
+   const Units::SecondsTime simulation_time_step = SimulationTime::GetSimulationTimeStep();
+   for (unsigned int slice_index = 1; slice_index < m_number_of_slices; ++slice_index) {
+      m_workers.emplace_back(&ParallelAircraftStepper::WorkerLoop, this, slice_index, simulation_time_step);
+   }
+}
+
+fmacm::ParallelAircraftStepper::~ParallelAircraftStepper() {
+   m_stop_requested = true;
+   m_cycle_start.arrive_and_wait();
+   std::for_each(m_workers.begin(), m_workers.end(), [](std::thread &worker) { worker.join(); });
+}
+
+const std::vector<char> &fmacm::ParallelAircraftStepper::Step(const SimulationTime &time) {
+   m_current_time = &time;
+   m_cycle_start.arrive_and_wait();
+   UpdateSlice(0);
+   m_cycle_end.arrive_and_wait();
+
+   for (auto &failure : m_slice_failures) {
+      if (failure) {
+         std::exception_ptr rethrow_this = failure;
+         failure = nullptr;
+         std::rethrow_exception(rethrow_this);
+      }
+   }
+   return m_aircraft_finished;
+}
+
+void fmacm::ParallelAircraftStepper::UpdateSlice(unsigned int slice_index) {
+   const std::size_t slice_size = (m_aircraft.size() + m_number_of_slices - 1) / m_number_of_slices;
+   const std::size_t first = std::min(m_aircraft.size(), slice_index * slice_size);
+   const std::size_t last = std::min(m_aircraft.size(), first + slice_size);
+   try {
+      for (std::size_t i = first; i < last; ++i) {
+         m_aircraft_finished[i] = m_aircraft[i]->Update(*m_current_time);
+      }
+   } catch (...) {
+      m_slice_failures[slice_index] = std::current_exception();
+   }
+}
+
+void fmacm::ParallelAircraftStepper::WorkerLoop(unsigned int slice_index, Units::SecondsTime simulation_time_step) {
+   SimulationTime::SetSimulationTimeStep(simulation_time_step);
+   while (true) {
+      m_cycle_start.arrive_and_wait();
+      if (m_stop_requested) {
+         return;
+      }
+      UpdateSlice(slice_index);
+      m_cycle_end.arrive_and_wait();
+   }
+}
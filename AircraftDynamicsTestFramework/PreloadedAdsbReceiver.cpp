@@ -58,13 +58,14 @@ std::map<int, aaesim::open_source::ADSBSVReport> const fmacm::PreloadedAdsbRecei
 
 void fmacm::PreloadedAdsbReceiver::Initialize(Units::Length adsb_reception_range_threshold) {
    aaesim::open_source::TvReader data_reader(m_ttv_filename, 1);
+   std::vector<LocalTangentPlane>::size_type closest_plane_hint = 0;  // consecutive records are usually near each other
    while (data_reader.Advance()) {
       EarthModel::GeodeticPosition geo_position;
       geo_position.latitude = data_reader.GetLat();
       geo_position.longitude = data_reader.GetLon();
       geo_position.altitude = data_reader.GetAlt();
       EarthModel::LocalPositionEnu local_position;
-      m_tanget_plane_sequence->ConvertGeodeticToLocal(geo_position, local_position);
+      m_tanget_plane_sequence->ConvertGeodeticToLocal(geo_position, local_position, closest_plane_hint);
 
       const auto report =
             aaesim::open_source::ADSBSVReport::Builder(data_reader.GetAcid(), data_reader.GetTimeOfReceipt())
@@ -35,11 +35,14 @@ TestFrameworkAircraft::TestFrameworkAircraft()
      m_aircraft_control(),
      m_bada_calculator(),
      m_speed_application(),
-     m_states() {}
+     m_states(),
+     m_start_time(Units::zero()),
+     m_state_history_limit(0),
+     m_discarded_state_count(0) {}
 
 bool TestFrameworkAircraft::Update(const SimulationTime &time) {
 
-   if (time.GetCurrentSimulationTime() <= m_states.cbegin()->GetTime()) {
+   if (time.GetCurrentSimulationTime() <= m_start_time) {
       return false;
    }
 
@@ -62,13 +65,22 @@ bool TestFrameworkAircraft::Update(const SimulationTime &time) {
    return IsFinished();
 }
 
-void TestFrameworkAircraft::SaveState(AircraftState &state, const SimulationTime &time) { m_states.push_back(state); }
+void TestFrameworkAircraft::SaveState(AircraftState &state, const SimulationTime &time) {
+   // trim in chunks so that the cost of erasing from the front is amortized over many cycles
+   if (m_state_history_limit > 0 && m_states.size() >= 2 * m_state_history_limit) {
+      const std::size_t discard_count = m_states.size() - m_state_history_limit + 1;
+      m_states.erase(m_states.begin(), m_states.begin() + discard_count);
+      m_discarded_state_count += discard_count;
+   }
+   m_states.push_back(state);
+}
 
 std::shared_ptr<TestFrameworkAircraft> TestFrameworkAircraft::Builder::Build() const {
    return std::make_shared<TestFrameworkAircraft>(*this);
 }
 
-TestFrameworkAircraft::TestFrameworkAircraft(const Builder &builder) {
+TestFrameworkAircraft::TestFrameworkAircraft(const Builder &builder)
+   : m_states(), m_start_time(Units::zero()), m_state_history_limit(0), m_discarded_state_count(0) {
    m_weather_truth = builder.GetWeatherTruth();
    m_adsb_receiver = builder.GetAdsbReceiver();
    m_dynamics = builder.GetDynamicsModel();
@@ -77,6 +89,7 @@ TestFrameworkAircraft::TestFrameworkAircraft(const Builder &builder) {
    m_bada_calculator = builder.GetAircraftPerformance();
    m_speed_application = builder.GetFligthDeckApplication();
    auto initial_state = builder.GetInitialState();
+   m_start_time = initial_state.GetTime();
    m_states.push_back(initial_state);
 }
 
@@ -19,15 +19,35 @@
 
 #include "framework/TestFrameworkScenario.h"
 
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <optional>
+#include <thread>
+
 #include "framework/AircraftStateWriter.h"
+#include "framework/StreamingAircraftStateWriter.h"
+#include "public/ScenarioUtils.h"
+#include "public/SingleTangentPlaneSequence.h"
 
 #ifdef MITRE_BADA3_LIBRARY
 #include "bada/Bada3Factory.h"
 #endif
 
 log4cplus::Logger TestFrameworkScenario::m_logger = log4cplus::Logger::getInstance("TestFrameworkScenario");
+const std::size_t TestFrameworkScenario::STREAMING_STATE_HISTORY_LIMIT = 16;
 
-TestFrameworkScenario::TestFrameworkScenario() : Scenario(), m_aircraft_in_scenario() {
+TestFrameworkScenario::TestFrameworkScenario()
+   : Scenario(),
+     m_aircraft_loaders(),
+     m_input_tables(std::make_shared<fmacm::InputTableCache>()),
+     m_monte_carlo(),
+     m_aircraft_in_scenario(),
+     m_aircraft_update_threads(1),
+     m_stream_aircraft_states(false),
+     m_state_output_format(fmacm::AircraftStateWriter::OutputFormat::CSV),
+     m_random_seed(1),
+     m_aircraft_stepper() {
 #ifdef SAMPLE_ALGORITHM_LIBRARY
    m_sample_algorithm_writer = std::make_unique<interval_management::open_source::FIMAlgorithmDataWriter>();
    m_sample_algorithm_kinematic_writer = std::make_unique<interval_management::open_source::PredictionFileKinematic>();
@@ -36,27 +56,57 @@ TestFrameworkScenario::TestFrameworkScenario() : Scenario(), m_aircraft_in_scena
 
 bool TestFrameworkScenario::load(DecodedStream *input) {
    std::string bada_data_path;
-   std::vector<fmacm::FrameworkAircraftLoader> aircraft_loaders;
+   std::string state_output_format("csv");
 
    set_stream(input);
    register_var("bada_data_path", &bada_data_path, true);
-   register_named_vector_item("aircraft", &aircraft_loaders, true);
+   register_named_vector_item("aircraft", &m_aircraft_loaders, true);
+   register_var("aircraft_update_threads", &m_aircraft_update_threads, false);
+   register_var("stream_aircraft_states", &m_stream_aircraft_states, false);
+   register_var("aircraft_state_output_format", &state_output_format, false);
+   register_var("random_seed", &m_random_seed, false);
+   register_loadable_with_brackets("monte_carlo", &m_monte_carlo, false);
    complete();
 
-   PostLoad(bada_data_path, aircraft_loaders);
+   m_state_output_format = fmacm::AircraftStateWriter::OutputFormatFromString(state_output_format);
+   if (m_stream_aircraft_states && m_state_output_format != fmacm::AircraftStateWriter::OutputFormat::CSV) {
+      std::string msg = "stream_aircraft_states is only available with the csv aircraft_state_output_format";
+      LOG4CPLUS_FATAL(m_logger, msg);
+      throw std::runtime_error(msg);
+   }
+   if (m_stream_aircraft_states && m_monte_carlo.IsLoaded()) {
+      std::string msg = "stream_aircraft_states is not available with monte_carlo iterations";
+      LOG4CPLUS_FATAL(m_logger, msg);
+      throw std::runtime_error(msg);
+   }
+
+   PostLoad(bada_data_path);
 
    return true;
 }
 
-void TestFrameworkScenario::PostLoad(const std::string &bada_data_path,
-                                     std::vector<fmacm::FrameworkAircraftLoader> &aircraft_loaders) {
+void TestFrameworkScenario::PostLoad(const std::string &bada_data_path) {
 #ifdef MITRE_BADA3_LIBRARY
    aaesim::bada::Bada3Factory::SetBadaDataPath(bada_data_path, Atmosphere::AtmosphereType::BADA37);
 #endif
 
-   std::for_each(aircraft_loaders.begin(), aircraft_loaders.end(), [this](fmacm::FrameworkAircraftLoader loader) {
+   // aircraft that fly the same route or weather share its parsed tables
+   for (auto &loader : m_aircraft_loaders) {
+      loader.SetInputTableCache(m_input_tables);
+   }
+
+   // Monte Carlo iterations build their own aircraft from copies of the loaders
+   if (m_monte_carlo.IsLoaded()) {
+      return;
+   }
+
+   // each aircraft draws from its own split of the scenario stream, whichever thread updates it
+   const PhiloxRandomGenerator random_stream(static_cast<std::uint64_t>(m_random_seed));
+   for (std::size_t i = 0; i < m_aircraft_loaders.size(); ++i) {
+      fmacm::FrameworkAircraftLoader loader = m_aircraft_loaders[i];
+      loader.SetRandomStream(random_stream.Split(i));
       m_aircraft_in_scenario.push_back(loader.BuildAircraft());
-   });
+   }
 }
 
 void TestFrameworkScenario::SimulateAllIterations() {
@@ -65,43 +115,238 @@ void TestFrameworkScenario::SimulateAllIterations() {
    m_sample_algorithm_kinematic_writer->SetScenarioName(GetScenarioName());
 #endif
 
-   fmacm::AircraftStateWriter fmacm_state_writer;
-   fmacm_state_writer.SetScenarioName(GetScenarioName());
+   auto fmacm_state_writer = fmacm::AircraftStateWriter::Create(m_state_output_format);
+   fmacm_state_writer->SetScenarioName(GetScenarioName());
+
+   if (m_monte_carlo.IsLoaded()) {
+      SimulateMonteCarloIterations(*fmacm_state_writer);
+#ifdef SAMPLE_ALGORITHM_LIBRARY
+      m_sample_algorithm_writer->Finish();
+      m_sample_algorithm_kinematic_writer->Finish();
+#endif
+      fmacm_state_writer->Finish();
+      return;
+   }
+
+   std::unique_ptr<fmacm::StreamingAircraftStateWriter> streaming_state_writer;
+   std::vector<std::size_t> streamed_state_counts(m_aircraft_in_scenario.size(), 0);
+   if (m_stream_aircraft_states) {
+      streaming_state_writer = std::make_unique<fmacm::StreamingAircraftStateWriter>(m_aircraft_in_scenario.size());
+      streaming_state_writer->SetScenarioName(GetScenarioName());
+      std::for_each(m_aircraft_in_scenario.begin(), m_aircraft_in_scenario.end(),
+                    [](std::shared_ptr<TestFrameworkAircraft> &aircraft) {
+                       aircraft->SetStateHistoryLimit(STREAMING_STATE_HISTORY_LIMIT);
+                    });
+      StreamNewAircraftStates(*streaming_state_writer, streamed_state_counts);
+   }
 
    LOG4CPLUS_INFO(m_logger, "Running FMACM scenario " << GetScenarioName());
+   if (m_aircraft_update_threads > 1 && m_aircraft_in_scenario.size() > 1) {
+      LOG4CPLUS_INFO(m_logger, "Advancing aircraft on " << m_aircraft_update_threads << " threads");
+      m_aircraft_stepper = std::make_unique<fmacm::ParallelAircraftStepper>(m_aircraft_in_scenario,
+                                                                            m_aircraft_update_threads);
+   }
    aaesim::open_source::SimulationTime time;
    bool scenario_complete = false;
    while (!scenario_complete) {
       scenario_complete = AdvanceAllAircraft(time);
+      if (streaming_state_writer) {
+         StreamNewAircraftStates(*streaming_state_writer, streamed_state_counts);
+      }
       time.Increment();
    }
+   m_aircraft_stepper.reset();
    LOG4CPLUS_INFO(m_logger, "FMACM scenario complete; writing data files.");
-   std::for_each(m_aircraft_in_scenario.cbegin(), m_aircraft_in_scenario.cend(),
-                 [&fmacm_state_writer](const std::shared_ptr<TestFrameworkAircraft> &aircraft) {
-                    fmacm_state_writer.Gather(aircraft->GetAircraftStates());
-                 });
+   if (!streaming_state_writer) {
+      std::for_each(m_aircraft_in_scenario.cbegin(), m_aircraft_in_scenario.cend(),
+                    [&fmacm_state_writer](const std::shared_ptr<TestFrameworkAircraft> &aircraft) {
+                       fmacm_state_writer->Gather(aircraft->GetAircraftStates());
+                    });
+   }
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
    m_sample_algorithm_writer->Finish();
    m_sample_algorithm_kinematic_writer->Finish();
 #endif
 
-   fmacm_state_writer.Finish();
+   fmacm_state_writer->Finish();
+   if (streaming_state_writer) {
+      streaming_state_writer->Finish();
+   }
+}
+
+void TestFrameworkScenario::SimulateMonteCarloIterations(fmacm::AircraftStateWriter &state_writer) {
+   const int iteration_count = m_monte_carlo.GetIterationCount();
+   const unsigned int number_of_workers =
+         std::min(m_monte_carlo.GetIterationThreads(), std::max(iteration_count, 1));
+   LOG4CPLUS_INFO(m_logger, "Running FMACM scenario " << GetScenarioName() << " for " << iteration_count
+                                                      << " Monte Carlo iterations on " << number_of_workers
+                                                      << " threads");
+   if (m_aircraft_update_threads > 1) {
+      LOG4CPLUS_WARN(m_logger, "aircraft_update_threads is ignored with monte_carlo; use iteration_threads");
+   }
+
+   fmacm::MonteCarloSummaryWriter summary_writer;
+   summary_writer.SetScenarioName(GetScenarioName());
+
+   // Iterations may finish in any order. Each result is held until all earlier iterations have been written, so
+   // the output files do not depend on the number of threads.
+   std::mutex results_mutex;
+   std::vector<std::optional<IterationResult>> pending_results(iteration_count);
+   int next_iteration_to_write = 0;
+   auto write_completed_iterations = [&]() {
+      while (next_iteration_to_write < iteration_count && pending_results[next_iteration_to_write]) {
+         IterationResult &result = *pending_results[next_iteration_to_write];
+         std::for_each(result.aircraft_states.cbegin(), result.aircraft_states.cend(),
+                       [&state_writer, iteration = next_iteration_to_write](
+                             const std::vector<aaesim::open_source::AircraftState> &states) {
+                          state_writer.Gather(states, iteration);
+                       });
+         std::for_each(result.aircraft_summaries.cbegin(), result.aircraft_summaries.cend(),
+                       [&summary_writer](const fmacm::MonteCarloSummaryWriter::AircraftSummary &summary) {
+                          summary_writer.Gather(summary);
+                       });
+         pending_results[next_iteration_to_write].reset();
+         ++next_iteration_to_write;
+      }
+   };
+
+   const Units::SecondsTime simulation_time_step = aaesim::open_source::SimulationTime::GetSimulationTimeStep();
+   std::atomic<int> next_iteration{0};
+   std::vector<std::exception_ptr> iteration_failures(iteration_count);
+   auto worker = [&, simulation_time_step]() {
+      aaesim::open_source::SimulationTime::SetSimulationTimeStep(simulation_time_step);
+      for (int i = next_iteration++; i < iteration_count; i = next_iteration++) {
+         try {
+            IterationResult result = RunMonteCarloIteration(i);
+            std::lock_guard<std::mutex> lock(results_mutex);
+            pending_results[i] = std::move(result);
+            write_completed_iterations();
+         } catch (...) {
+            iteration_failures[i] = std::current_exception();
+         }
+      }
+   };
+   std::vector<std::thread> workers;
+   for (unsigned int i = 0; i < number_of_workers; ++i) {
+      workers.emplace_back(worker);
+   }
+   std::for_each(workers.begin(), workers.end(), [](std::thread &t) { t.join(); });
+   for (const auto &failure : iteration_failures) {
+      if (failure) {
+         std::rethrow_exception(failure);
+      }
+   }
+
+   LOG4CPLUS_INFO(m_logger, "FMACM Monte Carlo iterations complete; writing data files.");
+   summary_writer.Finish();
+}
+
+TestFrameworkScenario::IterationResult TestFrameworkScenario::RunMonteCarloIteration(int iteration) {
+   // Everything random in an iteration comes from a stream that depends on the iteration number alone. The
+   // iteration values are drawn from it directly, each aircraft gets its own split of it, and the thread's shared
+   // generator is seeded from it for anything that still draws from there. Aircraft are built in scenario order so
+   // that each gets the same tangent plane as a single pass would.
+   PhiloxRandomGenerator random_stream = m_monte_carlo.IterationRandomStream(iteration);
+   const double legacy_seed = std::floor(random_stream.UniformSample() * 2147483646.0) + 1;
+   aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR.SetSeed(legacy_seed);
+   SingleTangentPlaneSequence::ClearStaticMembers();
+
+   const double wind_scale_factor = m_monte_carlo.SampleWindScaleFactor(random_stream);
+   std::vector<std::shared_ptr<TestFrameworkAircraft>> aircraft_in_iteration;
+   IterationResult result;
+   for (std::size_t i = 0; i < m_aircraft_loaders.size(); ++i) {
+      fmacm::FrameworkAircraftLoader loader = m_aircraft_loaders[i];
+      loader.SetMassFraction(m_monte_carlo.SampleMassFraction(random_stream, loader.GetMassFraction()));
+      loader.SetWindScaleFactor(wind_scale_factor);
+      loader.SetRandomStream(random_stream.Split(i));
+      if (m_monte_carlo.HasPilotDelay()) {
+         loader.SetPilotDelay(m_monte_carlo.GetPilotDelayMean(), m_monte_carlo.GetPilotDelayStandardDeviation());
+      }
+      aircraft_in_iteration.push_back(loader.BuildAircraft());
+
+      fmacm::MonteCarloSummaryWriter::AircraftSummary summary;
+      summary.iteration = iteration;
+      summary.aircraft_index = static_cast<int>(i);
+      summary.initial_mass_fraction = loader.GetMassFraction();
+      summary.wind_scale_factor = wind_scale_factor;
+      const fmacm::ApplicationLoader &application_loader = loader.GetFlightDeckApplicationLoader();
+      if (application_loader.IsPilotDelayEnabled()) {
+         summary.pilot_delay_mean = application_loader.GetPilotDelayMean();
+         summary.pilot_delay_standard_deviation = application_loader.GetPilotDelayStandardDeviation();
+      }
+      result.aircraft_summaries.push_back(summary);
+   }
+
+   aaesim::open_source::SimulationTime time;
+   bool iteration_complete = false;
+   while (!iteration_complete) {
+      iteration_complete = true;
+      for (auto &aircraft : aircraft_in_iteration) {
+         iteration_complete = aircraft->Update(time) && iteration_complete;
+      }
+#ifdef SAMPLE_ALGORITHM_LIBRARY
+      {
+         std::lock_guard<std::mutex> lock(m_sample_algorithm_writer_mutex);
+         for (const auto &aircraft : aircraft_in_iteration) {
+            m_sample_algorithm_writer->Gather(iteration, time, "IMACID", aircraft->GetFlightDeckApplication());
+            m_sample_algorithm_kinematic_writer->Gather(iteration, time.GetCurrentSimulationTime(), "IMACID",
+                                                        aircraft->GetFlightDeckApplication());
+         }
+      }
+#endif
+      time.Increment();
+   }
+
+   // positions are converted here, on the iteration's thread, so the writer does not convert them under the
+   // results lock
+   for (std::size_t i = 0; i < aircraft_in_iteration.size(); ++i) {
+      const auto &states = aircraft_in_iteration[i]->GetAircraftStates();
+      result.aircraft_summaries[i].state_count = states.size();
+      if (!states.empty()) {
+         result.aircraft_summaries[i].final_time = states.back().GetTime();
+      }
+      std::vector<aaesim::open_source::AircraftState> &resolved_states = result.aircraft_states.emplace_back(states);
+      std::for_each(resolved_states.begin(), resolved_states.end(),
+                    [](aaesim::open_source::AircraftState &state) { state.ResolveDeferredPosition(); });
+   }
+   return result;
+}
+
+void TestFrameworkScenario::StreamNewAircraftStates(fmacm::StreamingAircraftStateWriter &writer,
+                                                    std::vector<std::size_t> &streamed_state_counts) const {
+   for (std::size_t i = 0; i < m_aircraft_in_scenario.size(); ++i) {
+      const auto &retained_states = m_aircraft_in_scenario[i]->GetAircraftStates();
+      const std::size_t state_count = m_aircraft_in_scenario[i]->GetStateCount();
+      const std::size_t first_retained = state_count - retained_states.size();
+      for (std::size_t n = std::max(streamed_state_counts[i], first_retained); n < state_count; ++n) {
+         writer.Append(i, retained_states[n - first_retained]);
+      }
+      streamed_state_counts[i] = state_count;
+   }
 }
 
 bool TestFrameworkScenario::AdvanceAllAircraft(aaesim::open_source::SimulationTime &time) {
-   bool all_aircraft_complete = true;
-   auto advance_aircraft = [this, &all_aircraft_complete, &time](std::shared_ptr<TestFrameworkAircraft> &aircraft) {
-      bool aircraft_finished = aircraft->Update(time);
+   std::vector<char> aircraft_finished_storage;
+   if (!m_aircraft_stepper) {
+      aircraft_finished_storage.resize(m_aircraft_in_scenario.size());
+      std::transform(m_aircraft_in_scenario.begin(), m_aircraft_in_scenario.end(),
+                     aircraft_finished_storage.begin(),
+                     [&time](std::shared_ptr<TestFrameworkAircraft> &aircraft) { return aircraft->Update(time); });
+   }
+   const std::vector<char> &aircraft_finished =
+         m_aircraft_stepper ? m_aircraft_stepper->Step(time) : aircraft_finished_storage;
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
-      m_sample_algorithm_writer->Gather(0, time, "IMACID", aircraft->GetFlightDeckApplication());
-      m_sample_algorithm_kinematic_writer->Gather(0, time.GetCurrentSimulationTime(), "IMACID",
-                                                  aircraft->GetFlightDeckApplication());
+   // gathered after all aircraft have advanced, in scenario order, so the output does not depend on the thread count
+   std::for_each(m_aircraft_in_scenario.cbegin(), m_aircraft_in_scenario.cend(),
+                 [this, &time](const std::shared_ptr<TestFrameworkAircraft> &aircraft) {
+                    m_sample_algorithm_writer->Gather(0, time, "IMACID", aircraft->GetFlightDeckApplication());
+                    m_sample_algorithm_kinematic_writer->Gather(0, time.GetCurrentSimulationTime(), "IMACID",
+                                                                aircraft->GetFlightDeckApplication());
+                 });
 #endif
 
-      all_aircraft_complete = all_aircraft_complete && aircraft_finished;
-   };
-   std::for_each(m_aircraft_in_scenario.begin(), m_aircraft_in_scenario.end(), advance_aircraft);
-   return all_aircraft_complete;
+   return std::all_of(aircraft_finished.cbegin(), aircraft_finished.cend(),
+                      [](char aircraft_is_finished) { return aircraft_is_finished != 0; });
 }
@@ -21,7 +21,7 @@
 #include "public/AircraftCalculations.h"
 #include "public/CoreUtils.h"
 #include "framework/HfpReader2020.h"
-#include "utility/CsvParser.h"
+#include "public/CsvFile.h"
 
 #include <scalar/AngularSpeed.h>
 
@@ -64,31 +64,11 @@ aaesim::open_source::Guidance TrajectoryFromFile::Update(const aaesim::open_sour
          Units::FeetLength(state.m_x), Units::FeetLength(state.m_y), estimated_distance_to_go, estimated_course);
 
    if (estimated_distance_to_go.value() <= fabs(m_vertical_data.m_distance_to_go_meters.back())) {
-      double h_next;
-      double v_next;
-      double h_dot_next;
-      double gs_next;
-      int current_trajectory_index =
-            CoreUtils::FindNearestIndex(estimated_distance_to_go.value(), m_vertical_data.m_distance_to_go_meters);
-
-      if (current_trajectory_index == 0) {
-         h_next = m_vertical_data.m_altitude_meters[current_trajectory_index];
-         v_next = m_vertical_data.m_ias_mps[current_trajectory_index];
-         h_dot_next = m_vertical_data.m_vertical_speed_mps[current_trajectory_index];
-         gs_next = m_vertical_data.m_ground_speed_mps[current_trajectory_index];
-      } else {
-         h_next = CoreUtils::LinearlyInterpolate(current_trajectory_index, estimated_distance_to_go.value(),
-                                                 m_vertical_data.m_distance_to_go_meters,
-                                                 m_vertical_data.m_altitude_meters);
-         v_next = CoreUtils::LinearlyInterpolate(current_trajectory_index, estimated_distance_to_go.value(),
-                                                 m_vertical_data.m_distance_to_go_meters, m_vertical_data.m_ias_mps);
-         h_dot_next = CoreUtils::LinearlyInterpolate(current_trajectory_index, estimated_distance_to_go.value(),
-                                                     m_vertical_data.m_distance_to_go_meters,
-                                                     m_vertical_data.m_vertical_speed_mps);
-         gs_next = CoreUtils::LinearlyInterpolate(current_trajectory_index, estimated_distance_to_go.value(),
-                                                  m_vertical_data.m_distance_to_go_meters,
-                                                  m_vertical_data.m_ground_speed_mps);
-      }
+      const auto [h_next, v_next, h_dot_next, gs_next] =
+            m_profile_interpolator.Interpolate(
+                  estimated_distance_to_go.value(), m_vertical_data.m_distance_to_go_meters,
+                  m_vertical_data.m_altitude_meters, m_vertical_data.m_ias_mps, m_vertical_data.m_vertical_speed_mps,
+                  m_vertical_data.m_ground_speed_mps);
 
       result.m_reference_altitude = Units::MetersLength(h_next);
       result.m_vertical_speed = Units::MetersPerSecondSpeed(h_dot_next);
@@ -101,7 +81,9 @@ aaesim::open_source::Guidance TrajectoryFromFile::Update(const aaesim::open_sour
    m_decrementing_position_calculator.CalculatePositionFromAlongPathDistance(
          estimated_distance_to_go, estimated_position_on_path_x, estimated_position_on_path_y, course_at_position);
    auto traj_index = m_decrementing_position_calculator.GetCurrentTrajectoryIndex();
-   if (traj_index == m_horizontal_trajectory.size() - 1) {
+   if (traj_index >= m_horizontal_trajectory.size()) {
+      traj_index = 0;  // beyond the end of the path, on its extension past the last waypoint
+   } else if (traj_index == m_horizontal_trajectory.size() - 1) {
       traj_index--;
    }
 
@@ -223,33 +205,26 @@ void TrajectoryFromFile::CalculateWaypoints(AircraftIntent &intent) {
 
 void TrajectoryFromFile::ReadVerticalTrajectoryFile() {
 
-   std::ifstream file(m_vertical_trajectory_file.c_str());
+   auto csv_file = aaesim::open_source::CsvFile::Open(m_vertical_trajectory_file);
 
-   if (!file.is_open()) {
+   if (!csv_file) {
       std::cout << "Vertical trajectory file " << m_vertical_trajectory_file.c_str() << " not found" << std::endl;
       exit(-20);
    }
 
-   int numhdrs = 0;
+   aaesim::open_source::CsvCursor csv_row(csv_file);
+   csv_row.SkipLines(1);
 
-   for (CsvParser::CsvIterator csviter(file); csviter != CsvParser::CsvIterator(); ++csviter) {
-
-      if (numhdrs < 1) {
-         numhdrs++;
-         continue;
-      }
-
-      if ((*csviter).Size() != NUM_VERTICAL_TRAJ_FIELDS) {
+   while (csv_row.Advance()) {
+      if (csv_row.Size() != NUM_VERTICAL_TRAJ_FIELDS) {
          std::cout << "Bad number of fields found in " << m_vertical_trajectory_file.c_str() << std::endl
-                   << "vertical trajectory file.  Found " << (*csviter).Size() << " fields expected "
+                   << "vertical trajectory file.  Found " << csv_row.Size() << " fields expected "
                    << NUM_VERTICAL_TRAJ_FIELDS << " fields." << std::endl;
          exit(-21);
       }
 
       for (int vfield = TIME_TO_GO_SEC; vfield != NUM_VERTICAL_TRAJ_FIELDS; vfield++) {
-         std::string fieldstr = (*csviter)[vfield];
-
-         double val = atof(fieldstr.c_str());
+         double val = csv_row.GetDouble(vfield);
 
          switch (static_cast<VerticalFields>(vfield)) {
             case TIME_TO_GO_SEC:
@@ -279,8 +254,6 @@ void TrajectoryFromFile::ReadVerticalTrajectoryFile() {
          }
       }
    }
-
-   file.close();
 }
 
 void TrajectoryFromFile::ReadHorizontalTrajectoryFile() {
@@ -310,8 +283,9 @@ void TrajectoryFromFile::ReadHorizontalTrajectoryFile() {
       m_horizontal_trajectory.push_back(horizontal_path_segment);
    }
 
+   const auto horizontal_path = ExtendedHorizontalPath::Of(m_horizontal_trajectory);
    m_decrementing_distance_calculator =
-         AlongPathDistanceCalculator(m_horizontal_trajectory, TrajectoryIndexProgressionDirection::DECREMENTING);
+         AlongPathDistanceCalculator(horizontal_path, TrajectoryIndexProgressionDirection::DECREMENTING);
    m_decrementing_position_calculator =
-         PositionCalculator(m_horizontal_trajectory, TrajectoryIndexProgressionDirection::DECREMENTING);
+         PositionCalculator(horizontal_path, TrajectoryIndexProgressionDirection::DECREMENTING);
 }
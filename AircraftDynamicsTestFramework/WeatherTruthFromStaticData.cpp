@@ -19,17 +19,23 @@
 
 #include "framework/WeatherTruthFromStaticData.h"
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 
-#include "MiniCSV/minicsv.h"
+#include "public/CsvFile.h"
 
 using namespace fmacm;
 
 WeatherTruthFromStaticData::WeatherTruthFromStaticData()
-   : m_weather_data_points_by_time(),
-     m_weather_data_points_by_dtg(),
+   : m_weather_table(),
      m_weather_data_point(),
-     m_data_index(DataIndexParameter::SIMULATION_TIME) {
+     m_data_index(DataIndexParameter::SIMULATION_TIME),
+     m_interpolate_between_rows(false),
+     m_wind_stacks_loaded(false),
+     m_wind_stack_middle_thousand(0),
+     m_wind_stack_east(),
+     m_wind_stack_north() {
    m_wind_interpolator = std::make_shared<fmacm::WindInterpolator>();
    m_wind = std::static_pointer_cast<Wind>(m_wind_interpolator);
    SetAtmosphere(std::make_shared<ATMOSPHERE_IMPL>());
@@ -38,27 +44,10 @@ WeatherTruthFromStaticData::WeatherTruthFromStaticData()
 void WeatherTruthFromStaticData::Update(const aaesim::open_source::SimulationTime &simulation_time,
                                         const Units::Length &current_distance_to_go,
                                         const Units::Length &altitude_msl) {
-   if (m_data_index == DataIndexParameter::SIMULATION_TIME) {
-      auto it = m_weather_data_points_by_time.lower_bound(simulation_time.GetCurrentSimulationTime());
-      Units::Time t1;
-      if (it == m_weather_data_points_by_time.end()) {
-         auto rit = m_weather_data_points_by_time.rbegin();
-         t1 = rit->first;
-      } else {
-         t1 = it->first;
-      }
-      m_weather_data_point = m_weather_data_points_by_time[t1];
-   } else {
-      auto it = m_weather_data_points_by_dtg.lower_bound(current_distance_to_go);
-      Units::Length dtg1;
-      if (it == m_weather_data_points_by_dtg.end()) {
-         auto rit = m_weather_data_points_by_dtg.rbegin();
-         dtg1 = rit->first;
-      } else {
-         dtg1 = it->first;
-      }
-      m_weather_data_point = m_weather_data_points_by_dtg[dtg1];
-   }
+   const double index_value = m_data_index == DataIndexParameter::SIMULATION_TIME
+                                    ? Units::SecondsTime(simulation_time.GetCurrentSimulationTime()).value()
+                                    : Units::MetersLength(current_distance_to_go).value();
+   m_weather_data_point = m_weather_table.DataPointAt(index_value, m_interpolate_between_rows);
    m_temperature = Units::KelvinTemperature(m_weather_data_point.temperature.value());
    m_wind_interpolator->UpdateWindDataPoint(m_weather_data_point);
    LoadConditionsAt(Units::ZERO_ANGLE, Units::ZERO_ANGLE, altitude_msl);
@@ -66,51 +55,151 @@ void WeatherTruthFromStaticData::Update(const aaesim::open_source::SimulationTim
 
 Units::KelvinTemperature WeatherTruthFromStaticData::Initialize(const std::string &env_csv_file,
                                                                 const Units::Length &altitude,
-                                                                DataIndexParameter primary_index) {
+                                                                DataIndexParameter primary_index,
+                                                                bool interpolate_between_rows,
+                                                                bool tabulated_atmosphere,
+                                                                const std::shared_ptr<InputTableCache> &input_tables) {
    m_data_index = primary_index;
-   LoadEnvFile(env_csv_file);
+   m_interpolate_between_rows = interpolate_between_rows;
+   LoadEnvFile(env_csv_file, *input_tables);
    Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::Infinity(), altitude);
 
    const ATMOSPHERE_IMPL basic_atm;
    Units::Temperature offset_difference = GetTemperature() - basic_atm.GetTemperature(altitude);
    Units::Temperature offset = basic_atm.GetTemperatureOffset() + offset_difference;
-   std::shared_ptr<Atmosphere> atmosphere_with_offset = std::make_shared<ATMOSPHERE_IMPL>(offset);
+   std::shared_ptr<Atmosphere> atmosphere_with_offset;
+   if (tabulated_atmosphere) {
+      atmosphere_with_offset = std::make_shared<TabulatedAtmosphere>(std::make_unique<ATMOSPHERE_IMPL>(offset));
+   } else {
+      atmosphere_with_offset = std::make_shared<ATMOSPHERE_IMPL>(offset);
+   }
    SetAtmosphere(atmosphere_with_offset);
 
    Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::Infinity(), altitude);
    return offset;
 }
 
-void WeatherTruthFromStaticData::LoadEnvFile(const std::string &env_csv_file) {
-   m_weather_data_points_by_time.clear();
+void WeatherTruthFromStaticData::ScaleWind(double factor) { m_weather_table.ScaleWind(factor); }
 
+void WeatherTruthFromStaticData::LoadEnvFile(const std::string &env_csv_file, InputTableCache &input_tables) {
    if (env_csv_file.empty()) {
       auto msg = "No env_csv_file specified; please load a weather file.";
       throw std::runtime_error(msg);
    }
 
-   mini::csv::ifstream input_stream(env_csv_file);
-   input_stream.set_delimiter(',', ",");
-   if (input_stream.is_open()) {
-      input_stream.read_line();
-      while (input_stream.read_line()) {
-         EnvFileRow data_row;
-         input_stream >> data_row.simtime_seconds >> data_row.distance_to_go_meters >> data_row.wind_x_enu_mps >>
-               data_row.wind_y_enu_mps >> data_row.wind_dx_dh_hz >> data_row.wind_dy_dh_hz >>
-               data_row.temperature_kelvin;
-
-         WindInterpolator::WeatherDataPoint data_point;
-         data_point.Vwx = Units::MetersPerSecondSpeed(data_row.wind_x_enu_mps);
-         data_point.Vwy = Units::MetersPerSecondSpeed(data_row.wind_y_enu_mps);
-         data_point.dVwx_dh = Units::HertzFrequency(data_row.wind_dx_dh_hz);
-         data_point.dVwy_dh = Units::HertzFrequency(data_row.wind_dy_dh_hz);
-         data_point.temperature = Units::AbsKelvinTemperature(data_row.temperature_kelvin);
-
-         m_weather_data_points_by_time[Units::SecondsTime(data_row.simtime_seconds)] = data_point;
-         m_weather_data_points_by_dtg[Units::MetersLength(data_row.distance_to_go_meters)] = data_point;
+   const auto env_rows = input_tables.Get<std::vector<EnvFileRow> >(env_csv_file, ReadEnvFile);
+   if (!env_rows || env_rows->empty()) {
+      std::string msg = "No weather data found in env_csv_file: " + env_csv_file;
+      throw std::runtime_error(msg);
+   }
+
+   std::vector<std::pair<double, EnvFileRow> > rows;
+   rows.reserve(env_rows->size());
+   for (const auto &data_row : *env_rows) {
+      const double index_value = m_data_index == DataIndexParameter::SIMULATION_TIME
+                                       ? data_row.simtime_seconds
+                                       : data_row.distance_to_go_meters;
+      rows.emplace_back(index_value, data_row);
+   }
+   m_weather_table.Assign(std::move(rows));
+}
+
+std::vector<WeatherTruthFromStaticData::EnvFileRow> WeatherTruthFromStaticData::ReadEnvFile(
+      const std::shared_ptr<const aaesim::open_source::CsvFile> &csv_file) {
+   std::vector<EnvFileRow> env_rows;
+   aaesim::open_source::CsvCursor csv_row(csv_file);
+   csv_row.SkipLines(1);
+   // the data ends at the first blank line
+   while (csv_row.Advance() && csv_row.Size() > 0) {
+      EnvFileRow data_row;
+      data_row.simtime_seconds = csv_row.GetDouble(0);
+      data_row.distance_to_go_meters = csv_row.GetDouble(1);
+      data_row.wind_x_enu_mps = csv_row.GetDouble(2);
+      data_row.wind_y_enu_mps = csv_row.GetDouble(3);
+      data_row.wind_dx_dh_hz = csv_row.GetDouble(4);
+      data_row.wind_dy_dh_hz = csv_row.GetDouble(5);
+      data_row.temperature_kelvin = csv_row.GetDouble(6);
+      env_rows.push_back(data_row);
+   }
+   return env_rows;
+}
+
+void WeatherTruthFromStaticData::WeatherTable::Assign(std::vector<std::pair<double, EnvFileRow> > &&rows) {
+   // ENV files are normally written in time order, which is reverse distance-to-go order. A stable sort keeps
+   // the last row of any duplicated index value last, and that row is the one retained below.
+   std::stable_sort(rows.begin(), rows.end(),
+                    [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+   index_values.clear();
+   wind_x_enu_mps.clear();
+   wind_y_enu_mps.clear();
+   wind_dx_dh_hz.clear();
+   wind_dy_dh_hz.clear();
+   temperature_kelvin.clear();
+   cursor = 0;
+
+   for (const auto &[index_value, row] : rows) {
+      if (!index_values.empty() && index_values.back() == index_value) {
+         wind_x_enu_mps.back() = row.wind_x_enu_mps;
+         wind_y_enu_mps.back() = row.wind_y_enu_mps;
+         wind_dx_dh_hz.back() = row.wind_dx_dh_hz;
+         wind_dy_dh_hz.back() = row.wind_dy_dh_hz;
+         temperature_kelvin.back() = row.temperature_kelvin;
+         continue;
       }
+      index_values.push_back(index_value);
+      wind_x_enu_mps.push_back(row.wind_x_enu_mps);
+      wind_y_enu_mps.push_back(row.wind_y_enu_mps);
+      wind_dx_dh_hz.push_back(row.wind_dx_dh_hz);
+      wind_dy_dh_hz.push_back(row.wind_dy_dh_hz);
+      temperature_kelvin.push_back(row.temperature_kelvin);
    }
-   input_stream.close();
+}
+
+void WeatherTruthFromStaticData::WeatherTable::ScaleWind(double factor) {
+   for (auto *column : {&wind_x_enu_mps, &wind_y_enu_mps, &wind_dx_dh_hz, &wind_dy_dh_hz}) {
+      for (auto &value : *column) {
+         value *= factor;
+      }
+   }
+}
+
+std::size_t WeatherTruthFromStaticData::WeatherTable::Seek(double index_value) {
+   // Find the first row whose index is not less than index_value, clamped to the last row. Time queries move
+   // the cursor forward and distance-to-go queries move it backward, one row at a time.
+   const std::size_t last = index_values.size() - 1;
+   while (cursor < last && index_values[cursor] < index_value) {
+      ++cursor;
+   }
+   while (cursor > 0 && index_values[cursor - 1] >= index_value) {
+      --cursor;
+   }
+   return cursor;
+}
+
+fmacm::WindInterpolator::WeatherDataPoint WeatherTruthFromStaticData::WeatherTable::DataPointAt(double index_value,
+                                                                                                  bool interpolate) {
+   const std::size_t upper = Seek(index_value);
+   std::size_t lower = upper;
+   double weight = 0;
+   if (interpolate && upper > 0 && index_values[upper] > index_value) {
+      const double span = index_values[upper] - index_values[upper - 1];
+      if (std::isfinite(span)) {
+         lower = upper - 1;
+         weight = (index_value - index_values[lower]) / span;
+      }
+   }
+   auto blend = [lower, upper, weight](const std::vector<double> &column) {
+      return column[lower] + weight * (column[upper] - column[lower]);
+   };
+
+   fmacm::WindInterpolator::WeatherDataPoint data_point;
+   data_point.Vwx = Units::MetersPerSecondSpeed(blend(wind_x_enu_mps));
+   data_point.Vwy = Units::MetersPerSecondSpeed(blend(wind_y_enu_mps));
+   data_point.dVwx_dh = Units::HertzFrequency(blend(wind_dx_dh_hz));
+   data_point.dVwy_dh = Units::HertzFrequency(blend(wind_dy_dh_hz));
+   data_point.temperature = Units::AbsKelvinTemperature(blend(temperature_kelvin));
+   return data_point;
 }
 
 void WeatherTruthFromStaticData::LoadConditionsAt(const Units::Angle latitude, const Units::Angle longitude,
@@ -124,6 +213,12 @@ void WeatherTruthFromStaticData::LoadConditionsAt(const Units::Angle latitude, c
    int middle_thousand = round(altitude / Units::FeetLength(1000));
    middle_thousand = std::max(middle_thousand, 2);
 
+   // the stacks only depend on the altitude band and the current data point
+   if (m_wind_stacks_loaded && middle_thousand == m_wind_stack_middle_thousand &&
+       m_weather_data_point.Vwx == m_wind_stack_east && m_weather_data_point.Vwy == m_wind_stack_north) {
+      return;
+   }
+
    east_west().SetBounds(middle_thousand - 1, middle_thousand + 3);
    north_south().SetBounds(middle_thousand - 1, middle_thousand + 3);
 
@@ -133,4 +228,8 @@ void WeatherTruthFromStaticData::LoadConditionsAt(const Units::Angle latitude, c
       east_west().Insert(i, Units::MetersLength(alt_meters), m_weather_data_point.Vwx);
       north_south().Insert(i, Units::MetersLength(alt_meters), m_weather_data_point.Vwy);
    }
+   m_wind_stacks_loaded = true;
+   m_wind_stack_middle_thousand = middle_thousand;
+   m_wind_stack_east = m_weather_data_point.Vwx;
+   m_wind_stack_north = m_weather_data_point.Vwy;
 }
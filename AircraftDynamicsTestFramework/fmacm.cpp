@@ -18,18 +18,24 @@
 // ****************************************************************************
 
 #include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <fstream>
 #include <stdlib.h>
 #include <string>
+#include <thread>
 #include <unistd.h>
 
 #include "cppmanifest/cppmanifest.h"
 #include "framework/TestFrameworkScenario.h"
 #include "loader/RunFileArchiveDirector.h"
 #include "loader/Loadable.h"
+#include "loader/ParsedScenarioCache.h"
 #include "public/Logging.h"
 #include "public/ScenarioUtils.h"
+#include "public/SingleTangentPlaneSequence.h"
 #include <log4cplus/initializer.h>
 
 #define _MAX_PATH 260
@@ -38,16 +44,22 @@ const std::vector<std::pair<std::string, std::shared_ptr<TestFrameworkScenario>>
       std::string str);
 
 void ProcessScenarioDescriptions(
-      const std::vector<std::pair<std::string, std::shared_ptr<TestFrameworkScenario>>> &scenarios);
+      const std::vector<std::pair<std::string, std::shared_ptr<TestFrameworkScenario>>> &scenarios,
+      unsigned int number_of_jobs, const std::string &parse_cache_directory);
 
 static log4cplus::Logger logger = log4cplus::Logger::getInstance(LOG4CPLUS_TEXT("main"));
 const std::string VERSION_FLAG("--version");
+const std::string JOBS_FLAG("--jobs");
+const std::string PARSE_CACHE_FLAG("--parse-cache");
 
 int main(int argc, char *argv[]) {
    log4cplus::Initializer initializer;
    LoadLoggerProperties();
    LOG4CPLUS_INFO(logger, "running " << aaesim::cppmanifest::GetVersion());
 
+   unsigned int number_of_jobs = 1;
+   std::string parse_cache_directory;
+   std::string configuration_filename;
    if (argc == 2) {
       std::string arg1(argv[1]);
       if (arg1 == VERSION_FLAG) {
@@ -58,13 +70,33 @@ int main(int argc, char *argv[]) {
          aaesim::cppmanifest::PrintMetaData();
          return 0;
       }
-   } else {
-      std::string error_msg = "Invalid number of command line arguments; only one is allowed.";
+   }
+   int arg_index = 1;
+   for (; arg_index + 1 < argc; arg_index += 2) {
+      const std::string flag(argv[arg_index]);
+      if (flag == JOBS_FLAG) {
+         const int requested_jobs = atoi(argv[arg_index + 1]);
+         if (requested_jobs < 1) {
+            std::string error_msg = "Invalid " + JOBS_FLAG + " value " + argv[arg_index + 1] +
+                                    "; must be a positive integer.";
+            LOG4CPLUS_FATAL(logger, error_msg);
+            throw std::runtime_error(error_msg);
+         }
+         number_of_jobs = static_cast<unsigned int>(requested_jobs);
+      } else if (flag == PARSE_CACHE_FLAG) {
+         parse_cache_directory = argv[arg_index + 1];
+      } else {
+         break;
+      }
+   }
+   if (arg_index != argc - 1) {
+      std::string error_msg = "Invalid command line arguments; expected [" + JOBS_FLAG + " N] [" + PARSE_CACHE_FLAG +
+                              " DIR] configuration_file.";
       LOG4CPLUS_FATAL(logger, error_msg);
       throw std::runtime_error(error_msg);
    }
+   configuration_filename = argv[arg_index];
 
-   std::string configuration_filename = argv[1];
    if (configuration_filename.empty()) {
       std::string error_msg = "No configuration file provided. Must provide a configuration file.";
       LOG4CPLUS_FATAL(logger, error_msg);
@@ -72,7 +104,7 @@ int main(int argc, char *argv[]) {
    }
 
    auto scenario_descriptions = LoadConfigurationFile(configuration_filename);
-   ProcessScenarioDescriptions(scenario_descriptions);
+   ProcessScenarioDescriptions(scenario_descriptions, number_of_jobs, parse_cache_directory);
    scenario_descriptions.clear();
    return 0;
 }
@@ -111,17 +143,22 @@ const std::vector<std::pair<std::string, std::shared_ptr<TestFrameworkScenario>>
 }
 
 void ProcessScenarioDescriptions(
-      const std::vector<std::pair<std::string, std::shared_ptr<TestFrameworkScenario>>> &scenarios) {
+      const std::vector<std::pair<std::string, std::shared_ptr<TestFrameworkScenario>>> &scenarios,
+      unsigned int number_of_jobs, const std::string &parse_cache_directory) {
    char current_path[_MAX_PATH];
    getcwd(current_path, _MAX_PATH);
    const std::string cwd = current_path;
 
    auto scenario_runner =
-         [cwd](const std::pair<std::string, std::shared_ptr<TestFrameworkScenario>> &scenario_description) {
+         [cwd, &parse_cache_directory](const std::pair<std::string, std::shared_ptr<TestFrameworkScenario>>
+                                             &scenario_description) {
             auto scenario_file_name = scenario_description.first;
             auto scenario = scenario_description.second;
             LOG4CPLUS_INFO(logger, "Processing Scenario File: " << scenario_file_name << std::endl);
 
+            // each scenario builds its own tangent plane sequence, regardless of which thread runs it
+            SingleTangentPlaneSequence::ClearStaticMembers();
+
             DecodedStream stream;
             bool r = stream.open_file(scenario_file_name);
             if (!r) {
@@ -132,10 +169,45 @@ void ProcessScenarioDescriptions(
             stream.set_echo(false);
             stream.set_Local_Path(cwd);
             stream.set_Archive_Director(std::make_shared<RunFileArchiveDirector>());
+            if (!parse_cache_directory.empty()) {
+               const bool cached = stream.use_parse_cache(
+                     ParsedScenarioCache::CacheFileName(parse_cache_directory, scenario_file_name));
+               LOG4CPLUS_INFO(logger, (cached ? "Using" : "Rebuilt") << " parse cache for " << scenario_file_name);
+            }
             auto scenario_root_name = aaesim::open_source::ScenarioUtils::ResolveScenarioRootName(scenario_file_name);
             scenario->SetScenarioName(scenario_root_name);
             scenario->load(&stream);
             scenario->SimulateAllIterations();
          };
-   std::for_each(scenarios.begin(), scenarios.end(), scenario_runner);
+
+   const unsigned int number_of_workers = std::min<std::size_t>(number_of_jobs, scenarios.size());
+   if (number_of_workers <= 1) {
+      std::for_each(scenarios.begin(), scenarios.end(), scenario_runner);
+      return;
+   }
+
+   // Scenarios are independent, so each worker claims the next unprocessed scenario until none remain. A failure is
+   // held until all workers have finished and then rethrown in configuration file order.
+   LOG4CPLUS_INFO(logger, "Running " << scenarios.size() << " scenarios on " << number_of_workers << " threads");
+   std::atomic<std::size_t> next_scenario_index{0};
+   std::vector<std::exception_ptr> scenario_failures(scenarios.size());
+   auto worker = [&scenarios, &scenario_runner, &next_scenario_index, &scenario_failures]() {
+      for (std::size_t i = next_scenario_index++; i < scenarios.size(); i = next_scenario_index++) {
+         try {
+            scenario_runner(scenarios[i]);
+         } catch (...) {
+            scenario_failures[i] = std::current_exception();
+         }
+      }
+   };
+   std::vector<std::thread> workers;
+   for (unsigned int i = 0; i < number_of_workers; ++i) {
+      workers.emplace_back(worker);
+   }
+   std::for_each(workers.begin(), workers.end(), [](std::thread &t) { t.join(); });
+   for (const auto &failure : scenario_failures) {
+      if (failure) {
+         std::rethrow_exception(failure);
+      }
+   }
 }
@@ -0,0 +1,75 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+// Converts a binary aircraft state file (written when a scenario sets aircraft_state_output_format to binary) into
+// the CSV layout of the default _AcStates.csv output.
+//
+//    fmacm_bin2csv input_AcStates.bin [output.csv] [--precision N]
+//
+// Without an output file, the CSV is written to standard output.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "framework/BinaryAircraftStateReader.h"
+
+const std::string PRECISION_FLAG("--precision");
+
+int main(int argc, char *argv[]) {
+   std::vector<std::string> positional_arguments;
+   int precision = -1;
+   for (int i = 1; i < argc; ++i) {
+      std::string argument(argv[i]);
+      if (argument == PRECISION_FLAG && i + 1 < argc) {
+         precision = atoi(argv[++i]);
+      } else {
+         positional_arguments.push_back(argument);
+      }
+   }
+   if (positional_arguments.empty() || positional_arguments.size() > 2) {
+      std::cerr << "usage: " << argv[0] << " input_AcStates.bin [output.csv] [" << PRECISION_FLAG << " N]"
+                << std::endl;
+      return 1;
+   }
+
+   try {
+      fmacm::BinaryAircraftStateReader reader(positional_arguments[0]);
+      std::ofstream output_file;
+      if (positional_arguments.size() == 2) {
+         output_file.open(positional_arguments[1]);
+         if (!output_file.is_open()) {
+            std::cerr << "Cannot open " << positional_arguments[1] << std::endl;
+            return 1;
+         }
+      }
+      std::ostream &os = output_file.is_open() ? output_file : std::cout;
+      if (precision > 0) {
+         reader.WriteCsv(os, precision);
+      } else {
+         reader.WriteCsv(os);
+      }
+   } catch (std::exception &e) {
+      std::cerr << e.what() << std::endl;
+      return 1;
+   }
+   return 0;
+}
@@ -19,8 +19,10 @@ if(NOT ${BUILD_LIBARIES_ONLY})
 
     SET(FMACM_MAIN_SRC ${FRAMEWORK_DIR}/fmacm.cpp)
 
+    find_package(Threads REQUIRED)
+
     add_executable(FMACM ${FMACM_MAIN_SRC})
-    target_link_libraries(FMACM framework)
+    target_link_libraries(FMACM framework Threads::Threads)
     target_include_directories(FMACM PUBLIC 
         $<BUILD_INTERFACE:${geolib_idealab_INCLUDE_DIRS}>
         $<BUILD_INTERFACE:${nlohmann_json_SOURCE_DIR}/include>
@@ -32,6 +34,13 @@ if(NOT ${BUILD_LIBARIES_ONLY})
     set_target_properties(FMACM PROPERTIES
             RUNTIME_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/bin
     )
+
+    # converts binary aircraft state output back to CSV
+    add_executable(fmacm_bin2csv ${FRAMEWORK_DIR}/fmacm_bin2csv.cpp)
+    target_link_libraries(fmacm_bin2csv framework)
+    set_target_properties(fmacm_bin2csv PROPERTIES
+            RUNTIME_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/bin
+    )
 else()
     # Ensure framework library is a build target even though nothing depends on it
     set_target_properties(framework PROPERTIES EXCLUDE_FROM_ALL FALSE)
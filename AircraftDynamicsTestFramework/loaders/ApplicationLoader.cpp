@@ -20,6 +20,7 @@
 #include "framework/ApplicationLoader.h"
 
 #include "public/NullFlightDeckApplication.h"
+#include "public/ScenarioUtils.h"
 #include "public/StatisticalPilotDelay.h"
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
@@ -51,8 +52,16 @@ bool ApplicationLoader::load(DecodedStream *input) {
 std::shared_ptr<aaesim::open_source::FlightDeckApplication> ApplicationLoader::CreateApplication(
       aaesim::open_source::WeatherPrediction &avionic_weather_predictor) {
    if (m_im_speed_command_file.IsLoaded()) {
-      Units::Time delay_duration =
-            m_pilot_delay_configuration.IsEnabled() ? m_pilot_delay_configuration.DelayDuration() : Units::ZERO_TIME;
+      Units::Time delay_duration = Units::ZERO_TIME;
+      if (m_pilot_delay_configuration.IsEnabled()) {
+         const Units::Time mean = m_pilot_delay_configuration.DelayDuration();
+         const Units::Time standard_deviation = m_pilot_delay_configuration.DelayStandardDeviation();
+         delay_duration =
+               m_random_stream
+                     ? m_random_stream->TruncatedGaussianSample(mean, standard_deviation, 3.0)
+                     : aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR.TruncatedGaussianSample(
+                             mean, standard_deviation, 3.0);
+      }
       auto speed_commands = m_im_speed_command_file.Build(delay_duration);
       return std::make_shared<SpeedCommandsFromStaticData>(speed_commands);
    }
@@ -60,7 +69,11 @@ std::shared_ptr<aaesim::open_source::FlightDeckApplication> ApplicationLoader::C
    auto statistical_pilot_delay = aaesim::open_source::StatisticalPilotDelay::NoDelay();
    if (m_pilot_delay_configuration.IsEnabled()) {
       statistical_pilot_delay = aaesim::open_source::StatisticalPilotDelay::WithDelay(
-            m_pilot_delay_configuration.DelayDuration(), Units::zero(), avionic_weather_predictor.getAtmosphere());
+            m_pilot_delay_configuration.DelayDuration(), m_pilot_delay_configuration.DelayStandardDeviation(),
+            avionic_weather_predictor.getAtmosphere());
+      if (m_random_stream) {
+         statistical_pilot_delay.SetRandomStream(m_random_stream->Split(0));
+      }
    }
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
@@ -89,5 +102,6 @@ bool ApplicationLoader::PilotConfiguration::load(DecodedStream *input) {
    set_stream(input);
    register_var("use_pilot_delay", &m_is_enabled, false);
    register_var("pilot_delay_seconds", &m_delay_duration, false);
+   register_var("pilot_delay_standard_deviation_seconds", &m_delay_standard_deviation, false);
    return complete();
 }
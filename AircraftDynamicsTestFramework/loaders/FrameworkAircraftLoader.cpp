@@ -55,12 +55,18 @@ double FrameworkAircraftLoader::m_start_time_default = 0;
 FrameworkAircraftLoader::FrameworkAircraftLoader()
    : m_start_time(m_start_time_default),
      m_mass_fraction(m_mass_fraction_default),
+     m_wind_scale_factor(1),
      m_ac_type(),
      m_speed_management_type(),
      m_ttv_csv_file(),
      m_forewind_csv_file(),
      m_env_csv_file(),
      m_env_csv_data_index(),
+     m_env_csv_interpolate(false),
+     m_tabulated_atmosphere(false),
+     m_dynamics_integrator(),
+     m_dynamics_history(),
+     m_dynamics_history_length(1),
      m_guidance_loader(),
      m_flightdeck_application_loader() {}
 
@@ -73,6 +79,11 @@ bool FrameworkAircraftLoader::load(DecodedStream *input) {
    register_var("speed_management_type", &m_speed_management_type, true);
    register_var("env_csv_file", &m_env_csv_file, false);
    register_var("env_data_index", &m_env_csv_data_index, false);
+   register_var("env_data_interpolate", &m_env_csv_interpolate, false);
+   register_var("tabulated_atmosphere", &m_tabulated_atmosphere, false);
+   register_var("dynamics_integrator", &m_dynamics_integrator, false);
+   register_var("dynamics_history", &m_dynamics_history, false);
+   register_var("dynamics_history_length", &m_dynamics_history_length, false);
    register_var("ttv_csv_file", &m_ttv_csv_file, false);
    register_var("forewind_csv_file", &m_forewind_csv_file, false);
    register_loadable_with_brackets("fms_guidance_data_files", &m_guidance_loader, true);
@@ -84,7 +95,7 @@ std::shared_ptr<TestFrameworkAircraft> FrameworkAircraftLoader::BuildAircraft()
    auto bada_calculator = BuildAircraftPerformance(m_ac_type);
    auto guidance_calculator = m_guidance_loader.BuildGuidanceCalculator();
    auto true_weather =
-         BuildTrueWeather(m_env_csv_file, m_env_csv_data_index,
+         BuildTrueWeather(m_env_csv_file, m_env_csv_data_index, m_env_csv_interpolate, m_tabulated_atmosphere,
                           Units::MetersLength(guidance_calculator->GetVerticalData().m_altitude_meters.back()));
    m_initial_local_position = ComputeInitialPositionOnPath(guidance_calculator);
    EarthModel::GeodeticPosition wgs84;
@@ -130,7 +141,7 @@ std::shared_ptr<aaesim::open_source::ThreeDOFDynamics> FrameworkAircraftLoader::
    auto initial_altitude = Units::MetersLength(guidance->GetVerticalData().m_altitude_meters.back());
    Units::KnotsSpeed initial_ias = Units::MetersPerSecondSpeed(guidance->GetVerticalData().m_ias_mps.back());
    DirectionOfFlightCourseCalculator course_calculator = DirectionOfFlightCourseCalculator(
-         guidance->GetHorizontalTrajectory(), TrajectoryIndexProgressionDirection::UNDEFINED);
+         guidance->GetExtendedHorizontalPath(), TrajectoryIndexProgressionDirection::UNDEFINED);
    Units::Angle initial_heading = course_calculator.GetCourseAtPathStart();
    true_weather->Update(aaesim::open_source::SimulationTime::Of(Units::SecondsTime(m_start_time)), Units::infinity(),
                         initial_altitude);
@@ -141,6 +152,12 @@ std::shared_ptr<aaesim::open_source::ThreeDOFDynamics> FrameworkAircraftLoader::
    std::shared_ptr<aaesim::open_source::TrueWeatherOperator> true_weather_operator =
          std::make_shared<aaesim::open_source::FullWindTrueWeatherOperator>(true_weather);
    auto dynamics = std::make_shared<aaesim::open_source::ThreeDOFDynamics>();
+   dynamics->SetIntegrationMethod(aaesim::open_source::IntegrationMethodFromString(m_dynamics_integrator));
+   // nothing in the framework reads the dynamics history, so only the latest state is kept unless requested
+   dynamics->SetDynamicsStateHistoryPolicy(
+         m_dynamics_history.empty() ? aaesim::open_source::DynamicsStateHistory::Policy::NONE
+                                    : aaesim::open_source::DynamicsStateHistory::PolicyFromString(m_dynamics_history),
+         std::max(m_dynamics_history_length, 1));
    dynamics->Initialize(aaesim::open_source::SimulationTime::Of(Units::SecondsTime(m_start_time)), performance,
                         initial_wgs84_position, m_initial_local_position, initial_altitude, initial_tas,
                         initial_heading, m_mass_fraction, position_estimator, true_weather_operator);
@@ -152,9 +169,9 @@ std::tuple<bool, EarthModel::LocalPositionEnu> FrameworkAircraftLoader::IsDistan
       const Units::Length &target_distance_along_path) const {
    static Units::MetersLength along_path_distance_tolerance(10);
    const auto expected_trajectory_index = guidance_calculator->GetHorizontalTrajectory().size() - 1;
-   AlongPathDistanceCalculator along_path_calculator(guidance_calculator->GetHorizontalTrajectory(),
+   AlongPathDistanceCalculator along_path_calculator(guidance_calculator->GetExtendedHorizontalPath(),
                                                      TrajectoryIndexProgressionDirection::DECREMENTING);
-   PositionCalculator position_calculator(guidance_calculator->GetHorizontalTrajectory(),
+   PositionCalculator position_calculator(guidance_calculator->GetExtendedHorizontalPath(),
                                           TrajectoryIndexProgressionDirection::DECREMENTING);
 
    Units::Length computed_along_path_distance;
@@ -203,11 +220,14 @@ EarthModel::LocalPositionEnu FrameworkAircraftLoader::ComputeInitialPositionOnPa
 }
 
 std::shared_ptr<fmacm::WeatherTruthFromStaticData> FrameworkAircraftLoader::BuildTrueWeather(
-      std::string env_csv_file, std::string env_csv_data_index, Units::Length initial_altitude) {
+      std::string env_csv_file, std::string env_csv_data_index, bool interpolate_between_rows,
+      bool tabulated_atmosphere, Units::Length initial_altitude) {
    if (!env_csv_file.empty()) {
       auto weather_truth = std::make_shared<fmacm::WeatherTruthFromStaticData>();
       weather_truth->Initialize(env_csv_file, initial_altitude,
-                                fmacm::WeatherTruthFromStaticData::DataIndexFromString(env_csv_data_index));
+                                fmacm::WeatherTruthFromStaticData::DataIndexFromString(env_csv_data_index),
+                                interpolate_between_rows, tabulated_atmosphere, m_input_tables);
+      if (m_wind_scale_factor != 1) weather_truth->ScaleWind(m_wind_scale_factor);
       return weather_truth;
    } else {
       return std::make_shared<fmacm::WeatherTruthFromStaticData>(
@@ -19,7 +19,7 @@
 
 #include "framework/GuidanceDataLoader.h"
 
-#include "utility/CsvParser.h"
+#include "public/CsvFile.h"
 #include "framework/HfpReader2020.h"
 #include "public/CoreUtils.h"
 #include "framework/WaypointSequenceReader.h"
@@ -65,19 +65,31 @@ std::shared_ptr<GuidanceFromStaticData> GuidanceDataLoader::BuildGuidanceCalcula
 
    DoDebugLogging(horizontal_path_data.second);
 
-   return std::make_shared<GuidanceFromStaticData>(horizontal_path_data.second, BuildVerticalGuidanceData(),
+   const auto vertical_data = m_input_tables->Get<GuidanceFromStaticData::VerticalData>(
+         m_vfp_filename, [this](const auto &csv_file) { return ReadVerticalData(csv_file); });
+   if (!vertical_data) {
+      std::string msg = "Vertical trajectory file " + m_vfp_filename + " not found";
+      throw std::runtime_error(msg);
+   }
+
+   return std::make_shared<GuidanceFromStaticData>(horizontal_path_data.second, *vertical_data,
                                                    m_planned_descent_parameters);
 }
 
 std::pair<std::shared_ptr<TangentPlaneSequence>, std::vector<HorizontalPath>> GuidanceDataLoader::ProcessHfpData()
       const {
-   auto tangent_plane_sequence = BuildTangentPlaneFromFileData();
-   testvector::HfpReader2020 hfp_reader(m_hfp_filename, 1);
+   const auto hfp_table = m_input_tables->Get<HfpTable>(m_hfp_filename, ReadHfpTable);
+   if (!hfp_table) {
+      std::string msg = "Horizontal trajectory file " + m_hfp_filename + " not found";
+      throw std::runtime_error(msg);
+   }
+
+   auto tangent_plane_sequence = BuildTangentPlaneFromFileData(*hfp_table);
    std::vector<HorizontalPath> hpath;
    if (m_compute_xy)
-      hpath = BuildHorizontalPathComputeEuclideanComponents(hfp_reader, tangent_plane_sequence);
+      hpath = BuildHorizontalPathComputeEuclideanComponents(*hfp_table, tangent_plane_sequence);
    else
-      hpath = BuildHorizontalPathUsingAllColumns(hfp_reader);
+      hpath = BuildHorizontalPathUsingAllColumns(*hfp_table);
    return std::make_pair(tangent_plane_sequence, hpath);
 }
 
@@ -193,11 +205,38 @@ std::pair<std::shared_ptr<TangentPlaneSequence>, std::vector<HorizontalPath>>
    return std::make_pair(tangent_planes, horizontal_path_sequence);
 }
 
-std::shared_ptr<TangentPlaneSequence> GuidanceDataLoader::BuildTangentPlaneFromFileData() const {
-   testvector::HfpReader2020 hfp_reader(m_hfp_filename, 1);
-   std::list<Waypoint> ordered_lat_long_points;
+GuidanceDataLoader::HfpTable GuidanceDataLoader::ReadHfpTable(const std::shared_ptr<const CsvFile> &csv_file) {
+   testvector::HfpReader2020 hfp_reader(csv_file, 1);
+   HfpTable hfp_table;
    while (hfp_reader.Advance()) {
-      Waypoint wp(hfp_reader.GetString(HorizontalFields::IX), hfp_reader.GetLatitude(), hfp_reader.GetLongitude());
+      HfpRow row;
+      row.name = hfp_reader.GetString(HorizontalFields::IX);
+      row.x = hfp_reader.GetX();
+      row.y = hfp_reader.GetY();
+      row.distance_to_go = hfp_reader.GetDTG();
+      row.segment_type = hfp_reader.GetSegmentType();
+      row.course = hfp_reader.GetCourse();
+      row.turn_center_x = hfp_reader.GetTurnCenterX();
+      row.turn_center_y = hfp_reader.GetTurnCenterY();
+      row.angle_start_of_turn = hfp_reader.GetAngleStartOfTurn();
+      row.angle_end_of_turn = hfp_reader.GetAngleEndOfTurn();
+      row.turn_radius = hfp_reader.GetTurnRadius();
+      row.ground_speed = hfp_reader.GetGroundSpeed();
+      row.bank_angle = hfp_reader.GetBankAngle();
+      row.latitude = hfp_reader.GetLatitude();
+      row.longitude = hfp_reader.GetLongitude();
+      row.turn_center_latitude = hfp_reader.GetTurnCenterLatitude();
+      row.turn_center_longitude = hfp_reader.GetTurnCenterLongitude();
+      hfp_table.push_back(row);
+   }
+   return hfp_table;
+}
+
+std::shared_ptr<TangentPlaneSequence> GuidanceDataLoader::BuildTangentPlaneFromFileData(
+      const HfpTable &hfp_table) const {
+   std::list<Waypoint> ordered_lat_long_points;
+   for (const auto &row : hfp_table) {
+      Waypoint wp(row.name, row.latitude, row.longitude);
       ordered_lat_long_points.push_back(wp);
    }
    std::reverse(ordered_lat_long_points.begin(), ordered_lat_long_points.end());
@@ -210,29 +249,19 @@ std::shared_ptr<TangentPlaneSequence> GuidanceDataLoader::BuildTangentPlane(
    return std::make_shared<SingleTangentPlaneSequence>(shortened_legs);
 }
 
-GuidanceFromStaticData::VerticalData GuidanceDataLoader::BuildVerticalGuidanceData() const {
-   std::ifstream file(m_vfp_filename.c_str());
-   if (!file.is_open()) {
-      std::string msg = "Vertical trajectory file " + m_vfp_filename + " not found";
-      throw std::runtime_error(msg);
-   }
-
+GuidanceFromStaticData::VerticalData GuidanceDataLoader::ReadVerticalData(
+      const std::shared_ptr<const CsvFile> &csv_file) const {
    GuidanceFromStaticData::VerticalData vertical_data;
-   int numhdrs = 0;
-   for (CsvParser::CsvIterator csviter(file); csviter != CsvParser::CsvIterator(); ++csviter) {
-      if (numhdrs < 1) {
-         numhdrs++;
-         continue;
-      }
-
-      if ((*csviter).Size() != NUM_VERTICAL_TRAJ_FIELDS) {
+   aaesim::open_source::CsvCursor csv_row(csv_file);
+   csv_row.SkipLines(1);
+   while (csv_row.Advance()) {
+      if (csv_row.Size() != NUM_VERTICAL_TRAJ_FIELDS) {
          std::string msg = "Invalid number of fields found in " + m_vfp_filename + "vertical trajectory file";
          throw std::runtime_error(msg);
       }
 
       for (int vfield = TIME_TO_GO_SEC; vfield != NUM_VERTICAL_TRAJ_FIELDS; vfield++) {
-         std::string fieldstr = (*csviter)[vfield];
-         double val = atof(fieldstr.c_str());
+         double val = csv_row.GetDouble(vfield);
          switch (static_cast<VerticalFields>(vfield)) {
             case TIME_TO_GO_SEC:
                vertical_data.m_time_to_go_sec.push_back(val);
@@ -262,34 +291,29 @@ GuidanceFromStaticData::VerticalData GuidanceDataLoader::BuildVerticalGuidanceDa
       }
    }
 
-   file.close();
-
    return vertical_data;
 }
 
-std::vector<HorizontalPath> GuidanceDataLoader::BuildHorizontalPathUsingAllColumns(
-      testvector::HfpReader2020 &hfp_reader) const {
+std::vector<HorizontalPath> GuidanceDataLoader::BuildHorizontalPathUsingAllColumns(const HfpTable &hfp_table) const {
    std::vector<HorizontalPath> horizontal_path_sequence;
 
-   while (hfp_reader.Advance()) {
+   for (const auto &row : hfp_table) {
       HorizontalPath horizontal_path_segment;
 
-      horizontal_path_segment.SetXYPositionMeters(Units::MetersLength(hfp_reader.GetX()).value(),
-                                                  Units::MetersLength(hfp_reader.GetY()).value());
-      horizontal_path_segment.m_path_length_cumulative_meters = Units::MetersLength(hfp_reader.GetDTG()).value();
-      horizontal_path_segment.m_segment_type = hfp_reader.GetSegmentType();
-      horizontal_path_segment.m_path_course = Units::RadiansAngle(hfp_reader.GetCourse()).value();
+      horizontal_path_segment.SetXYPositionMeters(Units::MetersLength(row.x).value(),
+                                                  Units::MetersLength(row.y).value());
+      horizontal_path_segment.m_path_length_cumulative_meters = Units::MetersLength(row.distance_to_go).value();
+      horizontal_path_segment.m_segment_type = row.segment_type;
+      horizontal_path_segment.m_path_course = Units::RadiansAngle(row.course).value();
 
       if (horizontal_path_segment.m_segment_type == HorizontalPath::SegmentType::TURN) {
-         horizontal_path_segment.m_turn_info.x_position_meters =
-               Units::MetersLength(hfp_reader.GetTurnCenterX()).value();
-         horizontal_path_segment.m_turn_info.y_position_meters =
-               Units::MetersLength(hfp_reader.GetTurnCenterY()).value();
-         horizontal_path_segment.m_turn_info.q_start = hfp_reader.GetAngleStartOfTurn();
-         horizontal_path_segment.m_turn_info.q_end = hfp_reader.GetAngleEndOfTurn();
-         horizontal_path_segment.m_turn_info.radius = hfp_reader.GetTurnRadius();
-         horizontal_path_segment.m_turn_info.groundspeed = hfp_reader.GetGroundSpeed();
-         Units::Angle loaded_bank_value = hfp_reader.GetBankAngle();
+         horizontal_path_segment.m_turn_info.x_position_meters = Units::MetersLength(row.turn_center_x).value();
+         horizontal_path_segment.m_turn_info.y_position_meters = Units::MetersLength(row.turn_center_y).value();
+         horizontal_path_segment.m_turn_info.q_start = row.angle_start_of_turn;
+         horizontal_path_segment.m_turn_info.q_end = row.angle_end_of_turn;
+         horizontal_path_segment.m_turn_info.radius = row.turn_radius;
+         horizontal_path_segment.m_turn_info.groundspeed = row.ground_speed;
+         Units::Angle loaded_bank_value = row.bank_angle;
          if (loaded_bank_value == Units::zero()) loaded_bank_value = Units::DegreesAngle(15);
          horizontal_path_segment.m_turn_info.bankAngle = loaded_bank_value;
          horizontal_path_segment.m_turn_info.turn_type = HorizontalTurnPath::TURN_TYPE::PERFORMANCE;
@@ -301,30 +325,30 @@ std::vector<HorizontalPath> GuidanceDataLoader::BuildHorizontalPathUsingAllColum
 }
 
 std::vector<HorizontalPath> GuidanceDataLoader::BuildHorizontalPathComputeEuclideanComponents(
-      testvector::HfpReader2020 &hfp_reader, std::shared_ptr<TangentPlaneSequence> &tangent_plane_sequence) const {
+      const HfpTable &hfp_table, std::shared_ptr<TangentPlaneSequence> &tangent_plane_sequence) const {
    std::vector<HorizontalPath> horizontal_path_sequence;
-   while (hfp_reader.Advance()) {
+   for (const auto &row : hfp_table) {
       HorizontalPath horizontal_path_segment;
 
       EarthModel::GeodeticPosition lat_lon_position;
-      lat_lon_position.latitude = hfp_reader.GetLatitude();
-      lat_lon_position.longitude = hfp_reader.GetLongitude();
+      lat_lon_position.latitude = row.latitude;
+      lat_lon_position.longitude = row.longitude;
       EarthModel::LocalPositionEnu xy_position;
       tangent_plane_sequence->ConvertGeodeticToLocal(lat_lon_position, xy_position);
       horizontal_path_segment.SetXYPositionMeters(Units::MetersLength(xy_position.x).value(),
                                                   Units::MetersLength(xy_position.y).value());
-      horizontal_path_segment.m_segment_type = hfp_reader.GetSegmentType();
+      horizontal_path_segment.m_segment_type = row.segment_type;
 
       if (horizontal_path_segment.m_segment_type == HorizontalPath::SegmentType::TURN) {
-         lat_lon_position.latitude = hfp_reader.GetTurnCenterLatitude();
-         lat_lon_position.longitude = hfp_reader.GetTurnCenterLongitude();
+         lat_lon_position.latitude = row.turn_center_latitude;
+         lat_lon_position.longitude = row.turn_center_longitude;
          tangent_plane_sequence->ConvertGeodeticToLocal(lat_lon_position, xy_position);
 
          horizontal_path_segment.m_turn_info.x_position_meters = Units::MetersLength(xy_position.x).value();
          horizontal_path_segment.m_turn_info.y_position_meters = Units::MetersLength(xy_position.y).value();
-         horizontal_path_segment.m_turn_info.radius = hfp_reader.GetTurnRadius();
-         horizontal_path_segment.m_turn_info.groundspeed = hfp_reader.GetGroundSpeed();
-         Units::Angle loaded_bank_value = hfp_reader.GetBankAngle();
+         horizontal_path_segment.m_turn_info.radius = row.turn_radius;
+         horizontal_path_segment.m_turn_info.groundspeed = row.ground_speed;
+         Units::Angle loaded_bank_value = row.bank_angle;
          if (loaded_bank_value == Units::zero()) loaded_bank_value = Units::DegreesAngle(15);
          horizontal_path_segment.m_turn_info.bankAngle = loaded_bank_value;
          horizontal_path_segment.m_turn_info.turn_type = HorizontalTurnPath::TURN_TYPE::PERFORMANCE;
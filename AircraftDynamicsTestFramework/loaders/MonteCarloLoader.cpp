@@ -0,0 +1,91 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "framework/MonteCarloLoader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+using namespace fmacm;
+
+log4cplus::Logger MonteCarloLoader::m_logger = log4cplus::Logger::getInstance("MonteCarloLoader");
+
+const double MonteCarloLoader::STANDARD_DEVIATION_LIMIT = 3.0;
+
+bool MonteCarloLoader::load(DecodedStream *input) {
+   set_stream(input);
+   register_var("iterations", &m_iterations, true);
+   register_var("master_seed", &m_master_seed, false);
+   register_var("iteration_threads", &m_iteration_threads, false);
+   register_loadable_with_brackets("initial_mass_fraction", &m_mass_fraction, false);
+   register_loadable_with_brackets("wind_scale_factor", &m_wind_scale_factor, false);
+   register_loadable_with_brackets("pilot_delay", &m_pilot_delay, false);
+   m_loaded = complete();
+
+   if (m_iterations < 1) {
+      LOG4CPLUS_FATAL(m_logger, "monte_carlo iterations must be at least one, found " << m_iterations);
+      throw std::runtime_error("monte_carlo iterations must be at least one");
+   }
+   if (m_iteration_threads < 1) {
+      LOG4CPLUS_FATAL(m_logger, "monte_carlo iteration_threads must be at least one, found " << m_iteration_threads);
+      throw std::runtime_error("monte_carlo iteration_threads must be at least one");
+   }
+   return m_loaded;
+}
+
+PhiloxRandomGenerator MonteCarloLoader::IterationRandomStream(int iteration) const {
+   const PhiloxRandomGenerator master(static_cast<std::uint64_t>(m_master_seed));
+   return master.Split(static_cast<std::uint64_t>(iteration));
+}
+
+double MonteCarloLoader::SampleMassFraction(PhiloxRandomGenerator &random_generator,
+                                            double configured_mass_fraction) const {
+   if (!m_mass_fraction.IsLoaded()) return configured_mass_fraction;
+   return m_mass_fraction.Sample(random_generator, 0.0, 1.0);
+}
+
+double MonteCarloLoader::SampleWindScaleFactor(PhiloxRandomGenerator &random_generator) const {
+   if (!m_wind_scale_factor.IsLoaded()) return 1.0;
+   return m_wind_scale_factor.Sample(random_generator, 0.0, std::numeric_limits<double>::max());
+}
+
+bool MonteCarloLoader::NormalDistribution::load(DecodedStream *input) {
+   set_stream(input);
+   register_var("mean", &m_mean, true);
+   register_var("standard_deviation", &m_standard_deviation, false);
+   m_loaded = complete();
+   return m_loaded;
+}
+
+double MonteCarloLoader::NormalDistribution::Sample(PhiloxRandomGenerator &random_generator, double minimum,
+                                                    double maximum) const {
+   const double sample =
+         random_generator.TruncatedGaussianSample(m_mean, m_standard_deviation, STANDARD_DEVIATION_LIMIT);
+   return std::clamp(sample, minimum, maximum);
+}
+
+bool MonteCarloLoader::PilotDelayDistribution::load(DecodedStream *input) {
+   set_stream(input);
+   register_var("mean_seconds", &m_mean, true);
+   register_var("standard_deviation_seconds", &m_standard_deviation, false);
+   m_loaded = complete();
+   return m_loaded;
+}
@@ -19,7 +19,7 @@
 
 #include "framework/SpeedCommandsLoader.h"
 
-#include "MiniCSV/minicsv.h"
+#include "public/CsvFile.h"
 
 using namespace fmacm::loader;
 
@@ -32,35 +32,29 @@ bool SpeedCommandsLoader::load(DecodedStream *input) {
 
 SpeedCommandsFromStaticData SpeedCommandsLoader::Build(Units::Time pilot_delay_duration) const {
    if (m_loaded && !m_file_path.empty()) {
-      const auto speed_data = ReadStaticSpeedCommands(m_file_path);
-      return SpeedCommandsFromStaticData{speed_data, pilot_delay_duration};
+      const auto speed_data = m_input_tables->Get<std::vector<SpeedCommandsFromStaticData::SpeedRecord> >(
+            m_file_path, ReadStaticSpeedCommands);
+      if (!speed_data) {
+         std::string error_msg = "Speed file " + m_file_path + " not found.";
+         throw std::runtime_error(error_msg);
+      }
+      return SpeedCommandsFromStaticData{*speed_data, pilot_delay_duration};
    }
    return SpeedCommandsFromStaticData();
 }
 
-const std::vector<SpeedCommandsFromStaticData::SpeedRecord> SpeedCommandsLoader::ReadStaticSpeedCommands(
-      const std::string &filename) const {
-   std::ifstream file(filename.c_str());
-   if (!file.is_open()) {
-      std::string error_msg = "Speed file " + filename + " not found.";
-      throw std::runtime_error(error_msg);
-   }
-
+std::vector<SpeedCommandsFromStaticData::SpeedRecord> SpeedCommandsLoader::ReadStaticSpeedCommands(
+      const std::shared_ptr<const aaesim::open_source::CsvFile> &csv_file) {
    std::vector<SpeedCommandsFromStaticData::SpeedRecord> speed_data;
-   mini::csv::ifstream input_stream(filename);
-   input_stream.set_delimiter(',', ",");
-   if (input_stream.is_open()) {
-      input_stream.read_line();
-      while (input_stream.read_line()) {
-         double simtime_seconds, speed_command_mps;
-         input_stream >> simtime_seconds >> speed_command_mps;
-         SpeedCommandsFromStaticData::SpeedRecord speed_record;
-         speed_record.simtime = Units::SecondsTime(simtime_seconds);
-         speed_record.speed_command = Units::MetersPerSecondSpeed(speed_command_mps);
-         speed_data.push_back(speed_record);
-      }
+   aaesim::open_source::CsvCursor csv_row(csv_file);
+   csv_row.SkipLines(1);
+   // the data ends at the first blank line
+   while (csv_row.Advance() && csv_row.Size() > 0) {
+      SpeedCommandsFromStaticData::SpeedRecord speed_record;
+      speed_record.simtime = Units::SecondsTime(csv_row.GetDouble(0));
+      speed_record.speed_command = Units::MetersPerSecondSpeed(csv_row.GetDouble(1));
+      speed_data.push_back(speed_record);
    }
-   input_stream.close();
 
    return speed_data;
 }
@@ -19,9 +19,20 @@
 
 #include "framework/AircraftStateWriter.h"
 
+#include "framework/BinaryAircraftStateWriter.h"
+
 std::vector<std::string> fmacm::AircraftStateWriter::COLUMN_NAMES = {
       "Time[sec]", "V(ias)[m/s]", "V(tas)[m/s]", "vRate[m/s]",    "x[m]",
       "y[m]",      "h[m]",        "gs[mps]",     "latitude[deg]", "longitude[deg]"};
+const int fmacm::AircraftStateWriter::OUTPUT_PRECISION = 6;
+const std::string fmacm::AircraftStateWriter::ITERATION_COLUMN_NAME = "Iteration";
+
+std::unique_ptr<fmacm::AircraftStateWriter> fmacm::AircraftStateWriter::Create(OutputFormat output_format) {
+   if (output_format == OutputFormat::BINARY) {
+      return std::make_unique<BinaryAircraftStateWriter>();
+   }
+   return std::make_unique<AircraftStateWriter>();
+}
 
 void fmacm::AircraftStateWriter::Finish() {
    if (m_data_to_write.empty()) {
@@ -35,46 +46,78 @@ void fmacm::AircraftStateWriter::Finish() {
       return;
    }
 
-   os.set_delimiter(',', ",");
-
-   auto column_inserter = [&os](std::string &column_name) { os << column_name; };
-   std::for_each(COLUMN_NAMES.begin(), COLUMN_NAMES.end(), column_inserter);
-   os << NEWLINE;
-
-   os.set_precision(6);
-   auto data_inserter = [&os](const DataToWrite &data_row) {
-      os << Units::SecondsTime(data_row.simulation_time).value();
-      os << Units::MetersPerSecondSpeed(data_row.dynamics_ias).value();
-      os << Units::MetersPerSecondSpeed(data_row.dynamics_tas).value();
-      os << Units::MetersPerSecondSpeed(data_row.dynamics_altitude_rate).value();
-      os << Units::MetersLength(data_row.euclidean_x).value();
-      os << Units::MetersLength(data_row.euclidean_y).value();
-      os << Units::MetersLength(data_row.altitude_msl).value();
-      os << Units::MetersPerSecondSpeed(data_row.dynamics_ground_speed).value();
-      os << data_row.latitude.value();
-      os << data_row.longitude.value();
-      os << NEWLINE;
-   };
+   WriteColumnNames(os, m_with_iteration);
+   auto data_inserter = [&os, this](const DataToWrite &data_row) { WriteRow(os, data_row, m_with_iteration); };
    std::for_each(m_data_to_write.cbegin(), m_data_to_write.cend(), data_inserter);
 
    os.close();
    m_data_to_write.clear();
 }
 
-void fmacm::AircraftStateWriter::Gather(std::vector<aaesim::open_source::AircraftState> aircraft_states) {
+void fmacm::AircraftStateWriter::Gather(const std::vector<aaesim::open_source::AircraftState> &aircraft_states) {
    auto data_gatherer = [this](const aaesim::open_source::AircraftState &state) {
-      DataToWrite data;
-      data.altitude_msl = state.GetAltitudeMsl();
-      data.dynamics_altitude_rate = state.GetVerticalSpeed();
-      data.dynamics_ground_speed = state.GetGroundSpeed();
-      data.dynamics_ias = state.GetDynamicsState().v_indicated_airspeed;
-      data.dynamics_tas = state.GetDynamicsState().v_true_airspeed;
-      data.euclidean_x = state.GetPositionEnuX();
-      data.euclidean_y = state.GetPositionEnuY();
-      data.simulation_time = state.GetTime();
-      data.latitude = state.GetLatitude();
-      data.longitude = state.GetLongitude();
+      this->m_data_to_write.push_back(ExtractDataToWrite(state));
+   };
+   std::for_each(aircraft_states.cbegin(), aircraft_states.cend(), data_gatherer);
+}
+
+void fmacm::AircraftStateWriter::Gather(const std::vector<aaesim::open_source::AircraftState> &aircraft_states,
+                                        int iteration) {
+   m_with_iteration = true;
+   auto data_gatherer = [this, iteration](const aaesim::open_source::AircraftState &state) {
+      DataToWrite data = ExtractDataToWrite(state);
+      data.iteration = iteration;
       this->m_data_to_write.push_back(data);
    };
    std::for_each(aircraft_states.cbegin(), aircraft_states.cend(), data_gatherer);
 }
+
+fmacm::AircraftStateWriter::DataToWrite fmacm::AircraftStateWriter::ExtractDataToWrite(
+      const aaesim::open_source::AircraftState &state) {
+   DataToWrite data;
+   data.altitude_msl = state.GetAltitudeMsl();
+   data.dynamics_altitude_rate = state.GetVerticalSpeed();
+   data.dynamics_ground_speed = state.GetGroundSpeed();
+   data.dynamics_ias = state.GetDynamicsState().v_indicated_airspeed;
+   data.dynamics_tas = state.GetDynamicsState().v_true_airspeed;
+   data.euclidean_x = state.GetPositionEnuX();
+   data.euclidean_y = state.GetPositionEnuY();
+   data.simulation_time = state.GetTime();
+   data.latitude = state.GetLatitude();
+   data.longitude = state.GetLongitude();
+   return data;
+}
+
+void fmacm::AircraftStateWriter::WriteColumnNames(mini::csv::ofstream &os, bool with_iteration) {
+   os.set_delimiter(',', ",");
+   if (with_iteration) {
+      os << ITERATION_COLUMN_NAME;
+   }
+   std::for_each(COLUMN_NAMES.cbegin(), COLUMN_NAMES.cend(),
+                 [&os](const std::string &column_name) { os << column_name; });
+   os << NEWLINE;
+   os.set_precision(OUTPUT_PRECISION);
+}
+
+void fmacm::AircraftStateWriter::WriteRow(mini::csv::ofstream &os, const DataToWrite &data_row, bool with_iteration) {
+   if (with_iteration) {
+      os << data_row.iteration;
+   }
+   const auto column_values = ColumnValues(data_row);
+   std::for_each(column_values.cbegin(), column_values.cend(), [&os](double value) { os << value; });
+   os << NEWLINE;
+}
+
+std::array<double, fmacm::AircraftStateWriter::COLUMN_COUNT> fmacm::AircraftStateWriter::ColumnValues(
+      const DataToWrite &data_row) {
+   return {Units::SecondsTime(data_row.simulation_time).value(),
+           Units::MetersPerSecondSpeed(data_row.dynamics_ias).value(),
+           Units::MetersPerSecondSpeed(data_row.dynamics_tas).value(),
+           Units::MetersPerSecondSpeed(data_row.dynamics_altitude_rate).value(),
+           Units::MetersLength(data_row.euclidean_x).value(),
+           Units::MetersLength(data_row.euclidean_y).value(),
+           Units::MetersLength(data_row.altitude_msl).value(),
+           Units::MetersPerSecondSpeed(data_row.dynamics_ground_speed).value(),
+           data_row.latitude.value(),
+           data_row.longitude.value()};
+}
@@ -0,0 +1,85 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "framework/BinaryAircraftStateWriter.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "framework/BinaryAircraftStateFormat.h"
+
+using namespace fmacm::binary_aircraft_state_format;
+
+void fmacm::BinaryAircraftStateWriter::Finish() {
+   m_finished = true;
+   if (m_data_to_write.empty()) {
+      return;
+   }
+
+   std::ofstream os(filename, std::ios_base::out | std::ios_base::binary);
+   if (!os.is_open()) {
+      std::string emsg = "Cannot open " + filename;
+      throw std::runtime_error(emsg);
+   }
+
+   std::vector<std::string> column_names;
+   if (m_with_iteration) {
+      column_names.push_back(ITERATION_COLUMN_NAME);
+   }
+   column_names.insert(column_names.end(), GetColumnNames().cbegin(), GetColumnNames().cend());
+   std::string header(FIXED_HEADER_SIZE, '\0');
+   for (const auto &column_name : column_names) {
+      char name_length[sizeof(std::uint32_t)];
+      EncodeLittleEndian(static_cast<std::uint32_t>(column_name.size()), name_length);
+      header.append(name_length, sizeof(name_length));
+      header.append(column_name);
+   }
+   header.resize((header.size() + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT, '\0');
+
+   const std::uint64_t row_count = m_data_to_write.size();
+   header.replace(0, MAGIC.size(), MAGIC);
+   EncodeLittleEndian(FORMAT_VERSION, &header[8]);
+   EncodeLittleEndian(static_cast<std::uint32_t>(column_names.size()), &header[12]);
+   EncodeLittleEndian(row_count, &header[16]);
+   EncodeLittleEndian(static_cast<std::uint64_t>(header.size()), &header[24]);
+   os.write(header.data(), header.size());
+
+   // transpose to columns once, then write each column as one block
+   std::vector<char> column_bytes(row_count * sizeof(double));
+   if (m_with_iteration) {
+      for (std::size_t row = 0; row < row_count; ++row) {
+         EncodeLittleEndian(static_cast<double>(m_data_to_write[row].iteration), &column_bytes[row * sizeof(double)]);
+      }
+      os.write(column_bytes.data(), column_bytes.size());
+   }
+   std::vector<std::array<double, COLUMN_COUNT>> rows;
+   rows.reserve(row_count);
+   std::transform(m_data_to_write.cbegin(), m_data_to_write.cend(), std::back_inserter(rows), ColumnValues);
+   for (std::size_t column = 0; column < COLUMN_COUNT; ++column) {
+      for (std::size_t row = 0; row < row_count; ++row) {
+         EncodeLittleEndian(rows[row][column], &column_bytes[row * sizeof(double)]);
+      }
+      os.write(column_bytes.data(), column_bytes.size());
+   }
+
+   os.close();
+   m_data_to_write.clear();
+}
@@ -0,0 +1,59 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "framework/MonteCarloSummaryWriter.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "framework/AircraftStateWriter.h"
+
+const std::vector<std::string> fmacm::MonteCarloSummaryWriter::COLUMN_NAMES = {
+      "iteration",          "aircraft",           "initial_mass_fraction", "wind_scale_factor",
+      "pilot_delay_mean[sec]", "pilot_delay_std[sec]", "state_count",          "final_time[sec]"};
+
+void fmacm::MonteCarloSummaryWriter::Finish() {
+   if (m_data_to_write.empty()) {
+      return;
+   }
+
+   mini::csv::ofstream os(filename.c_str());
+
+   if (!os.is_open()) {
+      std::string emsg = "Cannot open " + filename;
+      throw std::runtime_error(emsg);
+   }
+
+   os.set_delimiter(',', ",");
+   std::for_each(COLUMN_NAMES.cbegin(), COLUMN_NAMES.cend(),
+                 [&os](const std::string &column_name) { os << column_name; });
+   os << NEWLINE;
+   os.set_precision(AircraftStateWriter::OUTPUT_PRECISION);
+
+   for (const auto &summary : m_data_to_write) {
+      os << summary.iteration << summary.aircraft_index << summary.initial_mass_fraction << summary.wind_scale_factor
+         << summary.pilot_delay_mean.value() << summary.pilot_delay_standard_deviation.value() << summary.state_count
+         << summary.final_time.value();
+      os << NEWLINE;
+   }
+
+   os.close();
+   m_data_to_write.clear();
+   m_finished = true;
+}
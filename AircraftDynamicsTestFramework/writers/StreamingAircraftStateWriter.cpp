@@ -0,0 +1,124 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "framework/StreamingAircraftStateWriter.h"
+
+#include <cstdio>
+#include <fstream>
+
+const std::size_t fmacm::StreamingAircraftStateWriter::DEFAULT_ROWS_PER_BATCH = 256;
+
+fmacm::StreamingAircraftStateWriter::StreamingAircraftStateWriter(std::size_t number_of_aircraft,
+                                                                   std::size_t rows_per_batch)
+   : OutputHandler("", "_AcStates.csv"), m_rows_per_batch(std::max<std::size_t>(rows_per_batch, 1)), m_sinks() {
+   m_sinks.resize(number_of_aircraft);
+}
+
+fmacm::StreamingAircraftStateWriter::~StreamingAircraftStateWriter() {
+   if (m_finished) {
+      return;
+   }
+   try {
+      Finish();
+   } catch (...) {
+      // nothing more can be saved; don't let the destructor throw while a scenario failure is unwinding
+   }
+}
+
+void fmacm::StreamingAircraftStateWriter::SetScenarioName(const std::string &scenario_name) {
+   OutputHandler::SetScenarioName(scenario_name);
+   for (std::size_t i = 0; i < m_sinks.size(); ++i) {
+      m_sinks[i].part_filename = filename + "." + std::to_string(i) + ".part";
+   }
+}
+
+void fmacm::StreamingAircraftStateWriter::Append(std::size_t aircraft_index,
+                                                 const aaesim::open_source::AircraftState &state) {
+   AircraftSink &sink = m_sinks.at(aircraft_index);
+   sink.pending_rows.push_back(AircraftStateWriter::ExtractDataToWrite(state));
+   if (sink.pending_rows.size() >= m_rows_per_batch) {
+      WritePendingRows(sink);
+   }
+}
+
+void fmacm::StreamingAircraftStateWriter::Flush() {
+   std::for_each(m_sinks.begin(), m_sinks.end(), [this](AircraftSink &sink) {
+      WritePendingRows(sink);
+      if (sink.part_stream) {
+         sink.part_stream->flush();
+      }
+   });
+}
+
+void fmacm::StreamingAircraftStateWriter::WritePendingRows(AircraftSink &sink) {
+   if (sink.pending_rows.empty()) {
+      return;
+   }
+   if (!sink.part_stream) {
+      sink.part_stream = std::make_unique<mini::csv::ofstream>(sink.part_filename.c_str());
+      if (!sink.part_stream->is_open()) {
+         throw std::runtime_error("Cannot open " + sink.part_filename);
+      }
+      sink.part_stream->set_delimiter(',', ",");
+      sink.part_stream->set_precision(AircraftStateWriter::OUTPUT_PRECISION);
+   }
+   std::for_each(sink.pending_rows.cbegin(), sink.pending_rows.cend(),
+                 [&sink](const AircraftStateWriter::DataToWrite &data_row) {
+                    AircraftStateWriter::WriteRow(*sink.part_stream, data_row);
+                 });
+   sink.pending_rows.clear();
+}
+
+void fmacm::StreamingAircraftStateWriter::Finish() {
+   m_finished = true;
+   Flush();
+   std::for_each(m_sinks.begin(), m_sinks.end(), [](AircraftSink &sink) {
+      if (sink.part_stream) {
+         sink.part_stream->close();
+      }
+   });
+
+   const bool has_data = std::any_of(m_sinks.cbegin(), m_sinks.cend(),
+                                     [](const AircraftSink &sink) { return sink.part_stream != nullptr; });
+   if (has_data) {
+      mini::csv::ofstream header_stream(filename.c_str());
+      if (!header_stream.is_open()) {
+         throw std::runtime_error("Cannot open " + filename);
+      }
+      AircraftStateWriter::WriteColumnNames(header_stream);
+      header_stream.close();
+
+      std::ofstream assembled(filename, std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+      std::for_each(m_sinks.cbegin(), m_sinks.cend(), [&assembled](const AircraftSink &sink) {
+         if (sink.part_stream) {
+            std::ifstream part(sink.part_filename, std::ios_base::in | std::ios_base::binary);
+            if (part.peek() != std::ifstream::traits_type::eof()) {
+               assembled << part.rdbuf();
+            }
+         }
+      });
+   }
+
+   std::for_each(m_sinks.begin(), m_sinks.end(), [](AircraftSink &sink) {
+      if (sink.part_stream) {
+         std::remove(sink.part_filename.c_str());
+         sink.part_stream.reset();
+      }
+   });
+}
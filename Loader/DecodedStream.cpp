@@ -19,11 +19,15 @@
 
 #include "loader/DecodedStream.h"
 
+#include <filesystem>
 #include <limits>
 
+#include "loader/ParsedScenarioCache.h"
+
 using namespace std;
 
-DecodedStream::DecodedStream(void) {}
+DecodedStream::DecodedStream(void)
+   : root_file_name(), replay_tokens(), replay_index(0), replay_last(), replay_pushed(false) {}
 
 //----------------------------------------------------------------------------------
 
@@ -31,7 +35,75 @@ DecodedStream::~DecodedStream(void) {}
 
 //----------------------------------------------------------------------------------
 
-bool find_num(string temp, int j) {
+bool DecodedStream::open_file(const std::string &file_name) {
+   root_file_name = file_name;
+   return SinglePushBackStream::open_file(file_name);
+}
+
+//----------------------------------------------------------------------------------
+
+bool DecodedStream::use_parse_cache(const std::string &cache_file_name) {
+   ParsedScenarioCache::Contents contents;
+   const bool from_cache = ParsedScenarioCache::Read(cache_file_name, contents);
+   if (!from_cache) {
+      auto opened_files = std::make_shared<std::vector<std::string> >();
+      set_Opened_File_Log(opened_files);
+      for (Token token = SinglePushBackStream::get_next(); !token.get_Data().empty();
+           token = SinglePushBackStream::get_next()) {
+         contents.tokens.push_back(token.get_Data());
+      }
+      set_Opened_File_Log(nullptr);
+
+      // a cache is only written for a complete resolution of readable files
+      bool cacheable = ok();
+      opened_files->insert(opened_files->begin(), root_file_name);
+      for (const auto &file_name : *opened_files) {
+         const auto content_hash = ParsedScenarioCache::HashFile(file_name);
+         cacheable = cacheable && content_hash.has_value();
+         if (!cacheable) break;
+         contents.source_files.push_back({std::filesystem::absolute(file_name).string(), *content_hash});
+      }
+      if (cacheable) {
+         ParsedScenarioCache::Write(cache_file_name, contents);
+      }
+   }
+
+   replay_tokens = std::make_shared<const std::vector<std::string> >(std::move(contents.tokens));
+   replay_index = 0;
+   replay_pushed = false;
+   return from_cache;
+}
+
+//----------------------------------------------------------------------------------
+
+Token DecodedStream::get_next() {
+   if (!replay_tokens) {
+      return SinglePushBackStream::get_next();
+   }
+   if (replay_pushed) {
+      replay_pushed = false;
+      return replay_last;
+   }
+   replay_last = Token();
+   if (replay_index < replay_tokens->size()) {
+      replay_last.set_data((*replay_tokens)[replay_index++]);
+   }
+   return replay_last;
+}
+
+//----------------------------------------------------------------------------------
+
+void DecodedStream::push_back() {
+   if (replay_tokens) {
+      replay_pushed = true;
+   } else {
+      SinglePushBackStream::push_back();
+   }
+}
+
+//----------------------------------------------------------------------------------
+
+bool find_num(const string &temp, int j) {
    if (!(('0' <= temp[0] && temp[0] <= '9') || temp[0] == '-')) {
       return false;
    }
@@ -84,20 +156,22 @@ bool DecodedStream::get_datum(short &s) {
       return false;
    }
 
-   if (atoi(temp.c_str()) == big)  // too big to be short
+   const int parsed_value = atoi(temp.c_str());
+
+   if (parsed_value == big)  // too big to be short
    {
       return false;
    }
-   if (atoi(temp.c_str()) == small)  // too small to be short
+   if (parsed_value == small)  // too small to be short
    {
       return false;
    }
    if (temp != "0") {
-      if (atoi(temp.c_str()) == 0) {
+      if (parsed_value == 0) {
          return false;
       }
    }
-   s = atoi(temp.c_str());
+   s = parsed_value;
 
    return true;
 }
@@ -123,20 +197,22 @@ bool DecodedStream::get_datum(unsigned short &s) {
       return false;
    }
 
-   if (atoi(temp.c_str()) == big)  // too big to be unsigned short
+   const int parsed_value = atoi(temp.c_str());
+
+   if (parsed_value == big)  // too big to be unsigned short
    {
       return false;
    }
-   if (atoi(temp.c_str()) == small)  // too small to be unsigned short
+   if (parsed_value == small)  // too small to be unsigned short
    {
       return false;
    }
    if (temp != "0") {
-      if (atoi(temp.c_str()) == 0) {
+      if (parsed_value == 0) {
          return false;
       }
    }
-   s = atoi(temp.c_str());
+   s = parsed_value;
 
    return true;
 }
@@ -162,20 +238,22 @@ bool DecodedStream::get_datum(int &s) {
       return false;
    }
 
-   if (atoi(temp.c_str()) == big)  // too big to be int
+   const int parsed_value = atoi(temp.c_str());
+
+   if (parsed_value == big)  // too big to be int
    {
       return false;
    }
-   if (atoi(temp.c_str()) == small)  // too small to be int
+   if (parsed_value == small)  // too small to be int
    {
       return false;
    }
    if (temp != "0") {
-      if (atoi(temp.c_str()) == 0) {
+      if (parsed_value == 0) {
          return false;
       }
    }
-   s = atoi(temp.c_str());
+   s = parsed_value;
 
    return true;
 }
@@ -201,20 +279,22 @@ bool DecodedStream::get_datum(unsigned int &s) {
       return false;
    }
 
-   if (atoi(temp.c_str()) == big)  // too big to be unsigned int
+   const int parsed_value = atoi(temp.c_str());
+
+   if (parsed_value == big)  // too big to be unsigned int
    {
       return false;
    }
-   if (atoi(temp.c_str()) == small)  // too small to be unsigned int
+   if (parsed_value == small)  // too small to be unsigned int
    {
       return false;
    }
    if (temp != "0") {
-      if (atoi(temp.c_str()) == 0) {
+      if (parsed_value == 0) {
          return false;
       }
    }
-   s = atoi(temp.c_str());
+   s = parsed_value;
 
    return true;
 }
@@ -323,20 +403,22 @@ bool DecodedStream::get_datum(float &s) {
       return false;
    }
 
-   if (atoi(temp.c_str()) == big)  // too big to be int
+   const int parsed_value = atoi(temp.c_str());
+
+   if (parsed_value == big)  // too big to be int
    {
       return false;
    }
-   if (atoi(temp.c_str()) == small)  // too small to be int
+   if (parsed_value == small)  // too small to be int
    {
       return false;
    }
    if (temp != "0") {
-      if (atoi(temp.c_str()) == 0) {
+      if (parsed_value == 0) {
          return false;
       }
    }
-   s = atoi(temp.c_str());
+   s = parsed_value;
 
    return true;
 }
@@ -0,0 +1,161 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "loader/ParsedScenarioCache.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+const char ParsedScenarioCache::MAGIC[8] = {'F', 'M', 'A', 'C', 'M', 'T', 'O', 'K'};
+const std::uint32_t ParsedScenarioCache::FORMAT_VERSION = 1;
+
+namespace {
+// FNV-1a
+std::uint64_t Hash(const char *data, std::size_t size) {
+   std::uint64_t hash = 0xcbf29ce484222325ULL;
+   for (std::size_t i = 0; i < size; ++i) {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 0x100000001b3ULL;
+   }
+   return hash;
+}
+
+template <typename T>
+void WriteValue(std::ostream &os, T value) {
+   os.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void WriteString(std::ostream &os, const std::string &s) {
+   WriteValue(os, static_cast<std::uint32_t>(s.size()));
+   os.write(s.data(), s.size());
+}
+
+template <typename T>
+bool ReadValue(std::istream &is, T &value) {
+   return static_cast<bool>(is.read(reinterpret_cast<char *>(&value), sizeof(value)));
+}
+
+bool ReadString(std::istream &is, std::string &s) {
+   std::uint32_t size;
+   if (!ReadValue(is, size)) return false;
+   s.resize(size);
+   return static_cast<bool>(is.read(s.data(), size));
+}
+}  // namespace
+
+std::string ParsedScenarioCache::CacheFileName(const std::string &cache_directory,
+                                               const std::string &scenario_file_name) {
+   const std::string absolute_path = std::filesystem::absolute(scenario_file_name).lexically_normal().string();
+   std::ostringstream name;
+   name << std::filesystem::path(scenario_file_name).stem().string() << "-" << std::hex
+        << Hash(absolute_path.data(), absolute_path.size()) << ".fmacmtok";
+   return (std::filesystem::path(cache_directory) / name.str()).string();
+}
+
+std::optional<std::uint64_t> ParsedScenarioCache::HashFile(const std::string &file_name) {
+   std::ifstream file(file_name, std::ios::binary);
+   if (!file.is_open()) {
+      return std::nullopt;
+   }
+   const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+   return Hash(contents.data(), contents.size());
+}
+
+bool ParsedScenarioCache::Read(const std::string &cache_file_name, Contents &contents) {
+   std::ifstream is(cache_file_name, std::ios::binary);
+   if (!is.is_open()) {
+      return false;
+   }
+
+   char magic[sizeof(MAGIC)];
+   std::uint32_t format_version;
+   if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+       !ReadValue(is, format_version) || format_version != FORMAT_VERSION) {
+      return false;
+   }
+
+   // every entry takes at least four bytes, which bounds the counts of a damaged file
+   std::error_code error;
+   const std::uintmax_t file_size = std::filesystem::file_size(cache_file_name, error);
+   if (error) return false;
+
+   Contents read_contents;
+   std::uint64_t source_file_count;
+   if (!ReadValue(is, source_file_count) || source_file_count > file_size) return false;
+   read_contents.source_files.resize(source_file_count);
+   for (auto &source_file : read_contents.source_files) {
+      if (!ReadString(is, source_file.path) || !ReadValue(is, source_file.content_hash)) return false;
+      if (HashFile(source_file.path) != source_file.content_hash) return false;
+   }
+
+   std::uint64_t token_count;
+   if (!ReadValue(is, token_count) || token_count > file_size) return false;
+   read_contents.tokens.resize(token_count);
+   for (auto &token : read_contents.tokens) {
+      if (!ReadString(is, token)) return false;
+   }
+
+   contents = std::move(read_contents);
+   return true;
+}
+
+bool ParsedScenarioCache::Write(const std::string &cache_file_name, const Contents &contents) {
+   // unique to this process and thread, so concurrent writers of one entry never share a temporary file
+   std::ostringstream temporary_suffix;
+   temporary_suffix << ".tmp" << getpid() << "." << std::this_thread::get_id();
+   const std::string temporary_file_name = cache_file_name + temporary_suffix.str();
+   std::error_code error;
+   const auto cache_directory = std::filesystem::path(cache_file_name).parent_path();
+   if (!cache_directory.empty()) {
+      std::filesystem::create_directories(cache_directory, error);
+   }
+   {
+      std::ofstream os(temporary_file_name, std::ios::binary | std::ios::trunc);
+      if (!os.is_open()) {
+         return false;
+      }
+      os.write(MAGIC, sizeof(MAGIC));
+      WriteValue(os, FORMAT_VERSION);
+      WriteValue(os, static_cast<std::uint64_t>(contents.source_files.size()));
+      for (const auto &source_file : contents.source_files) {
+         WriteString(os, source_file.path);
+         WriteValue(os, source_file.content_hash);
+      }
+      WriteValue(os, static_cast<std::uint64_t>(contents.tokens.size()));
+      for (const auto &token : contents.tokens) {
+         WriteString(os, token);
+      }
+      if (!os) {
+         os.close();
+         std::filesystem::remove(temporary_file_name, error);
+         return false;
+      }
+   }
+   std::filesystem::rename(temporary_file_name, cache_file_name, error);
+   if (error) {
+      std::filesystem::remove(temporary_file_name, error);
+      return false;
+   }
+   return true;
+}
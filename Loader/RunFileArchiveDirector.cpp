@@ -23,16 +23,11 @@
 
 using namespace std;
 
-RunFileArchiveDirector::RunFileArchiveDirector(void) {}
+RunFileArchiveDirector::RunFileArchiveDirector(void) : destination(), mapper(), next_link_index(1) {}
 
 RunFileArchiveDirector::~RunFileArchiveDirector(void) {}
 
 string RunFileArchiveDirector::get_New_Link_Name(const FilePath &source_file) {
-   static int i = 1;
-
-   stringstream ss;
-   ss << i;
-
    string out;
    bool not_in_while = false;
    ;
@@ -58,12 +53,14 @@ string RunFileArchiveDirector::get_New_Link_Name(const FilePath &source_file) {
          }
          break;
       } else {
+         stringstream ss;
+         ss << next_link_index;
          if (extension == "") {
             out = file + "_" + ss.str();
          } else {
             out = file + "_" + ss.str() + "." + extension;
          }
-         i++;
+         next_link_index++;
       }
    }
    return out;
@@ -22,6 +22,7 @@
 #include <public/CoreUtils.h>
 #include <public/PositionCalculator.h>
 
+#include <algorithm>
 #include <stdexcept>
 
 using namespace std;
@@ -54,6 +55,12 @@ void AircraftCalculations::LegacyGetPathLengthFromPosition(const Units::Length x
                                           ignored_trajectory_index);
 }
 
+Units::Length AircraftCalculations::DistanceToNode(const Units::Length x, const Units::Length y,
+                                                   const HorizontalPath &node) {
+   return sqrt(Units::sqr(x - Units::MetersLength(node.GetXPositionMeters())) +
+               Units::sqr(y - Units::MetersLength(node.GetYPositionMeters())));
+}
+
 vector<AircraftCalculations::PathDistance> AircraftCalculations::ComputePathDistances(
       const Units::Length x, const Units::Length y, const std::vector<HorizontalPath>::size_type &starting_index,
       const vector<HorizontalPath> &hTraj) {
@@ -65,8 +72,7 @@ vector<AircraftCalculations::PathDistance> AircraftCalculations::ComputePathDist
    for (auto i = starting_index; i < hTraj.size(); ++i) {
       PathDistance pd;
 
-      Units::MetersLength d = sqrt(Units::sqr(x - Units::MetersLength(hTraj[i].GetXPositionMeters())) +
-                                   Units::sqr(y - Units::MetersLength(hTraj[i].GetYPositionMeters())));
+      Units::MetersLength d = DistanceToNode(x, y, hTraj[i]);
       pd.m_distance_to_path_node = d;
       pd.m_horizontal_path_index = i;
 
@@ -359,6 +365,86 @@ bool AircraftCalculations::CalculateDistanceAlongPathFromPosition(
       const std::vector<HorizontalPath> &horizontal_trajectory,
       const std::vector<HorizontalPath>::size_type starting_trajectory_index, Units::Length &distance_along_path,
       Units::Angle &course, std::vector<HorizontalPath>::size_type &resolved_trajectory_index) {
+   return CalculateDistanceAlongPathFromPosition(cross_track_tolerance, position_x, position_y, horizontal_trajectory,
+                                                 nullptr, starting_trajectory_index, distance_along_path, course,
+                                                 resolved_trajectory_index);
+}
+
+bool AircraftCalculations::CalculateDistanceAlongPathFromPosition(
+      const Units::Length cross_track_tolerance, const Units::Length position_x, const Units::Length position_y,
+      const std::vector<HorizontalPath> &horizontal_trajectory, const HorizontalPathNodeIndex &node_index,
+      const std::vector<HorizontalPath>::size_type starting_trajectory_index, Units::Length &distance_along_path,
+      Units::Angle &course, std::vector<HorizontalPath>::size_type &resolved_trajectory_index) {
+   return CalculateDistanceAlongPathFromPosition(cross_track_tolerance, position_x, position_y, horizontal_trajectory,
+                                                 &node_index, starting_trajectory_index, distance_along_path, course,
+                                                 resolved_trajectory_index);
+}
+
+bool AircraftCalculations::FindNextTrajectoryIndexNearStart(
+      const Units::Length cross_track_tolerance, const Units::Length position_x, const Units::Length position_y,
+      const std::vector<HorizontalPath> &horizontal_trajectory, const HorizontalPathNodeIndex &node_index,
+      const std::vector<HorizontalPath>::size_type first_index, int &next_trajectory_index) {
+   // The exhaustive search picks the closest node, ties going to the lower index, whose cross track error is
+   // acceptable. Find any acceptable node near the start, then only nodes at least as close as that one can
+   // change the answer. Any failure here returns false and the caller falls back to the exhaustive search.
+   if (node_index.IsEmpty() || !std::isfinite(Units::MetersLength(position_x).value()) ||
+       !std::isfinite(Units::MetersLength(position_y).value())) {
+      return false;
+   }
+
+   Units::Length search_radius = Units::Infinity();
+   bool is_local_node_found = false;
+   const auto local_end = std::min(first_index + LOCAL_SEARCH_NODE_COUNT, horizontal_trajectory.size());
+   for (auto i = first_index; i < local_end; ++i) {
+      int computed_next_index;
+      Units::Length cte;
+      CrossTrackError(position_x, position_y, i, horizontal_trajectory, computed_next_index, cte);
+      const Units::Length d = DistanceToNode(position_x, position_y, horizontal_trajectory[i]);
+      if (cte <= cross_track_tolerance && d < search_radius) {
+         search_radius = d;
+         is_local_node_found = true;
+      }
+   }
+   if (!is_local_node_found) {
+      return false;
+   }
+
+   std::vector<std::vector<HorizontalPath>::size_type> nearby_nodes;
+   node_index.FindNodesNear(position_x, position_y, search_radius, first_index, nearby_nodes);
+
+   std::vector<PathDistance> candidates;
+   candidates.reserve(nearby_nodes.size());
+   for (auto node : nearby_nodes) {
+      const Units::Length d = DistanceToNode(position_x, position_y, horizontal_trajectory[node]);
+      if (d <= search_radius) {
+         candidates.push_back({node, d});
+      }
+   }
+   std::sort(candidates.begin(), candidates.end(), [](const PathDistance &lhs, const PathDistance &rhs) {
+      if (lhs.m_distance_to_path_node != rhs.m_distance_to_path_node) {
+         return lhs.m_distance_to_path_node < rhs.m_distance_to_path_node;
+      }
+      return lhs.m_horizontal_path_index < rhs.m_horizontal_path_index;
+   });
+
+   for (const auto &candidate : candidates) {
+      int computed_next_index;
+      Units::Length cte;
+      CrossTrackError(position_x, position_y, candidate.m_horizontal_path_index, horizontal_trajectory,
+                      computed_next_index, cte);
+      if (cte <= cross_track_tolerance) {
+         next_trajectory_index = computed_next_index;
+         return true;
+      }
+   }
+   return false;
+}
+
+bool AircraftCalculations::CalculateDistanceAlongPathFromPosition(
+      const Units::Length cross_track_tolerance, const Units::Length position_x, const Units::Length position_y,
+      const std::vector<HorizontalPath> &horizontal_trajectory, const HorizontalPathNodeIndex *node_index,
+      const std::vector<HorizontalPath>::size_type starting_trajectory_index, Units::Length &distance_along_path,
+      Units::Angle &course, std::vector<HorizontalPath>::size_type &resolved_trajectory_index) {
    LOG4CPLUS_TRACE(logger,
                    "Calculating distance from ("
                          << Units::MetersLength(position_x) << "," << Units::MetersLength(position_y)
@@ -372,23 +458,27 @@ bool AircraftCalculations::CalculateDistanceAlongPathFromPosition(
    distance_along_path = Units::NegInfinity();
    course = Units::RadiansAngle(Units::infinity());
 
-   // Compute Euclidean distances for all horizontal trajectory points
-   // and order in ascending sequence.
-   vector<PathDistance> distances = AircraftCalculations::ComputePathDistances(
-         position_x, position_y,
-         starting_trajectory_index < 1 ? starting_trajectory_index : starting_trajectory_index - 1,
-         horizontal_trajectory);
-
-   // Find smallest distance with an acceptable cross track error.
+   const auto first_index = starting_trajectory_index < 1 ? starting_trajectory_index : starting_trajectory_index - 1;
    int nextTrajIx = -1;
    Units::NauticalMilesLength cte;
-   for (auto i = 0; ((i < distances.size()) && (nextTrajIx == -1)); ++i) {
-      int computedNextIx;
-      AircraftCalculations::CrossTrackError(position_x, position_y, distances[i].m_horizontal_path_index,
-                                            horizontal_trajectory, computedNextIx, cte);
-
-      if (cte <= cross_track_tolerance) {
-         nextTrajIx = computedNextIx;
+   if (node_index == nullptr || !FindNextTrajectoryIndexNearStart(cross_track_tolerance, position_x, position_y,
+                                                                  horizontal_trajectory, *node_index, first_index,
+                                                                  nextTrajIx)) {
+      // Compute Euclidean distances for all horizontal trajectory points
+      // and order in ascending sequence.
+      vector<PathDistance> distances =
+            AircraftCalculations::ComputePathDistances(position_x, position_y, first_index, horizontal_trajectory);
+
+      // Find smallest distance with an acceptable cross track error.
+      nextTrajIx = -1;
+      for (auto i = 0; ((i < distances.size()) && (nextTrajIx == -1)); ++i) {
+         int computedNextIx;
+         AircraftCalculations::CrossTrackError(position_x, position_y, distances[i].m_horizontal_path_index,
+                                               horizontal_trajectory, computedNextIx, cte);
+
+         if (cte <= cross_track_tolerance) {
+            nextTrajIx = computedNextIx;
+         }
       }
    }
 
@@ -23,6 +23,7 @@
 #include <cmath>
 
 #include "public/CustomMath.h"
+#include "public/DeferredGeodeticPosition.h"
 
 using namespace aaesim::open_source;
 
@@ -31,6 +32,32 @@ Units::UnsignedRadiansAngle AircraftState::GetHeadingCcwFromEastRadians() const
    return Units::UnsignedRadiansAngle(result);
 }
 
+Units::SignedAngle AircraftState::GetLatitude() const {
+   return m_deferred_position ? m_deferred_position->GetPosition().latitude : m_latitude;
+}
+
+Units::SignedAngle AircraftState::GetLongitude() const {
+   return m_deferred_position ? m_deferred_position->GetPosition().longitude : m_longitude;
+}
+
+Units::AngularSpeed AircraftState::GetLatitudeRate() const {
+   return m_deferred_position ? m_deferred_position->GetPositionRate().latitude_time_derivative : m_latitude_rate;
+}
+
+Units::AngularSpeed AircraftState::GetLongitudeRate() const {
+   return m_deferred_position ? m_deferred_position->GetPositionRate().longitude_time_derivative : m_longitude_rate;
+}
+
+void AircraftState::ResolveDeferredPosition() {
+   if (m_deferred_position) {
+      m_latitude = GetLatitude();
+      m_longitude = GetLongitude();
+      m_latitude_rate = GetLatitudeRate();
+      m_longitude_rate = GetLongitudeRate();
+      m_deferred_position.reset();
+   }
+}
+
 Units::Speed AircraftState::GetGroundSpeed() const {
    return Units::sqrt(Units::sqr(GetSpeedEnuX()) + Units::sqr(GetSpeedEnuY()));
 }
@@ -71,6 +98,10 @@ AircraftState &AircraftState::Interpolate(const AircraftState &a, const Aircraft
       aWeight = (b.m_time.value() - time) / baTimeDiff;
       bWeight = 1 - aWeight;
    }
+   // Either input may be this state, so read them before anything is written
+   const Units::SignedAngle latitude = a.GetLatitude() * aWeight + b.GetLatitude() * bWeight;
+   const Units::SignedAngle longitude = a.GetLongitude() * aWeight + b.GetLongitude() * bWeight;
+   ResolveDeferredPosition();
    m_id = a.GetUniqueId();
    m_time = Units::SecondsTime(time);
    m_x = a.m_x * aWeight + b.m_x * bWeight;
@@ -79,13 +110,16 @@ AircraftState &AircraftState::Interpolate(const AircraftState &a, const Aircraft
    m_xd = a.m_xd * aWeight + b.m_xd * bWeight;
    m_yd = a.m_yd * aWeight + b.m_yd * bWeight;
    m_zd = a.m_zd * aWeight + b.m_zd * bWeight;
-   m_latitude = a.m_latitude * aWeight + b.m_latitude * bWeight;
-   m_longitude = a.m_longitude * aWeight + b.m_longitude * bWeight;
+   m_latitude = latitude;
+   m_longitude = longitude;
    return *this;
 }
 
 AircraftState &AircraftState::Extrapolate(const AircraftState &in, const Units::SecondsTime &time) {
    Units::SecondsTime dt = time - in.m_time;
+   const Units::SignedAngle latitude = in.GetLatitude() + in.GetLatitudeRate() * dt;
+   const Units::SignedAngle longitude = in.GetLongitude() + in.GetLongitudeRate() * dt;
+   ResolveDeferredPosition();
    m_time = time;
    m_id = in.m_id;
    m_x = in.m_x + in.m_xd * dt;
@@ -94,8 +128,8 @@ AircraftState &AircraftState::Extrapolate(const AircraftState &in, const Units::
    m_xd = in.m_xd;
    m_yd = in.m_yd;
    m_zd = in.m_zd;
-   m_latitude = in.m_latitude + in.m_latitude_rate * dt;
-   m_longitude = in.m_longitude + in.m_longitude_rate * dt;
+   m_latitude = latitude;
+   m_longitude = longitude;
    return *this;
 }
 
@@ -134,6 +168,7 @@ AircraftState::AircraftState(const AircraftState::Builder &builder) {
    m_longitude = builder.GetLongitude();
    m_latitude_rate = builder.GetLatitudeRate();
    m_longitude_rate = builder.GetLongitudeRate();
+   m_deferred_position = builder.GetDeferredPosition();
    m_psi = builder.GetPsi();
 }
 
@@ -173,6 +208,7 @@ AircraftState::Builder::Builder(const AircraftState &state_to_copy) {
    longitude_ = state_to_copy.m_longitude;
    latitude_rate_ = state_to_copy.m_latitude_rate;
    longitude_rate_ = state_to_copy.m_longitude_rate;
+   deferred_position_ = state_to_copy.m_deferred_position;
    psi_ = state_to_copy.GetPsi();
    dynamics_state_ = state_to_copy.GetDynamicsState();
 }
@@ -248,25 +284,45 @@ AircraftState::Builder *AircraftState::Builder::SensedPressure(Units::Pressure p
 }
 
 AircraftState::Builder *AircraftState::Builder::Latitude(Units::SignedAngle latitude) {
+   ResolveDeferredPosition();
    latitude_ = latitude;
    return this;
 }
 
 AircraftState::Builder *AircraftState::Builder::LatitudeRate(Units::AngularSpeed latitude_rate) {
+   ResolveDeferredPosition();
    latitude_rate_ = latitude_rate;
    return this;
 }
 
 AircraftState::Builder *AircraftState::Builder::Longitude(Units::SignedAngle longitude) {
+   ResolveDeferredPosition();
    longitude_ = longitude;
    return this;
 }
 
 AircraftState::Builder *AircraftState::Builder::LongitudeRate(Units::AngularSpeed longitude_rate) {
+   ResolveDeferredPosition();
    longitude_rate_ = longitude_rate;
    return this;
 }
 
+AircraftState::Builder *AircraftState::Builder::DeferredPosition(
+      std::shared_ptr<const aaesim::open_source::DeferredGeodeticPosition> position) {
+   deferred_position_ = std::move(position);
+   return this;
+}
+
+void AircraftState::Builder::ResolveDeferredPosition() {
+   if (deferred_position_) {
+      latitude_ = deferred_position_->GetPosition().latitude;
+      longitude_ = deferred_position_->GetPosition().longitude;
+      latitude_rate_ = deferred_position_->GetPositionRate().latitude_time_derivative;
+      longitude_rate_ = deferred_position_->GetPositionRate().longitude_time_derivative;
+      deferred_position_.reset();
+   }
+}
+
 AircraftState::Builder *AircraftState::Builder::Psi(Units::Angle psi) {
    psi_ = psi;
    return this;
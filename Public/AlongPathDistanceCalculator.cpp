@@ -37,6 +37,14 @@ AlongPathDistanceCalculator::AlongPathDistanceCalculator(const std::vector<Horiz
    m_cross_track_tolerance = CROSS_TRACK_TOLERANCE;
 }
 
+AlongPathDistanceCalculator::AlongPathDistanceCalculator(
+      std::shared_ptr<const ExtendedHorizontalPath> horizontal_path,
+      TrajectoryIndexProgressionDirection expected_index_progression)
+   : HorizontalPathTracker(std::move(horizontal_path), expected_index_progression) {
+   m_is_first_call = true;
+   m_cross_track_tolerance = CROSS_TRACK_TOLERANCE;
+}
+
 AlongPathDistanceCalculator::AlongPathDistanceCalculator(const std::vector<HorizontalPath> &horizontal_path,
                                                          TrajectoryIndexProgressionDirection expected_index_progression,
                                                          bool use_large_cross_track_tolerance)
@@ -82,6 +90,7 @@ bool AlongPathDistanceCalculator::CalculateAlongPathDistanceFromPosition(const U
                                                                          Units::Length &distance_along_path,
                                                                          Units::UnsignedAngle &course,
                                                                          Units::UnsignedAngle &pt_to_pt_course) {
+   const auto &extended_trajectory = m_path->GetExtendedPath();
    std::vector<HorizontalPath>::size_type resolved_index;
    Units::Length calculated_distance_along_path;
    bool return_boolean = IsPositionOnNode(position_x, position_y, resolved_index);
@@ -89,19 +98,19 @@ bool AlongPathDistanceCalculator::CalculateAlongPathDistanceFromPosition(const U
       if (m_is_first_call) UpdateCurrentIndex(0);
 
       return_boolean = AircraftCalculations::CalculateDistanceAlongPathFromPosition(
-            m_cross_track_tolerance, position_x, position_y, m_extended_horizontal_trajectory, m_current_index,
-            calculated_distance_along_path, course, resolved_index);
-      HorizontalTurnPath::TURN_TYPE turn_type = m_extended_horizontal_trajectory[resolved_index].m_turn_info.turn_type;
+            m_cross_track_tolerance, position_x, position_y, extended_trajectory, m_path->GetExtendedNodeIndex(),
+            m_current_index, calculated_distance_along_path, course, resolved_index);
+      HorizontalTurnPath::TURN_TYPE turn_type = extended_trajectory[resolved_index].m_turn_info.turn_type;
       if (turn_type == HorizontalTurnPath::TURN_TYPE::PERFORMANCE) {
          Units::MetersLength half_turn_dist = Units::MetersLength(
-               (m_extended_horizontal_trajectory[resolved_index].m_path_length_cumulative_meters +
-                m_extended_horizontal_trajectory[resolved_index + 1].m_path_length_cumulative_meters) /
+               (extended_trajectory[resolved_index].m_path_length_cumulative_meters +
+                extended_trajectory[resolved_index + 1].m_path_length_cumulative_meters) /
                2);
          if (calculated_distance_along_path > half_turn_dist)  // first half of turn
             pt_to_pt_course = course;
          else
             pt_to_pt_course = Units::UnsignedRadiansAngle(
-                  Units::UnsignedRadiansAngle(m_extended_horizontal_trajectory[resolved_index].m_path_course) +
+                  Units::UnsignedRadiansAngle(extended_trajectory[resolved_index].m_path_course) +
                   Units::PI_RADIANS_ANGLE);
       } else {
          // for RADIUS_FIXED only use tangent == course
@@ -111,8 +120,8 @@ bool AlongPathDistanceCalculator::CalculateAlongPathDistanceFromPosition(const U
 
    } else {
       calculated_distance_along_path =
-            Units::MetersLength(m_extended_horizontal_trajectory[resolved_index].m_path_length_cumulative_meters);
-      course = Units::RadiansAngle(m_extended_horizontal_trajectory[resolved_index].m_path_course) +
+            Units::MetersLength(extended_trajectory[resolved_index].m_path_length_cumulative_meters);
+      course = Units::RadiansAngle(extended_trajectory[resolved_index].m_path_course) +
                Units::PI_RADIANS_ANGLE;
       pt_to_pt_course = course;
    }
@@ -144,8 +153,8 @@ bool AlongPathDistanceCalculator::CalculateAlongPathDistanceFromPosition(const U
       auto high_index = std::max(m_current_index, resolved_index) + 1;
       auto low_index = std::min(m_current_index, resolved_index);
       for (auto i = low_index; i <= high_index; i++) {
-         LOG4CPLUS_TRACE(m_logger, "" << i << ": (" << m_extended_horizontal_trajectory[i].GetXPositionMeters() << ","
-                                      << m_extended_horizontal_trajectory[i].GetYPositionMeters() << ")");
+         LOG4CPLUS_TRACE(m_logger, "" << i << ": (" << extended_trajectory[i].GetXPositionMeters() << ","
+                                      << extended_trajectory[i].GetYPositionMeters() << ")");
       }
       throw std::logic_error(msg);
    }
@@ -162,7 +171,8 @@ bool AlongPathDistanceCalculator::CalculateAlongPathDistanceFromPosition(const U
    return CalculateAlongPathDistanceFromPosition(position_x, position_y, distance_along_path, ignored_course);
 }
 
-void AlongPathDistanceCalculator::UpdateHorizontalTrajectory(const std::vector<HorizontalPath> &horizontal_trajectory) {
-   HorizontalPathTracker::UpdateHorizontalTrajectory(horizontal_trajectory);
+void AlongPathDistanceCalculator::UpdateHorizontalTrajectory(
+      std::shared_ptr<const ExtendedHorizontalPath> horizontal_trajectory) {
+   HorizontalPathTracker::UpdateHorizontalTrajectory(std::move(horizontal_trajectory));
    m_is_first_call = true;
 }
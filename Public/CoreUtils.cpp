@@ -44,6 +44,30 @@ int CoreUtils::FindNearestIndex(const double &value_to_find, const vector<double
 
 double CoreUtils::LinearlyInterpolate(int upper_index, double x_interpolation_value,
                                       const std::vector<double> &x_values, const std::vector<double> &y_values) {
+   ValidateInterpolationBracket(upper_index, x_interpolation_value, x_values);
+
+   const double v2 = x_values[upper_index];
+   const double v1 = x_values[upper_index - 1];
+   const double o2 = y_values[upper_index];
+   const double o1 = y_values[upper_index - 1];
+   return ((o2 - o1) / (v2 - v1)) * (x_interpolation_value - v1) + o1;
+}
+
+Units::Speed CoreUtils::LinearlyInterpolate(int upper_index, Units::Length x_interpolation_value,
+                                            const std::vector<double> &x_values,
+                                            const std::vector<Units::Speed> &y_values) {
+   const double x_interpolation_meters = Units::MetersLength(x_interpolation_value).value();
+   ValidateInterpolationBracket(upper_index, x_interpolation_meters, x_values);
+
+   const double v2 = x_values[upper_index];
+   const double v1 = x_values[upper_index - 1];
+   const double o2 = Units::MetersPerSecondSpeed(y_values[upper_index]).value();
+   const double o1 = Units::MetersPerSecondSpeed(y_values[upper_index - 1]).value();
+   return Units::MetersPerSecondSpeed(((o2 - o1) / (v2 - v1)) * (x_interpolation_meters - v1) + o1);
+}
+
+void CoreUtils::ValidateInterpolationBracket(int upper_index, double x_interpolation_value,
+                                             const std::vector<double> &x_values) {
    if (upper_index < 1 || upper_index >= x_values.size()) {
       char msg[200];
       snprintf(msg, sizeof(msg), "upper_index (%d) is not between 1 and %d", upper_index,
@@ -54,8 +78,6 @@ double CoreUtils::LinearlyInterpolate(int upper_index, double x_interpolation_va
 
    const double v2 = x_values[upper_index];
    const double v1 = x_values[upper_index - 1];
-   const double o2 = y_values[upper_index];
-   const double o1 = y_values[upper_index - 1];
 
    if ((x_interpolation_value - v1) * (x_interpolation_value - v2) > 0) {
       char msg[200];
@@ -69,20 +91,6 @@ double CoreUtils::LinearlyInterpolate(int upper_index, double x_interpolation_va
          throw domain_error(msg);
       }
    }
-
-   return ((o2 - o1) / (v2 - v1)) * (x_interpolation_value - v1) + o1;
-}
-
-Units::Speed CoreUtils::LinearlyInterpolate(int upper_index, Units::Length x_interpolation_value,
-                                            const std::vector<double> &x_values,
-                                            const std::vector<Units::Speed> &y_values) {
-   std::vector<double> y_values_as_double{};
-   auto insert_speed_as_double = [&y_values_as_double](Units::Speed speed_value) {
-      y_values_as_double.push_back(Units::MetersPerSecondSpeed(speed_value).value());
-   };
-   std::for_each(y_values.begin(), y_values.end(), insert_speed_as_double);
-   return Units::MetersPerSecondSpeed(LinearlyInterpolate(
-         upper_index, Units::MetersLength(x_interpolation_value).value(), x_values, y_values_as_double));
 }
 
 const Units::Length CoreUtils::CalculateEuclideanDistance(const std::pair<Units::Length, Units::Length> &xyLoc1,
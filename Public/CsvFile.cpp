@@ -0,0 +1,164 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "public/CsvFile.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aaesim {
+namespace open_source {
+
+namespace {
+const std::string_view UTF8_BYTE_ORDER_MARK("\xEF\xBB\xBF");
+}
+
+std::shared_ptr<const CsvFile> CsvFile::Open(const std::string &file_name) {
+   const int descriptor = open(file_name.c_str(), O_RDONLY);
+   if (descriptor < 0) {
+      return nullptr;
+   }
+
+   std::shared_ptr<CsvFile> csv_file(new CsvFile());
+   struct stat file_status;
+   if (fstat(descriptor, &file_status) == 0 && S_ISREG(file_status.st_mode) && file_status.st_size > 0) {
+      const auto size = static_cast<std::size_t>(file_status.st_size);
+      void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (mapping != MAP_FAILED) {
+         madvise(mapping, size, MADV_SEQUENTIAL);
+         csv_file->m_mapping = mapping;
+         csv_file->m_mapping_size = size;
+         csv_file->SetText(static_cast<const char *>(mapping), size);
+      }
+   }
+   close(descriptor);
+
+   if (!csv_file->m_mapping) {
+      // empty, not a regular file, or not mappable
+      std::ifstream input_stream(file_name, std::ios::binary);
+      if (!input_stream.is_open()) {
+         return nullptr;
+      }
+      return Read(input_stream);
+   }
+   return csv_file;
+}
+
+std::shared_ptr<const CsvFile> CsvFile::Read(std::istream &input_stream) {
+   std::shared_ptr<CsvFile> csv_file(new CsvFile());
+   csv_file->m_buffer.assign(std::istreambuf_iterator<char>(input_stream), std::istreambuf_iterator<char>());
+   csv_file->SetText(csv_file->m_buffer.data(), csv_file->m_buffer.size());
+   return csv_file;
+}
+
+CsvFile::~CsvFile() {
+   if (m_mapping) {
+      munmap(m_mapping, m_mapping_size);
+   }
+}
+
+std::uint64_t CsvFile::GetContentHash() const {
+   std::uint64_t hash = 14695981039346656037ULL;
+   for (const char c : m_text) {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+void CsvFile::SetText(const char *text, std::size_t size) {
+   m_text = std::string_view(text, size);
+   if (m_text.substr(0, UTF8_BYTE_ORDER_MARK.size()) == UTF8_BYTE_ORDER_MARK) {
+      m_text.remove_prefix(UTF8_BYTE_ORDER_MARK.size());
+   }
+}
+
+CsvCursor::CsvCursor(std::shared_ptr<const CsvFile> file, char delimiter)
+   : m_file(std::move(file)), m_delimiter(delimiter), m_position(0), m_cells() {}
+
+std::string_view CsvCursor::NextLine() {
+   const std::string_view text = m_file->GetText();
+   const std::size_t end_of_line = std::min(text.find('\n', m_position), text.size());
+   std::string_view line = text.substr(m_position, end_of_line - m_position);
+   m_position = end_of_line + 1;
+   if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+   }
+   return line;
+}
+
+bool CsvCursor::Advance() {
+   m_cells.clear();
+   if (!m_file || m_position >= m_file->GetText().size()) {
+      return false;
+   }
+
+   std::string_view line = NextLine();
+   while (!line.empty()) {
+      const std::size_t end_of_cell = line.find(m_delimiter);
+      m_cells.push_back(line.substr(0, end_of_cell));
+      line.remove_prefix(end_of_cell == std::string_view::npos ? line.size() : end_of_cell + 1);
+   }
+   return true;
+}
+
+void CsvCursor::SkipLines(int number_of_lines) {
+   m_cells.clear();
+   for (int i = 0; i < number_of_lines && m_file && m_position < m_file->GetText().size(); ++i) {
+      NextLine();
+   }
+}
+
+double CsvCursor::GetDouble(std::size_t column) const {
+   return column < m_cells.size() ? ParseDouble(m_cells[column]) : 0;
+}
+
+std::map<std::string, int, std::less<>> CsvCursor::BuildColumnIndex() const {
+   std::map<std::string, int, std::less<>> column_index;
+   for (std::size_t i = 0; i < m_cells.size(); ++i) {
+      column_index.insert_or_assign(std::string(m_cells[i]), static_cast<int>(i));
+   }
+   return column_index;
+}
+
+double CsvCursor::ParseDouble(std::string_view cell) {
+   while (!cell.empty() && (cell.front() == ' ' || cell.front() == '\t')) {
+      cell.remove_prefix(1);
+   }
+   if (!cell.empty() && cell.front() == '+') {
+      cell.remove_prefix(1);
+   }
+   double value = 0;
+   const auto result = std::from_chars(cell.data(), cell.data() + cell.size(), value);
+   if (result.ec == std::errc::result_out_of_range) {
+      // from_chars leaves value unset here; atof() gives +-HUGE_VAL on overflow and a tiny value on underflow
+      return std::strtod(std::string(cell).c_str(), nullptr);
+   }
+   return result.ec == std::errc() ? value : 0;
+}
+
+}  // namespace open_source
+}  // namespace aaesim
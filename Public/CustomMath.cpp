@@ -218,7 +218,7 @@ void matrix_times_vector(DMatrix &matrix_in, DVector &vector_in, int n, DVector
  * matrix [x y z] is post-multiplied by the rotation
  * matrix.
  */
-DMatrix &CreateRotationMatrix(double l, double m, double n, const Units::Angle theta) {
+aaesim::open_source::Mat3 CreateRotationMatrix(double l, double m, double n, const Units::Angle theta) {
 
    // basic formula acquired from:
    // https://en.wikipedia.org/wiki/Transformation_matrix#Rotation_2
@@ -238,9 +238,7 @@ DMatrix &CreateRotationMatrix(double l, double m, double n, const Units::Angle t
    double sinT = sin(theta);
    double cosT1 = 1 - cosT;
 
-   double a[3][3] = {{l * l * cosT1 + cosT, m * l * cosT1 + n * sinT, n * l * cosT1 - m * sinT},
-                     {l * m * cosT1 - n * sinT, m * m * cosT1 + cosT, n * m * cosT1 + l * sinT},
-                     {l * n * cosT1 + m * sinT, m * n * cosT1 - l * sinT, n * n * cosT1 + cosT}};
-   DMatrix *result = new DMatrix((double **)&a, 0, 2, 0, 2);
-   return *result;
+   return aaesim::open_source::Mat3({{{l * l * cosT1 + cosT, m * l * cosT1 + n * sinT, n * l * cosT1 - m * sinT},
+                                      {l * m * cosT1 - n * sinT, m * m * cosT1 + cosT, n * m * cosT1 + l * sinT},
+                                      {l * n * cosT1 + m * sinT, m * n * cosT1 - l * sinT, n * n * cosT1 + cosT}}});
 }
@@ -26,6 +26,8 @@
 
 #include "public/DataReader.h"
 
+#include <iostream>
+
 namespace aaesim {
 namespace open_source {
 
@@ -44,27 +46,28 @@ DataReader::DataReader(std::shared_ptr<std::istream> input_stream, int header_li
    OpenStream(input_stream, header_lines);
 }
 
+DataReader::DataReader(std::shared_ptr<const CsvFile> csv_file, int header_lines, size_t expected_columns)
+   : m_expected_column_count(expected_columns), m_csv_row(std::move(csv_file)) {
+   SkipLines(header_lines);
+}
+
 DataReader::~DataReader() {}
 
 void DataReader::OpenFile(std::string file_name, int header_lines) {
-   std::shared_ptr<std::istream> input_stream(new std::ifstream(file_name));
-   OpenStream(input_stream, header_lines);
+   // a file that cannot be opened reads as empty
+   m_csv_row = CsvCursor(CsvFile::Open(file_name));
+   SkipLines(header_lines);
 }
 
 void DataReader::OpenStream(std::shared_ptr<std::istream> input_stream, int header_lines) {
-   m_input_stream = input_stream;
+   m_csv_row = CsvCursor(CsvFile::Read(*input_stream));
    SkipLines(header_lines);
 }
 
-void DataReader::SkipLines(int header_lines) {
-   for (int i = 0; i < header_lines; i++) {
-      m_input_stream->ignore(1000, '\n');
-   }
-}
+void DataReader::SkipLines(int header_lines) { m_csv_row.SkipLines(header_lines); }
 
 bool DataReader::Advance() {
-   m_csv_row.ReadNextRow(*m_input_stream);
-   if (m_csv_row.Size() == 0) {
+   if (!m_csv_row.Advance() || m_csv_row.Size() == 0) {
       // end of stream
       return false;
    }
@@ -76,14 +79,9 @@ bool DataReader::Advance() {
    return true;
 }
 
-double DataReader::GetDouble(int column) const {
-   std::istringstream iss(m_csv_row[column]);
-   double val = 0;
-   iss >> val;
-   return val;
-}
+double DataReader::GetDouble(int column) const { return m_csv_row.GetDouble(column); }
 
-std::string DataReader::GetString(int column) const { return m_csv_row[column]; }
+std::string DataReader::GetString(int column) const { return std::string(m_csv_row[column]); }
 
 size_t DataReader::GetColumnCount() const { return m_csv_row.Size(); }
 
@@ -92,15 +90,7 @@ void DataReader::SetExpectedColumnCount(size_t expected_column_count) {
 }
 
 void DataReader::BuildColumnIndex() {
-   // build the column index
-   for (int i = 0; i < GetColumnCount(); i++) {
-      std::string name(GetString(i));
-      size_t crpos(name.rfind('\r'));
-      if (crpos != std::string::npos) {
-         name.erase(crpos, 1);
-      }
-      m_column_index[name] = i;
-   }
+   m_column_index = m_csv_row.BuildColumnIndex();
 
    int column_count0 = m_column_index.size();
    if (column_count0 != GetColumnCount()) {
@@ -109,13 +99,13 @@ void DataReader::BuildColumnIndex() {
 }
 
 int DataReader::GetColumnNumber(const std::string &column_name) {
-   int column_count0 = m_column_index.size();
-   int index = m_column_index[column_name];
-   int column_count1 = m_column_index.size();
-   if (column_count0 != column_count1) {
-      LOG4CPLUS_WARN(m_logger, "Column \"" << column_name << "\" not found.  Will use " << index);
+   const auto column = m_column_index.find(column_name);
+   if (column != m_column_index.end()) {
+      return column->second;
    }
-   return index;
+   LOG4CPLUS_WARN(m_logger, "Column \"" << column_name << "\" not found.  Will use 0");
+   m_column_index.emplace(column_name, 0);
+   return 0;
 }
 
 }  // namespace open_source
@@ -0,0 +1,51 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "public/DeferredGeodeticPosition.h"
+
+using namespace aaesim::open_source;
+
+std::shared_ptr<const DeferredGeodeticPosition> DeferredGeodeticPosition::Of(
+      const EarthModel::GeodeticPosition &position, const LatLonDerivative &position_rate) {
+   return std::make_shared<const DeferredGeodeticPosition>(
+         [position, position_rate](EarthModel::GeodeticPosition &resolved_position,
+                                   LatLonDerivative &resolved_position_rate) {
+            resolved_position = position;
+            resolved_position_rate = position_rate;
+         });
+}
+
+const EarthModel::GeodeticPosition &DeferredGeodeticPosition::GetPosition() const {
+   Resolve();
+   return m_position;
+}
+
+const LatLonDerivative &DeferredGeodeticPosition::GetPositionRate() const {
+   Resolve();
+   return m_position_rate;
+}
+
+void DeferredGeodeticPosition::Resolve() const {
+   std::call_once(m_resolve_once, [this]() {
+      m_resolver(m_position, m_position_rate);
+      // Release whatever the resolver captured; it is never called again
+      m_resolver = nullptr;
+      m_is_resolved.store(true, std::memory_order_release);
+   });
+}
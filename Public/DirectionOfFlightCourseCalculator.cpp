@@ -31,9 +31,15 @@ DirectionOfFlightCourseCalculator::DirectionOfFlightCourseCalculator() {}
 DirectionOfFlightCourseCalculator::DirectionOfFlightCourseCalculator(
       const std::vector<HorizontalPath> &horizontal_path,
       TrajectoryIndexProgressionDirection expected_index_progression)
-   : HorizontalPathTracker(horizontal_path, expected_index_progression) {
-   m_end_course = Units::RadiansAngle(horizontal_path.front().m_path_course) + Units::PI_RADIANS_ANGLE;
-   m_start_course = Units::RadiansAngle(horizontal_path.back().m_path_course) + Units::PI_RADIANS_ANGLE;
+   : DirectionOfFlightCourseCalculator(ExtendedHorizontalPath::Of(horizontal_path), expected_index_progression) {}
+
+DirectionOfFlightCourseCalculator::DirectionOfFlightCourseCalculator(
+      std::shared_ptr<const ExtendedHorizontalPath> horizontal_path,
+      TrajectoryIndexProgressionDirection expected_index_progression)
+   : HorizontalPathTracker(std::move(horizontal_path), expected_index_progression) {
+   const auto &unmodified_path = m_path->GetUnmodifiedPath();
+   m_end_course = Units::RadiansAngle(unmodified_path.front().m_path_course) + Units::PI_RADIANS_ANGLE;
+   m_start_course = Units::RadiansAngle(unmodified_path.back().m_path_course) + Units::PI_RADIANS_ANGLE;
 }
 
 DirectionOfFlightCourseCalculator::~DirectionOfFlightCourseCalculator() = default;
@@ -43,7 +49,7 @@ bool DirectionOfFlightCourseCalculator::CalculateCourseAtAlongPathDistance(const
    std::vector<HorizontalPath>::size_type resolved_index;
    Units::Angle ignored_turn_theta;
    Units::Length ignored_turn_radius;
-   bool return_value = CalculateForwardCourse(distance_along_path + EXTENSION_LENGTH, m_extended_horizontal_trajectory,
+   bool return_value = CalculateForwardCourse(distance_along_path + EXTENSION_LENGTH, m_path->GetExtendedPath(),
                                               m_current_index, forward_course, ignored_turn_theta, ignored_turn_radius,
                                               resolved_index);
 
@@ -76,7 +82,7 @@ bool DirectionOfFlightCourseCalculator::CalculateCourseAtAlongPathDistance(const
       UpdateCurrentIndex(resolved_index);
 
    } else if (distance_along_path + EXTENSION_LENGTH >
-              Units::MetersLength(m_extended_horizontal_trajectory.back().m_path_length_cumulative_meters)) {
+              Units::MetersLength(m_path->GetExtendedPath().back().m_path_length_cumulative_meters)) {
       // distance_along_path is very large so off the back of the path. The old code allowed this situation to quietly
       // happen. For now, it helps a lot to allow this. But, we should consider this deprecated behavior and throw in
       // the future.
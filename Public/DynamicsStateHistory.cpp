@@ -0,0 +1,79 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "public/DynamicsStateHistory.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace aaesim::open_source;
+
+DynamicsStateHistory::Policy DynamicsStateHistory::PolicyFromString(std::string s) {
+   std::transform(s.cbegin(), s.cend(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+   if (s == "full") return Policy::FULL;
+   if (s == "ring") return Policy::RING;
+   if (s == "none") return Policy::NONE;
+   std::string msg = "Invalid DynamicsStateHistory policy string: '" + s + "'. Must be 'none', 'ring' or 'full'.";
+   throw std::runtime_error(msg);
+}
+
+void DynamicsStateHistory::SetPolicy(Policy policy, std::size_t ring_length) {
+   if (policy == Policy::RING && ring_length == 0) {
+      throw std::runtime_error("A ring dynamics history must retain at least one state");
+   }
+   m_policy = policy;
+   m_ring_length = ring_length;
+   m_entries.clear();
+   m_first_entry = 0;
+   if (m_policy != Policy::NONE && m_has_latest) {
+      m_entries.push_back(m_latest);
+   }
+   if (m_policy == Policy::RING) {
+      m_entries.reserve(2 * m_ring_length);
+   }
+}
+
+void DynamicsStateHistory::Record(const SimulationTime &time, const DynamicsState &state) {
+   if (m_has_latest && !(m_latest.time < time)) {
+      return;
+   }
+   m_latest.time = time;
+   m_latest.state = state;
+   m_has_latest = true;
+
+   switch (m_policy) {
+      case Policy::NONE:
+         break;
+      case Policy::RING:
+         // The window slides through a buffer of twice its length and is moved back to the front when the
+         // buffer fills, so the retained states stay contiguous at an amortized cost of one copy per record.
+         if (m_entries.size() == 2 * m_ring_length) {
+            std::move(m_entries.end() - (m_ring_length - 1), m_entries.end(), m_entries.begin());
+            m_entries.resize(m_ring_length - 1);
+            m_first_entry = 0;
+         } else if (m_entries.size() - m_first_entry == m_ring_length) {
+            ++m_first_entry;
+         }
+         m_entries.push_back(m_latest);
+         break;
+      case Policy::FULL:
+         m_entries.push_back(m_latest);
+         break;
+   }
+}
@@ -26,10 +26,53 @@
 
 #include "public/EarthModel.h"
 
+#include <stdexcept>
+
 EarthModel::EarthModel() {}
 
 EarthModel::~EarthModel() {}
 
+void EarthModel::CheckBatchSizes(const GeodeticArrays<const double> &geo, const CartesianArrays<double> &ecef) {
+   if (!geo.IsConsistent() || !ecef.IsConsistent() || geo.size() != ecef.size()) {
+      throw std::logic_error("Batch geodetic to ECEF conversion requires arrays of the same size");
+   }
+}
+
+void EarthModel::CheckBatchSizes(const CartesianArrays<const double> &ecef, const GeodeticArrays<double> &geo) {
+   if (!geo.IsConsistent() || !ecef.IsConsistent() || geo.size() != ecef.size()) {
+      throw std::logic_error("Batch ECEF to geodetic conversion requires arrays of the same size");
+   }
+}
+
+void EarthModel::ConvertGeodeticToAbsolute(const GeodeticArrays<const double> &geo,
+                                           const CartesianArrays<double> &ecef) const {
+   CheckBatchSizes(geo, ecef);
+   for (std::size_t i = 0; i < geo.size(); ++i) {
+      EarthModel::AbsolutePositionEcef position_ecef;
+      ConvertGeodeticToAbsolute(GeodeticPosition::Of(Units::SignedRadiansAngle(geo.latitude_radians[i]),
+                                                     Units::SignedRadiansAngle(geo.longitude_radians[i])),
+                                position_ecef);
+      ecef.x_meters[i] = position_ecef.x.value();
+      ecef.y_meters[i] = position_ecef.y.value();
+      ecef.z_meters[i] = position_ecef.z.value();
+   }
+}
+
+void EarthModel::ConvertAbsoluteToGeodetic(const CartesianArrays<const double> &ecef,
+                                           const GeodeticArrays<double> &geo) const {
+   CheckBatchSizes(ecef, geo);
+   for (std::size_t i = 0; i < ecef.size(); ++i) {
+      EarthModel::AbsolutePositionEcef position_ecef;
+      position_ecef.x = Units::MetersLength(ecef.x_meters[i]);
+      position_ecef.y = Units::MetersLength(ecef.y_meters[i]);
+      position_ecef.z = Units::MetersLength(ecef.z_meters[i]);
+      EarthModel::GeodeticPosition position_geo;
+      ConvertAbsoluteToGeodetic(position_ecef, position_geo);
+      geo.latitude_radians[i] = Units::RadiansAngle(position_geo.latitude).value();
+      geo.longitude_radians[i] = Units::RadiansAngle(position_geo.longitude).value();
+   }
+}
+
 std::ostream &operator<<(std::ostream &out, const EarthModel::GeodeticPosition &geo) {
    out << "(" << Units::DegreesAngle(geo.latitude) << "," << Units::DegreesAngle(geo.longitude) << ")";
    return out;
@@ -65,6 +65,46 @@ void EllipsoidalEarthModel::ConvertAbsoluteToGeodetic(const EarthModel::Absolute
    geo.altitude = Units::MetersLength(0);
 }
 
+void EllipsoidalEarthModel::ConvertGeodeticToAbsolute(const GeodeticArrays<const double> &geo,
+                                                      const CartesianArrays<double> &ecef) const {
+   CheckBatchSizes(geo, ecef);
+   const double semi_major_axis = Units::MetersLength(WGS84_SEMIMAJOR_AXIS).value();
+   for (std::size_t i = 0; i < geo.size(); ++i) {
+      const double sinLat = std::sin(geo.latitude_radians[i]);
+      const double cosLat = std::cos(geo.latitude_radians[i]);
+      const double N = semi_major_axis / std::sqrt(1.0 - WGS84_ECCENTRICITY_SQUARED * sinLat * sinLat);
+      ecef.x_meters[i] = N * cosLat * std::cos(geo.longitude_radians[i]);
+      ecef.y_meters[i] = N * cosLat * std::sin(geo.longitude_radians[i]);
+      ecef.z_meters[i] = N * (1.0 - WGS84_ECCENTRICITY_SQUARED) * sinLat;
+   }
+}
+
+void EllipsoidalEarthModel::ConvertAbsoluteToGeodetic(const CartesianArrays<const double> &ecef,
+                                                      const GeodeticArrays<double> &geo) const {
+   CheckBatchSizes(ecef, geo);
+   const double a2 = Units::MetersArea(m_semi_major_radius_squared).value();
+   for (std::size_t i = 0; i < ecef.size(); ++i) {
+      const double x = ecef.x_meters[i];
+      const double y = ecef.y_meters[i];
+      const double z = ecef.z_meters[i];
+
+      // Ferrari's Solution, as in the single-position method
+      const double zeta = (1 - WGS84_ECCENTRICITY_SQUARED) * z * z / a2;
+      const double p = std::sqrt(x * x + y * y);
+      const double s = (m_eccentricity_4 * zeta * p * p) / (a2 * 4);
+      const double rho = (p * p / a2 + zeta - m_eccentricity_4) / 6;
+      const double rhocubed = rho * rho * rho;
+      const double t = std::cbrt(rhocubed + s + std::sqrt(s * (s + 2 * rhocubed)));
+      const double u = rho + t + (rho * rho) / t;
+      const double v = std::sqrt(u * u + m_eccentricity_4 * zeta);
+      const double w = WGS84_ECCENTRICITY_SQUARED * (u + v - zeta) / (2 * v);
+      const double kappa = 1 + (WGS84_ECCENTRICITY_SQUARED * (std::sqrt(u + v + w * w) + w)) / (u + v);
+
+      geo.latitude_radians[i] = std::atan(kappa * z / p);
+      geo.longitude_radians[i] = std::atan2(y, x);
+   }
+}
+
 std::shared_ptr<LocalTangentPlane> EllipsoidalEarthModel::MakeEnuConverter(
       const GeodeticPosition &pointOfTangencyGeo, const LocalPositionEnu &pointOfTangencyEnu) const {
 
@@ -20,15 +20,12 @@
 #include "public/Environment.h"
 #include "public/EllipsoidalEarthModel.h"
 
-std::unique_ptr<Environment> Environment::m_instance = nullptr;
-
 Environment::Environment() : m_earth_model(new EllipsoidalEarthModel()) {}
 
 Environment *Environment::GetInstance() {
-   if (m_instance == NULL) {
-      m_instance = std::unique_ptr<Environment>(new Environment());
-   }
-   return m_instance.get();
+   // function-local static initialization is thread-safe; the earth model is immutable once built
+   static Environment instance;
+   return &instance;
 }
 
 EarthModel *Environment::GetEarthModel() const { return m_earth_model.get(); }
\ No newline at end of file
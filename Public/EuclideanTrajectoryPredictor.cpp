@@ -910,9 +910,10 @@ void EuclideanTrajectoryPredictor::BuildTrajectoryPrediction(
       throw logic_error(msg);
    }
 
+   const auto extended_horizontal_path = ExtendedHorizontalPath::Of(m_horizontal_path);
    m_distance_calculator =
-         AlongPathDistanceCalculator(m_horizontal_path, TrajectoryIndexProgressionDirection::UNDEFINED);
-   m_position_calculator = PositionCalculator(m_horizontal_path, TrajectoryIndexProgressionDirection::UNDEFINED);
+         AlongPathDistanceCalculator(extended_horizontal_path, TrajectoryIndexProgressionDirection::UNDEFINED);
+   m_position_calculator = PositionCalculator(extended_horizontal_path, TrajectoryIndexProgressionDirection::UNDEFINED);
 }
 
 // the method to calculate Guidance based on the 4D Trajectory
@@ -0,0 +1,84 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "public/ExtendedHorizontalPath.h"
+
+using namespace aaesim::open_source;
+
+std::shared_ptr<const ExtendedHorizontalPath> ExtendedHorizontalPath::Of(
+      const std::vector<HorizontalPath> &horizontal_path) {
+   if (horizontal_path.empty()) {
+      return Empty();
+   }
+   return std::make_shared<const ExtendedHorizontalPath>(horizontal_path);
+}
+
+const std::shared_ptr<const ExtendedHorizontalPath> &ExtendedHorizontalPath::Empty() {
+   static const std::shared_ptr<const ExtendedHorizontalPath> empty_path =
+         std::make_shared<const ExtendedHorizontalPath>();
+   return empty_path;
+}
+
+ExtendedHorizontalPath::ExtendedHorizontalPath(const std::vector<HorizontalPath> &horizontal_path)
+   : m_unmodified_path(horizontal_path),
+     m_extended_path(ExtendHorizontalTrajectory(horizontal_path)),
+     m_extended_node_index(m_extended_path) {}
+
+std::vector<HorizontalPath> ExtendedHorizontalPath::ExtendHorizontalTrajectory(
+      const std::vector<HorizontalPath> &horizontal_trajectory) {
+   if (horizontal_trajectory.empty()) {
+      return {};
+   }
+
+   // add one more straight segment to end
+   std::vector<HorizontalPath> extended_trajectory;
+   Units::RadiansAngle crs(horizontal_trajectory[0].m_path_course);
+   HorizontalPath hp;
+   hp.m_segment_type = HorizontalPath::SegmentType::STRAIGHT;
+   hp.SetXYPositionMeters(horizontal_trajectory[0].GetXPositionMeters() -
+                                Units::MetersLength(EXTENSION_LENGTH).value() * Units::cos(crs),
+                          horizontal_trajectory[0].GetYPositionMeters() -
+                                Units::MetersLength(EXTENSION_LENGTH).value() * Units::sin(crs));  // meter
+   hp.m_path_length_cumulative_meters = 0;
+   hp.m_path_course = horizontal_trajectory[0].m_path_course;
+   extended_trajectory.push_back(hp);
+
+   // extend all lengths
+   for (auto itr = horizontal_trajectory.begin(); itr < horizontal_trajectory.end(); ++itr) {
+      HorizontalPath element = itr.operator*();
+      element.m_path_length_cumulative_meters += Units::MetersLength(EXTENSION_LENGTH).value();
+      extended_trajectory.push_back(element);
+   }
+
+   // add one more straigt segment to the beginning
+   Units::RadiansAngle crs_back(horizontal_trajectory.back().m_path_course);
+   HorizontalPath hp_beginning;
+   hp_beginning.m_segment_type = HorizontalPath::SegmentType::STRAIGHT;
+   hp_beginning.SetXYPositionMeters(
+         horizontal_trajectory.back().GetXPositionMeters() +
+               Units::MetersLength(EXTENSION_LENGTH).value() * Units::cos(crs_back),
+         horizontal_trajectory.back().GetYPositionMeters() +
+               Units::MetersLength(EXTENSION_LENGTH).value() * Units::sin(crs_back));  // meter
+   hp_beginning.m_path_length_cumulative_meters = horizontal_trajectory.back().m_path_length_cumulative_meters +
+                                                  2 * Units::MetersLength(EXTENSION_LENGTH).value();
+   hp_beginning.m_path_course = horizontal_trajectory.back().m_path_course;
+   extended_trajectory.push_back(hp_beginning);
+
+   return extended_trajectory;
+}
@@ -0,0 +1,115 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+#include "public/HorizontalPathNodeIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace aaesim::open_source;
+
+HorizontalPathNodeIndex::HorizontalPathNodeIndex(const std::vector<HorizontalPath> &horizontal_path) {
+   if (horizontal_path.empty()) {
+      return;
+   }
+
+   double min_x = horizontal_path.front().GetXPositionMeters(), max_x = min_x;
+   double min_y = horizontal_path.front().GetYPositionMeters(), max_y = min_y;
+   double total_node_spacing = 0;
+   for (auto i = 0; i < horizontal_path.size(); ++i) {
+      const double x = horizontal_path[i].GetXPositionMeters();
+      const double y = horizontal_path[i].GetYPositionMeters();
+      if (!std::isfinite(x) || !std::isfinite(y)) {
+         // leave the index empty; callers fall back to an exhaustive search
+         return;
+      }
+      min_x = std::min(min_x, x);
+      max_x = std::max(max_x, x);
+      min_y = std::min(min_y, y);
+      max_y = std::max(max_y, y);
+      if (i > 0) {
+         total_node_spacing += std::hypot(x - horizontal_path[i - 1].GetXPositionMeters(),
+                                          y - horizontal_path[i - 1].GetYPositionMeters());
+      }
+   }
+
+   // Cells roughly one node spacing wide, but never more than about four cells per node
+   const auto node_count = static_cast<double>(horizontal_path.size());
+   const double mean_node_spacing = total_node_spacing / node_count;
+   const double area_limited_size = std::sqrt((max_x - min_x) * (max_y - min_y) / (4 * node_count));
+   m_cell_size_meters = std::max({mean_node_spacing, area_limited_size, 1.0});
+   m_origin_x_meters = min_x;
+   m_origin_y_meters = min_y;
+   m_column_count = static_cast<long>(std::floor((max_x - min_x) / m_cell_size_meters)) + 1;
+   m_row_count = static_cast<long>(std::floor((max_y - min_y) / m_cell_size_meters)) + 1;
+
+   // counting sort of the nodes into cells; node order within a cell stays ascending
+   std::vector<std::vector<HorizontalPath>::size_type> node_cells(horizontal_path.size());
+   m_cell_offsets.assign(m_column_count * m_row_count + 1, 0);
+   for (auto i = 0; i < horizontal_path.size(); ++i) {
+      node_cells[i] = CellRow(horizontal_path[i].GetYPositionMeters()) * m_column_count +
+                      CellColumn(horizontal_path[i].GetXPositionMeters());
+      ++m_cell_offsets[node_cells[i] + 1];
+   }
+   for (auto c = 1; c < m_cell_offsets.size(); ++c) {
+      m_cell_offsets[c] += m_cell_offsets[c - 1];
+   }
+   std::vector<std::vector<HorizontalPath>::size_type> cell_fill(m_cell_offsets.begin(), m_cell_offsets.end() - 1);
+   m_cell_nodes.resize(horizontal_path.size());
+   for (auto i = 0; i < horizontal_path.size(); ++i) {
+      m_cell_nodes[cell_fill[node_cells[i]]++] = i;
+   }
+}
+
+long HorizontalPathNodeIndex::CellColumn(double x_meters) const {
+   const double column = std::floor((x_meters - m_origin_x_meters) / m_cell_size_meters);
+   return static_cast<long>(std::clamp(column, 0.0, static_cast<double>(m_column_count - 1)));
+}
+
+long HorizontalPathNodeIndex::CellRow(double y_meters) const {
+   const double row = std::floor((y_meters - m_origin_y_meters) / m_cell_size_meters);
+   return static_cast<long>(std::clamp(row, 0.0, static_cast<double>(m_row_count - 1)));
+}
+
+void HorizontalPathNodeIndex::FindNodesNear(const Units::Length position_x, const Units::Length position_y,
+                                            const Units::Length radius,
+                                            const std::vector<HorizontalPath>::size_type minimum_node_index,
+                                            std::vector<std::vector<HorizontalPath>::size_type> &node_indices) const {
+   node_indices.clear();
+   if (IsEmpty()) {
+      return;
+   }
+
+   const double x = Units::MetersLength(position_x).value();
+   const double y = Units::MetersLength(position_y).value();
+   const double r = Units::MetersLength(radius).value();
+
+   // widen by one cell on every side so that rounding at cell boundaries can never drop a node
+   const long first_column = CellColumn(x - r) - 1, last_column = CellColumn(x + r) + 1;
+   const long first_row = CellRow(y - r) - 1, last_row = CellRow(y + r) + 1;
+   for (long row = std::max(first_row, 0L); row <= std::min(last_row, m_row_count - 1); ++row) {
+      for (long column = std::max(first_column, 0L); column <= std::min(last_column, m_column_count - 1); ++column) {
+         const auto cell = row * m_column_count + column;
+         for (auto n = m_cell_offsets[cell]; n < m_cell_offsets[cell + 1]; ++n) {
+            if (m_cell_nodes[n] >= minimum_node_index) {
+               node_indices.push_back(m_cell_nodes[n]);
+            }
+         }
+      }
+   }
+}
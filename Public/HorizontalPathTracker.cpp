@@ -19,12 +19,18 @@
 
 #include <public/HorizontalPathTracker.h>
 
+#include <algorithm>
+
 aaesim::open_source::HorizontalPathTracker::HorizontalPathTracker(
       const std::vector<HorizontalPath> &horizontal_trajectory,
-      TrajectoryIndexProgressionDirection expected_index_progression) {
+      TrajectoryIndexProgressionDirection expected_index_progression)
+   : HorizontalPathTracker(ExtendedHorizontalPath::Of(horizontal_trajectory), expected_index_progression) {}
+
+aaesim::open_source::HorizontalPathTracker::HorizontalPathTracker(
+      std::shared_ptr<const ExtendedHorizontalPath> horizontal_trajectory,
+      TrajectoryIndexProgressionDirection expected_index_progression)
+   : m_path(std::move(horizontal_trajectory)) {
    m_index_progression_direction = expected_index_progression;
-   m_unmodified_horizontal_trajectory = horizontal_trajectory;
-   m_extended_horizontal_trajectory = ExtendHorizontalTrajectory(horizontal_trajectory);
    if (expected_index_progression == TrajectoryIndexProgressionDirection::INCREMENTING) {
       m_is_passed_end_of_route = true;
    } else {
@@ -33,52 +39,13 @@ aaesim::open_source::HorizontalPathTracker::HorizontalPathTracker(
    InitializeStartingIndex();
 }
 
-std::vector<aaesim::open_source::HorizontalPath> aaesim::open_source::HorizontalPathTracker::ExtendHorizontalTrajectory(
-      const std::vector<aaesim::open_source::HorizontalPath> &horizontal_trajectory) {
-
-   // add one more straight segment to end
-   std::vector<aaesim::open_source::HorizontalPath> extended_trajectory;
-   Units::RadiansAngle crs(horizontal_trajectory[0].m_path_course);
-   aaesim::open_source::HorizontalPath hp;
-   hp.m_segment_type = aaesim::open_source::HorizontalPath::SegmentType::STRAIGHT;
-   hp.SetXYPositionMeters(horizontal_trajectory[0].GetXPositionMeters() -
-                                Units::MetersLength(EXTENSION_LENGTH).value() * Units::cos(crs),
-                          horizontal_trajectory[0].GetYPositionMeters() -
-                                Units::MetersLength(EXTENSION_LENGTH).value() * Units::sin(crs));  // meter
-   hp.m_path_length_cumulative_meters = 0;
-   hp.m_path_course = horizontal_trajectory[0].m_path_course;
-   extended_trajectory.push_back(hp);
-
-   // extend all lengths
-   for (auto itr = horizontal_trajectory.begin(); itr < horizontal_trajectory.end(); ++itr) {
-      aaesim::open_source::HorizontalPath element = itr.operator*();
-      element.m_path_length_cumulative_meters += Units::MetersLength(EXTENSION_LENGTH).value();
-      extended_trajectory.push_back(element);
-   }
-
-   // add one more straigt segment to the beginning
-   Units::RadiansAngle crs_back(horizontal_trajectory.back().m_path_course);
-   aaesim::open_source::HorizontalPath hp_beginning;
-   hp_beginning.m_segment_type = aaesim::open_source::HorizontalPath::SegmentType::STRAIGHT;
-   hp_beginning.SetXYPositionMeters(
-         horizontal_trajectory.back().GetXPositionMeters() +
-               Units::MetersLength(EXTENSION_LENGTH).value() * Units::cos(crs_back),
-         horizontal_trajectory.back().GetYPositionMeters() +
-               Units::MetersLength(EXTENSION_LENGTH).value() * Units::sin(crs_back));  // meter
-   hp_beginning.m_path_length_cumulative_meters = horizontal_trajectory.back().m_path_length_cumulative_meters +
-                                                  2 * Units::MetersLength(EXTENSION_LENGTH).value();
-   hp_beginning.m_path_course = horizontal_trajectory.back().m_path_course;
-   extended_trajectory.push_back(hp_beginning);
-
-   return extended_trajectory;
-}
-
 void aaesim::open_source::HorizontalPathTracker::InitializeStartingIndex() {
+   const auto &extended_trajectory = m_path->GetExtendedPath();
 
    switch (m_index_progression_direction) {
       case TrajectoryIndexProgressionDirection::DECREMENTING:
-         if (m_extended_horizontal_trajectory.size() > 1) {
-            UpdateCurrentIndex(m_extended_horizontal_trajectory.size() - 2);
+         if (extended_trajectory.size() > 1) {
+            UpdateCurrentIndex(extended_trajectory.size() - 2);
          } else {
             UpdateCurrentIndex(0);
          }
@@ -122,26 +89,43 @@ bool aaesim::open_source::HorizontalPathTracker::ValidateIndexProgression(
 
 void aaesim::open_source::HorizontalPathTracker::UpdateHorizontalTrajectory(
       const std::vector<aaesim::open_source::HorizontalPath> &horizontal_trajectory) {
-   const auto hp_to_find = m_extended_horizontal_trajectory[m_current_index];
-   m_unmodified_horizontal_trajectory = horizontal_trajectory;
-   m_extended_horizontal_trajectory = ExtendHorizontalTrajectory(horizontal_trajectory);
+   UpdateHorizontalTrajectory(ExtendedHorizontalPath::Of(horizontal_trajectory));
+}
 
-   auto find_result =
-         std::find(m_extended_horizontal_trajectory.begin(), m_extended_horizontal_trajectory.end(), hp_to_find);
-   if (find_result == m_extended_horizontal_trajectory.end()) {
+void aaesim::open_source::HorizontalPathTracker::UpdateHorizontalTrajectory(
+      std::shared_ptr<const ExtendedHorizontalPath> horizontal_trajectory) {
+   const auto previous_path = std::move(m_path);
+   m_path = std::move(horizontal_trajectory);
+   if (m_path == previous_path) {
+      return;
+   }
+
+   // follow the active segment into the new path; usually a slight change leaves it at the same index
+   const auto &extended_trajectory = m_path->GetExtendedPath();
+   if (m_current_index >= previous_path->GetExtendedPath().size()) {
+      InitializeStartingIndex();
+      return;
+   }
+   const auto &hp_to_find = previous_path->GetExtendedPath()[m_current_index];
+   if (m_current_index < extended_trajectory.size() && extended_trajectory[m_current_index] == hp_to_find) {
+      return;
+   }
+   auto find_result = std::find(extended_trajectory.begin(), extended_trajectory.end(), hp_to_find);
+   if (find_result == extended_trajectory.end()) {
       InitializeStartingIndex();
       return;
    }
-   m_current_index = std::distance(m_extended_horizontal_trajectory.begin(), find_result);
+   m_current_index = std::distance(extended_trajectory.begin(), find_result);
 }
 
 bool aaesim::open_source::HorizontalPathTracker::IsPositionOnNode(
       const Units::Length position_x, const Units::Length position_y,
       std::vector<aaesim::open_source::HorizontalPath>::size_type &node_index) {
+   const auto &extended_trajectory = m_path->GetExtendedPath();
    bool is_on_node =
-         Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[m_current_index].GetXPositionMeters()) -
+         Units::abs(Units::MetersLength(extended_trajectory[m_current_index].GetXPositionMeters()) -
                     position_x) < ON_NODE_TOLERANCE &&
-         Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[m_current_index].GetYPositionMeters()) -
+         Units::abs(Units::MetersLength(extended_trajectory[m_current_index].GetYPositionMeters()) -
                     position_y) < ON_NODE_TOLERANCE;
 
    if (!is_on_node) {
@@ -151,10 +135,10 @@ bool aaesim::open_source::HorizontalPathTracker::IsPositionOnNode(
             if (m_current_index > 0) {
                next_index = m_current_index - 1;
                auto x_diff =
-                     Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[next_index].GetXPositionMeters()) -
+                     Units::abs(Units::MetersLength(extended_trajectory[next_index].GetXPositionMeters()) -
                                 position_x);
                auto y_diff =
-                     Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[next_index].GetYPositionMeters()) -
+                     Units::abs(Units::MetersLength(extended_trajectory[next_index].GetYPositionMeters()) -
                                 position_y);
                is_on_node = x_diff < ON_NODE_TOLERANCE && y_diff < ON_NODE_TOLERANCE;
                if (is_on_node) node_index = next_index;
@@ -162,13 +146,13 @@ bool aaesim::open_source::HorizontalPathTracker::IsPositionOnNode(
             break;
 
          case TrajectoryIndexProgressionDirection::INCREMENTING:
-            if (m_current_index < m_extended_horizontal_trajectory.size() - 1) {
+            if (m_current_index < extended_trajectory.size() - 1) {
                next_index = m_current_index + 1;
                auto x_diff =
-                     Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[next_index].GetXPositionMeters()) -
+                     Units::abs(Units::MetersLength(extended_trajectory[next_index].GetXPositionMeters()) -
                                 position_x);
                auto y_diff =
-                     Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[next_index].GetYPositionMeters()) -
+                     Units::abs(Units::MetersLength(extended_trajectory[next_index].GetYPositionMeters()) -
                                 position_y);
                is_on_node = x_diff < ON_NODE_TOLERANCE && y_diff < ON_NODE_TOLERANCE;
                if (is_on_node) node_index = next_index;
@@ -176,11 +160,11 @@ bool aaesim::open_source::HorizontalPathTracker::IsPositionOnNode(
             break;
 
          case TrajectoryIndexProgressionDirection::UNDEFINED:
-            for (auto index = 0; index < m_extended_horizontal_trajectory.size(); ++index) {
+            for (auto index = 0; index < extended_trajectory.size(); ++index) {
                is_on_node =
-                     Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[index].GetXPositionMeters()) -
+                     Units::abs(Units::MetersLength(extended_trajectory[index].GetXPositionMeters()) -
                                 position_x) < ON_NODE_TOLERANCE &&
-                     Units::abs(Units::MetersLength(m_extended_horizontal_trajectory[index].GetYPositionMeters()) -
+                     Units::abs(Units::MetersLength(extended_trajectory[index].GetYPositionMeters()) -
                                 position_y) < ON_NODE_TOLERANCE;
                if (is_on_node) {
                   node_index = index;
@@ -203,10 +187,11 @@ bool aaesim::open_source::HorizontalPathTracker::IsPositionOnNode(
 bool aaesim::open_source::HorizontalPathTracker::IsDistanceAlongPathOnNode(
       const Units::Length distance_along_path,
       std::vector<aaesim::open_source::HorizontalPath>::size_type &node_index) {
+   const auto &extended_trajectory = m_path->GetExtendedPath();
    const Units::Length distance_to_check = distance_along_path + EXTENSION_LENGTH;
    bool is_on_node =
          Units::abs(
-               Units::MetersLength(m_extended_horizontal_trajectory[m_current_index].m_path_length_cumulative_meters) -
+               Units::MetersLength(extended_trajectory[m_current_index].m_path_length_cumulative_meters) -
                distance_to_check) < ON_NODE_TOLERANCE;
 
    if (!is_on_node) {
@@ -216,7 +201,7 @@ bool aaesim::open_source::HorizontalPathTracker::IsDistanceAlongPathOnNode(
             next_index = m_current_index - 1;
             is_on_node =
                   Units::abs(Units::MetersLength(
-                                   m_extended_horizontal_trajectory[next_index].m_path_length_cumulative_meters) -
+                                   extended_trajectory[next_index].m_path_length_cumulative_meters) -
                              distance_to_check) < ON_NODE_TOLERANCE;
             if (is_on_node) node_index = next_index;
             break;
@@ -225,15 +210,15 @@ bool aaesim::open_source::HorizontalPathTracker::IsDistanceAlongPathOnNode(
             next_index = m_current_index + 1;
             is_on_node =
                   Units::abs(Units::MetersLength(
-                                   m_extended_horizontal_trajectory[next_index].m_path_length_cumulative_meters) -
+                                   extended_trajectory[next_index].m_path_length_cumulative_meters) -
                              distance_to_check) < ON_NODE_TOLERANCE;
             if (is_on_node) node_index = next_index;
             break;
 
          case TrajectoryIndexProgressionDirection::UNDEFINED:
-            for (int index = 0; index < m_extended_horizontal_trajectory.size(); ++index) {
+            for (int index = 0; index < extended_trajectory.size(); ++index) {
                is_on_node = Units::abs(Units::MetersLength(
-                                             m_extended_horizontal_trajectory[index].m_path_length_cumulative_meters) -
+                                             extended_trajectory[index].m_path_length_cumulative_meters) -
                                        distance_to_check) < ON_NODE_TOLERANCE;
                if (is_on_node) {
                   node_index = index;
@@ -19,7 +19,10 @@
 
 #include "public/KinematicDescent4DPredictor.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <limits>
 
 #include "public/SimulationTime.h"
 #include "public/Waypoint.h"
@@ -33,6 +36,8 @@ log4cplus::Logger KinematicDescent4DPredictor::m_logger =
 
 const Units::Length KinematicDescent4DPredictor::m_vertical_tolerance_distance = Units::FeetLength(400);
 
+const Units::Time KinematicDescent4DPredictor::m_maximum_reserved_descent_duration = Units::MinutesTime(45);
+
 KinematicDescent4DPredictor::KinematicDescent4DPredictor()
    : m_kinematic_descent_type(CONSTRAINED),
      m_altitude_at_end_of_route(Units::zero()),
@@ -43,7 +48,8 @@ KinematicDescent4DPredictor::KinematicDescent4DPredictor()
      m_const_gamma_cas_er_rad(3.1 * DEGREES_TO_RADIAN),
      m_const_gamma_mach_rad(4.0 * DEGREES_TO_RADIAN),
      m_prediction_too_low(false),
-     m_prediction_too_high(false) {}
+     m_prediction_too_high(false),
+     m_prediction_cache() {}
 
 KinematicDescent4DPredictor::~KinematicDescent4DPredictor() = default;
 
@@ -66,7 +72,19 @@ void KinematicDescent4DPredictor::BuildVerticalPrediction(vector<HorizontalPath>
                                                           const WeatherPrediction &weather_prediction,
                                                           const Units::Length &start_altitude,
                                                           const Units::Length &aircraft_distance_to_go) {
+   const PredictionSettings settings = CapturePredictionSettings(weather_prediction);
+   const std::uint64_t fingerprint =
+         FingerprintPredictionInputs(horizontal_path, precalc_waypoints, weather_prediction);
+   const bool inputs_unchanged =
+         CachedInputsMatch(settings, fingerprint, horizontal_path, precalc_waypoints, weather_prediction);
    m_start_altitude_msl = start_altitude;
+   if (inputs_unchanged && m_prediction_cache.aircraft_distance_to_go == aircraft_distance_to_go &&
+       m_prediction_cache.start_altitude == start_altitude) {
+      LOG4CPLUS_TRACE(m_logger, "Vertical prediction inputs are unchanged; keeping the previous prediction");
+      m_current_trajectory_index = m_vertical_path.along_path_distance_m.size() - 1;
+      return;
+   }
+
    m_prediction_too_low = false;
    m_prediction_too_high = false;
    HorizontalPath start_pos(horizontal_path.back());
@@ -77,9 +95,20 @@ void KinematicDescent4DPredictor::BuildVerticalPrediction(vector<HorizontalPath>
    m_course_calculator =
          DirectionOfFlightCourseCalculator(horizontal_path, TrajectoryIndexProgressionDirection::UNDEFINED);
 
+   const PredictionCheckpoint *resume_from =
+         inputs_unchanged ? FindResumableCheckpoint(aircraft_distance_to_go) : nullptr;
+   m_prediction_cache.valid = false;
    ConstrainedVerticalPath(horizontal_path, precalc_waypoints, m_deceleration_mps, m_const_gamma_cas_term_rad,
                            m_const_gamma_cas_er_rad, m_const_gamma_mach_rad, weather_prediction,
-                           aircraft_distance_to_go);
+                           aircraft_distance_to_go, resume_from);
+
+   if (!inputs_unchanged) {
+      CapturePredictionInputs(settings, fingerprint, horizontal_path, precalc_waypoints, weather_prediction);
+   }
+   m_prediction_cache.aircraft_distance_to_go = aircraft_distance_to_go;
+   m_prediction_cache.start_altitude = start_altitude;
+   m_prediction_cache.untrimmed_path = m_vertical_path;
+   m_prediction_cache.valid = true;
 
    TrimDuplicatesFromVerticalPath();
 
@@ -91,82 +120,115 @@ void KinematicDescent4DPredictor::BuildVerticalPrediction(vector<HorizontalPath>
  *  the segment that contains aircraft position.  If the prediction is above or below the aircraft altitude
  *  by more than the allowable amount at the same distance to go as the aircraft, then do an FPA from the
  *  last waypoint of the prediction that has a positive FPA angle.
+ *
+ *  Segments are appended to m_vertical_path in place. Earlier states of the path are kept as sizes: since
+ *  segments only ever append, an earlier state is a prefix of the path and returning to it is a truncation.
+ *  When resume_from is given, the path up to that checkpoint is reused from the previous prediction.
  */
 void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath> &horizontal_path,
                                                           vector<PrecalcWaypoint> &precalc_waypoints,
                                                           double deceleration, double const_gamma_cas_term,
                                                           double const_gamma_cas_er, double const_gamma_mach,
                                                           const WeatherPrediction &weather_prediction,
-                                                          const Units::Length &aircraft_distance_to_go) {
-   m_vertical_path_waypoint_index.clear();
-   VerticalPath trajTemp;
-   trajTemp.mass_kg.push_back(-1.0);
-   trajTemp.time_to_go_sec.push_back(Units::SecondsTime(m_descent_start_time).value());
-   trajTemp.along_path_distance_m.push_back(0);
-   trajTemp.altitude_m.push_back(Units::MetersLength(m_altitude_at_end_of_route).value());
-   trajTemp.cas_mps.push_back(Units::MetersPerSecondSpeed(m_ias_at_end_of_route).value());
-   trajTemp.mach.push_back(Units::MetersPerSecondSpeed(weather_prediction.GetForecastAtmosphere()->IASToMach(
-                                                             Units::MetersPerSecondSpeed(m_ias_at_end_of_route),
-                                                             Units::MetersLength(m_altitude_at_end_of_route)))
-                                 .value());
-   trajTemp.altitude_rate_mps.push_back(0);
-   trajTemp.true_airspeed.push_back(weather_prediction.CAS2TAS(m_ias_at_end_of_route, m_altitude_at_end_of_route));
-   trajTemp.tas_rate_mps.push_back(0);
-   trajTemp.theta_radians.push_back(0);
-   trajTemp.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-
-   Units::Speed vwpara;
-   Units::Speed vwperp;
-   Units::Speed Vwx, Vwy;
-   Units::UnsignedAngle course = m_course_calculator.GetCourseAtPathEnd();
-   ComputeWindCoefficients(m_altitude_at_end_of_route, Units::RadiansAngle(course), weather_prediction, vwpara, vwperp,
-                           Vwx, Vwy);
-
-   Units::Speed initialgs = sqrt(Units::sqr(weather_prediction.getAtmosphere()->CAS2TAS(m_ias_at_end_of_route,
-                                                                                        m_altitude_at_end_of_route)) -
-                                 Units::sqr(vwperp)) +
-                            vwpara;
-
-   trajTemp.gs_mps.push_back(Units::MetersPerSecondSpeed(initialgs).value());
-   trajTemp.wind_velocity_east.push_back(Vwx);
-   trajTemp.wind_velocity_north.push_back(Vwy);
-
-   trajTemp.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::UNDETERMINED);
-
-   m_vertical_path = trajTemp;
-   m_vertical_path_waypoint_index.push_back(0);  // index for vertical path at first precalc waypoint
-
-   VerticalPath last_state = m_vertical_path;
-   VerticalPath last_waypoint_state = m_vertical_path;
+                                                          const Units::Length &aircraft_distance_to_go,
+                                                          const PredictionCheckpoint *resume_from) {
+   std::size_t last_state;
+   std::size_t last_waypoint_state;
 
    double FPA;
    double alt1 = min(Units::MetersLength(m_transition_altitude_msl).value(),
                      Units::MetersLength(m_cruise_altitude_msl).value());
 
-   if (aircraft_distance_to_go < Units::NauticalMilesLength(1)) {
-      LOG4CPLUS_WARN(m_logger,
-                     "Attempting to perform constrained vertical path with less than 1 nautical mile to go.  "
-                     "Calculating level path, instead.");
-      m_vertical_path = LevelVerticalPath(
-            m_vertical_path,
-            Units::MetersLength(
-                  precalc_waypoints[precalc_waypoints.size() - 1].m_precalc_constraints.constraint_along_path_distance)
-                  .value(),
-            horizontal_path, weather_prediction, aircraft_distance_to_go);
-      return;
+   if (resume_from == nullptr) {
+      m_vertical_path_waypoint_index.clear();
+      m_vertical_path.Clear();
+      m_vertical_path.Reserve(EstimateVerticalPathSize(horizontal_path));
+      m_vertical_path.mass_kg.push_back(-1.0);
+      m_vertical_path.time_to_go_sec.push_back(Units::SecondsTime(m_descent_start_time).value());
+      m_vertical_path.along_path_distance_m.push_back(0);
+      m_vertical_path.altitude_m.push_back(Units::MetersLength(m_altitude_at_end_of_route).value());
+      m_vertical_path.cas_mps.push_back(Units::MetersPerSecondSpeed(m_ias_at_end_of_route).value());
+      m_vertical_path.mach.push_back(
+            Units::MetersPerSecondSpeed(weather_prediction.GetForecastAtmosphere()->IASToMach(
+                                              Units::MetersPerSecondSpeed(m_ias_at_end_of_route),
+                                              Units::MetersLength(m_altitude_at_end_of_route)))
+                  .value());
+      m_vertical_path.altitude_rate_mps.push_back(0);
+      m_vertical_path.true_airspeed.push_back(
+            weather_prediction.CAS2TAS(m_ias_at_end_of_route, m_altitude_at_end_of_route));
+      m_vertical_path.tas_rate_mps.push_back(0);
+      m_vertical_path.theta_radians.push_back(0);
+      m_vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+
+      Units::Speed vwpara;
+      Units::Speed vwperp;
+      Units::Speed Vwx, Vwy;
+      Units::UnsignedAngle course = m_course_calculator.GetCourseAtPathEnd();
+      ComputeWindCoefficients(m_altitude_at_end_of_route, Units::RadiansAngle(course), weather_prediction, vwpara,
+                              vwperp, Vwx, Vwy);
+
+      Units::Speed initialgs =
+            sqrt(Units::sqr(weather_prediction.getAtmosphere()->CAS2TAS(m_ias_at_end_of_route,
+                                                                        m_altitude_at_end_of_route)) -
+                 Units::sqr(vwperp)) +
+            vwpara;
+
+      m_vertical_path.gs_mps.push_back(Units::MetersPerSecondSpeed(initialgs).value());
+      m_vertical_path.wind_velocity_east.push_back(Vwx);
+      m_vertical_path.wind_velocity_north.push_back(Vwy);
+
+      m_vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::UNDETERMINED);
+
+      m_vertical_path_waypoint_index.push_back(0);  // index for vertical path at first precalc waypoint
+
+      last_state = m_vertical_path.Size();
+      last_waypoint_state = m_vertical_path.Size();
+      m_prediction_cache.checkpoints.clear();
+      m_prediction_cache.scanned_path_size = 0;
+      m_prediction_cache.max_along_path_distance_m = -std::numeric_limits<double>::infinity();
+      m_prediction_cache.max_altitude_m = -std::numeric_limits<double>::infinity();
+
+      if (aircraft_distance_to_go < Units::NauticalMilesLength(1)) {
+         LOG4CPLUS_WARN(m_logger,
+                        "Attempting to perform constrained vertical path with less than 1 nautical mile to go.  "
+                        "Calculating level path, instead.");
+         LevelVerticalPath(m_vertical_path,
+                           Units::MetersLength(precalc_waypoints[precalc_waypoints.size() - 1]
+                                                     .m_precalc_constraints.constraint_along_path_distance)
+                                 .value(),
+                           horizontal_path, weather_prediction, aircraft_distance_to_go);
+         return;
+      }
+   } else {
+      // copy first: the checkpoint lives in the list that is about to be trimmed
+      const PredictionCheckpoint checkpoint = *resume_from;
+      LOG4CPLUS_TRACE(m_logger, "Resuming vertical prediction at record " << checkpoint.path_size);
+      m_prediction_cache.checkpoints.erase(m_prediction_cache.checkpoints.begin() +
+                                                 (resume_from - m_prediction_cache.checkpoints.data()),
+                                           m_prediction_cache.checkpoints.end());
+      // swap so that both paths keep their capacity for later predictions
+      std::swap(m_vertical_path, m_prediction_cache.untrimmed_path);
+      m_vertical_path.Truncate(checkpoint.path_size);
+      m_vertical_path_waypoint_index = checkpoint.vertical_path_waypoint_index;
+      last_state = checkpoint.path_size;
+      last_waypoint_state = checkpoint.last_waypoint_state_size;
+      m_prediction_cache.scanned_path_size = checkpoint.path_size;
+      m_prediction_cache.max_along_path_distance_m = checkpoint.max_along_path_distance_m;
+      m_prediction_cache.max_altitude_m = checkpoint.max_altitude_m;
    }
 
    while (m_vertical_path.altitude_m.back() < alt1) {
+      RecordCheckpoint(last_waypoint_state);
       if (m_vertical_path.along_path_distance_m.back() > horizontal_path.back().m_path_length_cumulative_meters) {
          break;
       }
 
       if (m_vertical_path.altitude_m.back() < 10000 * FEET_TO_METERS) {
-         m_vertical_path = ConstantCasVerticalPath(m_vertical_path, alt1, horizontal_path, precalc_waypoints,
-                                                   const_gamma_cas_term, weather_prediction, aircraft_distance_to_go);
+         ConstantCasVerticalPath(m_vertical_path, alt1, horizontal_path, precalc_waypoints, const_gamma_cas_term,
+                                 weather_prediction, aircraft_distance_to_go);
       } else {
-         m_vertical_path = ConstantCasVerticalPath(m_vertical_path, alt1, horizontal_path, precalc_waypoints,
-                                                   const_gamma_cas_er, weather_prediction, aircraft_distance_to_go);
+         ConstantCasVerticalPath(m_vertical_path, alt1, horizontal_path, precalc_waypoints, const_gamma_cas_er,
+                                 weather_prediction, aircraft_distance_to_go);
       }
       if (m_prediction_too_low || m_prediction_too_high) {
          break;
@@ -175,11 +237,12 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
       if (m_precalculated_constraints.violation_flag) {
          if (m_precalculated_constraints.active_flag == ActiveFlagType::SEG_END_LOW_ALT) {
             FPA = atan2((Units::MetersLength(m_precalculated_constraints.constraint_altLow).value() -
-                         last_waypoint_state.altitude_m.back()),
+                         m_vertical_path.altitude_m[last_waypoint_state - 1]),
                         (Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value() -
-                         last_waypoint_state.along_path_distance_m.back()));
-            m_vertical_path = ConstantFpaDecelerationVerticalPath(
-                  last_waypoint_state, Units::MetersLength(m_precalculated_constraints.constraint_altLow).value(),
+                         m_vertical_path.along_path_distance_m[last_waypoint_state - 1]));
+            RollBackVerticalPath(last_waypoint_state);
+            ConstantFpaDecelerationVerticalPath(
+                  m_vertical_path, Units::MetersLength(m_precalculated_constraints.constraint_altLow).value(),
                   m_deceleration_fpa_mps,
                   Units::MetersPerSecondSpeed(m_precalculated_constraints.constraint_speedHi).value(), FPA,
                   horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
@@ -187,33 +250,34 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
                break;
             }
 
-            m_vertical_path = ConstantGeometricFpaVerticalPath(
+            ConstantGeometricFpaVerticalPath(
                   m_vertical_path, Units::MetersLength(m_precalculated_constraints.constraint_altLow).value(), FPA,
                   horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
 
          } else if (m_precalculated_constraints.active_flag == ActiveFlagType::AT_ALT_ON_SPEED) {
             FPA = atan2(Units::MetersLength(m_precalculated_constraints.constraint_altHi).value() -
-                              last_state.altitude_m.back(),
+                              m_vertical_path.altitude_m[last_state - 1],
                         Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value() -
-                              last_state.along_path_distance_m.back());
+                              m_vertical_path.along_path_distance_m[last_state - 1]);
 
             if (FPA > 0.10 * PI / 180.0) {
-               m_vertical_path = ConstantGeometricFpaVerticalPath(
-                     last_state, Units::MetersLength(m_precalculated_constraints.constraint_altHi).value(), FPA,
+               RollBackVerticalPath(last_state);
+               ConstantGeometricFpaVerticalPath(
+                     m_vertical_path, Units::MetersLength(m_precalculated_constraints.constraint_altHi).value(), FPA,
                      horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
                if (m_prediction_too_low || m_prediction_too_high) {
                   break;
                }
             }
 
-            m_vertical_path = LevelVerticalPath(
+            LevelVerticalPath(
                   m_vertical_path,
                   Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value(),
                   horizontal_path, weather_prediction, aircraft_distance_to_go);
 
          } else if (m_precalculated_constraints.active_flag == ActiveFlagType::BELOW_ALT_SLOW) {
             if (m_precalculated_constraints.index < precalc_waypoints.size()) {
-               m_vertical_path = ConstantDecelerationVerticalPath(
+               ConstantDecelerationVerticalPath(
                      m_vertical_path, m_precalculated_constraints.constraint_along_path_distance,
                      m_precalculated_constraints.constraint_altHi, deceleration,
                      Units::MetersPerSecondSpeed(m_precalculated_constraints.constraint_speedHi).value(),
@@ -231,16 +295,17 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
                // If idle-descent acceleration is below low altitude constraint-
                // redo with with a constant FPA deceleration trajectory.
                FPA = atan2((Units::MetersLength(m_precalculated_constraints.constraint_altLow).value() -
-                            last_state.altitude_m.back()),
+                            m_vertical_path.altitude_m[last_state - 1]),
                            (Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value() -
-                            last_state.along_path_distance_m.back()));
+                            m_vertical_path.along_path_distance_m[last_state - 1]));
                Units::DegreesAngle uFPA = Units::RadiansAngle(FPA);
                if (FPA > Units::RadiansAngle(DESCENT_ANGLE_MAX).value())
                   LOG4CPLUS_WARN(m_logger, "prediction FPA is " << uFPA.value() << " which is greater than "
                                                                 << DESCENT_ANGLE_WARNING.value());
                if (uFPA < DESCENT_ANGLE_MAX) {
-                  m_vertical_path = ConstantFpaDecelerationVerticalPath(
-                        last_state, Units::MetersLength(m_precalculated_constraints.constraint_altLow).value(),
+                  RollBackVerticalPath(last_state);
+                  ConstantFpaDecelerationVerticalPath(
+                        m_vertical_path, Units::MetersLength(m_precalculated_constraints.constraint_altLow).value(),
                         m_deceleration_fpa_mps,
                         Units::MetersPerSecondSpeed(m_precalculated_constraints.constraint_speedHi).value(), FPA,
                         horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
@@ -248,7 +313,7 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
             }
          } else if (m_precalculated_constraints.active_flag == ActiveFlagType::AT_ALT_SLOW) {
             if (m_precalculated_constraints.index < precalc_waypoints.size()) {
-               m_vertical_path = LevelDecelerationVerticalPath(
+               LevelDecelerationVerticalPath(
                      m_vertical_path, m_precalculated_constraints.constraint_along_path_distance,
                      m_deceleration_level_mps,
                      Units::MetersPerSecondSpeed(m_precalculated_constraints.constraint_speedHi).value(),
@@ -261,21 +326,21 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
          }
       }
 
-      last_state = m_vertical_path;
+      last_state = m_vertical_path.Size();
 
       if (m_vertical_path.along_path_distance_m.back() >
           Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value()) {
-         if (last_waypoint_state == m_vertical_path) {
+         if (last_waypoint_state == m_vertical_path.Size()) {
             LOG4CPLUS_ERROR(m_logger, "Infinite loop detected...trying to progress");
             return;
          }
 
-         last_waypoint_state = m_vertical_path;
-         while (m_vertical_path_waypoint_index.back() >= last_waypoint_state.altitude_m.size()) {
+         last_waypoint_state = m_vertical_path.Size();
+         while (m_vertical_path_waypoint_index.back() >= last_waypoint_state) {
             m_vertical_path_waypoint_index.pop_back();
          }
-         if (m_vertical_path_waypoint_index.back() < last_waypoint_state.altitude_m.size() - 1) {
-            m_vertical_path_waypoint_index.push_back(last_waypoint_state.altitude_m.size() - 1);
+         if (m_vertical_path_waypoint_index.back() < last_waypoint_state - 1) {
+            m_vertical_path_waypoint_index.push_back(last_waypoint_state - 1);
          }
 
          if (m_vertical_path.altitude_m.back() > m_start_altitude_msl.value()) {
@@ -285,14 +350,14 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
    }
 
    // Constant Mach segment
-   last_state = m_vertical_path;
+   last_state = m_vertical_path.Size();
 
    if (!m_prediction_too_low && !m_prediction_too_high) {
       while ((m_vertical_path.altitude_m.back() < m_start_altitude_msl.value()) &&
              (m_vertical_path.along_path_distance_m.back() <= horizontal_path.back().m_path_length_cumulative_meters)) {
-         m_vertical_path =
-               ConstantMachVerticalPath(last_state, m_start_altitude_msl.value(), horizontal_path, precalc_waypoints,
-                                        const_gamma_mach, weather_prediction, aircraft_distance_to_go);
+         RollBackVerticalPath(last_state);
+         ConstantMachVerticalPath(m_vertical_path, m_start_altitude_msl.value(), horizontal_path, precalc_waypoints,
+                                  const_gamma_mach, weather_prediction, aircraft_distance_to_go);
 
          if (m_prediction_too_low || m_prediction_too_high) {
             break;
@@ -301,9 +366,9 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
          if (m_precalculated_constraints.violation_flag) {
             if (m_precalculated_constraints.active_flag == ActiveFlagType::SEG_END_LOW_ALT) {
                FPA = atan2(Units::MetersLength(m_precalculated_constraints.constraint_altLow).value() -
-                                 last_state.altitude_m.back(),
+                                 m_vertical_path.altitude_m[last_state - 1],
                            Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value() -
-                                 last_state.along_path_distance_m.back());
+                                 m_vertical_path.along_path_distance_m[last_state - 1]);
 
                // if unable to reach low altitude constraint due to excessive FPA, then continue
                // constantMachVerticalPath
@@ -312,12 +377,14 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
                         m_logger,
                         "constrainedVerticalPath prediction in mach segment cannot reach low altitude constraint");
                } else if (FPA > 0.10 * PI / 180.0) {
-                  m_vertical_path = ConstantGeometricFpaVerticalPath(
-                        last_state, Units::MetersLength(m_precalculated_constraints.constraint_altLow).value(), FPA,
-                        horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
+                  RollBackVerticalPath(last_state);
+                  ConstantGeometricFpaVerticalPath(
+                        m_vertical_path, Units::MetersLength(m_precalculated_constraints.constraint_altLow).value(),
+                        FPA, horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
                } else {
-                  m_vertical_path = LevelVerticalPath(
-                        last_state,
+                  RollBackVerticalPath(last_state);
+                  LevelVerticalPath(
+                        m_vertical_path,
                         Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value(),
                         horizontal_path, weather_prediction, aircraft_distance_to_go);
                }
@@ -326,33 +393,35 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
                   break;
                }
 
-               m_vertical_path = LevelVerticalPath(
+               LevelVerticalPath(
                      m_vertical_path,
                      Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value(),
                      horizontal_path, weather_prediction, aircraft_distance_to_go);
             } else if (m_precalculated_constraints.active_flag == ActiveFlagType::AT_ALT_ON_SPEED) {
                FPA = atan2(Units::MetersLength(m_precalculated_constraints.constraint_altHi).value() -
-                                 last_state.altitude_m.back(),
+                                 m_vertical_path.altitude_m[last_state - 1],
                            Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value() -
-                                 last_state.along_path_distance_m.back());
+                                 m_vertical_path.along_path_distance_m[last_state - 1]);
 
                if (FPA > 0.10 * PI / 180.0) {
-                  m_vertical_path = ConstantGeometricFpaVerticalPath(
-                        last_state, Units::MetersLength(m_precalculated_constraints.constraint_altHi).value(), FPA,
-                        horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
+                  RollBackVerticalPath(last_state);
+                  ConstantGeometricFpaVerticalPath(
+                        m_vertical_path, Units::MetersLength(m_precalculated_constraints.constraint_altHi).value(),
+                        FPA, horizontal_path, precalc_waypoints, weather_prediction, aircraft_distance_to_go);
                } else {
-                  m_vertical_path = LevelVerticalPath(
-                        last_state,
+                  RollBackVerticalPath(last_state);
+                  LevelVerticalPath(
+                        m_vertical_path,
                         Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value(),
                         horizontal_path, weather_prediction, aircraft_distance_to_go);
                }
-               m_vertical_path = LevelVerticalPath(
+               LevelVerticalPath(
                      m_vertical_path,
                      Units::MetersLength(m_precalculated_constraints.constraint_along_path_distance).value(),
                      horizontal_path, weather_prediction, aircraft_distance_to_go);
             }
          }
-         last_state = m_vertical_path;
+         last_state = m_vertical_path.Size();
       }
    }
 
@@ -406,8 +475,7 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
          LOG4CPLUS_WARN(m_logger, "Constrained prediction unable to reach aircraft altitude at aircraft position");
       } else {
          TrimVerticalPath(m_vertical_path, start_index);
-         m_vertical_path =
-               ConstantFpaToCurrentPositionVerticalPath(m_vertical_path, horizontal_path, precalc_waypoints,
+         ConstantFpaToCurrentPositionVerticalPath(m_vertical_path, horizontal_path, precalc_waypoints,
                                                         const_gamma_mach, weather_prediction, aircraft_distance_to_go);
       }
 
@@ -433,27 +501,24 @@ void KinematicDescent4DPredictor::ConstrainedVerticalPath(vector<HorizontalPath>
          if (m_precalculated_constraints.violation_flag &&
              (m_precalculated_constraints.active_flag == ActiveFlagType::BELOW_ALT_SLOW ||
               m_precalculated_constraints.active_flag == ActiveFlagType::AT_ALT_SLOW)) {
-            m_vertical_path = LevelDecelerationVerticalPath(
+            LevelDecelerationVerticalPath(
                   m_vertical_path, m_deceleration_level_mps,
                   Units::MetersPerSecondSpeed(m_precalculated_constraints.constraint_speedHi).value(), horizontal_path,
                   weather_prediction, aircraft_distance_to_go);
          }
-         m_vertical_path = LevelVerticalPath(m_vertical_path, horizontal_path.back().m_path_length_cumulative_meters,
+         LevelVerticalPath(m_vertical_path, horizontal_path.back().m_path_length_cumulative_meters,
                                              horizontal_path, weather_prediction, aircraft_distance_to_go);
       }
    }
-   m_vertical_path = LevelVerticalPath(m_vertical_path, horizontal_path.back().m_path_length_cumulative_meters,
+   LevelVerticalPath(m_vertical_path, horizontal_path.back().m_path_length_cumulative_meters,
                                        horizontal_path, weather_prediction, aircraft_distance_to_go);
 }
 
-VerticalPath KinematicDescent4DPredictor::ConstantCasVerticalPath(VerticalPath vertical_path, double altitude_at_end,
-                                                                  vector<HorizontalPath> &horizontal_path,
-                                                                  vector<PrecalcWaypoint> &precalc_waypoints,
-                                                                  double CAS_gamma,
-                                                                  const WeatherPrediction &weather_prediction,
-                                                                  const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result;
-
+void KinematicDescent4DPredictor::ConstantCasVerticalPath(VerticalPath &vertical_path, double altitude_at_end,
+                                                          vector<HorizontalPath> &horizontal_path,
+                                                          vector<PrecalcWaypoint> &precalc_waypoints, double CAS_gamma,
+                                                          const WeatherPrediction &weather_prediction,
+                                                          const Units::Length &aircraft_distance_to_go) {
    const double delta_t = -TIME_STEP_SECONDS;
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
@@ -461,8 +526,6 @@ VerticalPath KinematicDescent4DPredictor::ConstantCasVerticalPath(VerticalPath v
 
    bool bracket_found = false;
 
-   result = vertical_path;
-
    m_precalculated_constraints = FindActiveConstraint(dist, precalc_waypoints);
    m_precalculated_constraints = CheckActiveConstraint(dist, h, v_cas, m_precalculated_constraints,
                                                        Units::MetersLength(m_transition_altitude_msl).value());
@@ -519,22 +582,22 @@ VerticalPath KinematicDescent4DPredictor::ConstantCasVerticalPath(VerticalPath v
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(CAS_gamma);
-      result.gs_mps.push_back(gsnew);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::CONSTANT_CAS);
-      result.mass_kg.push_back(-1.0);
-      curr_time = result.time_to_go_sec.back();
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(CAS_gamma);
+      vertical_path.gs_mps.push_back(gsnew);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::CONSTANT_CAS);
+      vertical_path.mass_kg.push_back(-1.0);
+      curr_time = vertical_path.time_to_go_sec.back();
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
 
       if (!bracket_found && dist_new > Units::MetersLength(aircraft_distance_to_go).value()) {
          bracket_found = true;
@@ -545,7 +608,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantCasVerticalPath(VerticalPath v
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_high = true;
-            return result;
+            return;
          }
          if ((h_new + Units::MetersLength(m_vertical_tolerance_distance).value()) <
              Units::MetersLength(m_start_altitude_msl).value()) {
@@ -553,7 +616,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantCasVerticalPath(VerticalPath v
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_low = true;
-            return result;
+            return;
          }
       }
 
@@ -574,25 +637,18 @@ VerticalPath KinematicDescent4DPredictor::ConstantCasVerticalPath(VerticalPath v
                                                                   << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_high = true;
    }
-
-   return result;
 }
 
-VerticalPath KinematicDescent4DPredictor::ConstantMachVerticalPath(VerticalPath vertical_path, double altitude_at_end,
-                                                                   vector<HorizontalPath> &horizontal_path,
-                                                                   vector<PrecalcWaypoint> &precalc_waypoints,
-                                                                   double gamma,
-                                                                   const WeatherPrediction &weather_prediction,
-                                                                   const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result;
-
+void KinematicDescent4DPredictor::ConstantMachVerticalPath(VerticalPath &vertical_path, double altitude_at_end,
+                                                           vector<HorizontalPath> &horizontal_path,
+                                                           vector<PrecalcWaypoint> &precalc_waypoints, double gamma,
+                                                           const WeatherPrediction &weather_prediction,
+                                                           const Units::Length &aircraft_distance_to_go) {
    const double delta_t = -TIME_STEP_SECONDS;
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
    double h = vertical_path.altitude_m[vertical_path.altitude_m.size() - 1];
 
-   result = vertical_path;
-
    m_precalculated_constraints = FindActiveConstraint(dist, precalc_waypoints);
    m_precalculated_constraints = CheckActiveConstraint(dist, h, v_cas, m_precalculated_constraints,
                                                        Units::MetersLength(m_transition_altitude_msl).value());
@@ -651,24 +707,24 @@ VerticalPath KinematicDescent4DPredictor::ConstantMachVerticalPath(VerticalPath
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(gamma);
-      result.gs_mps.push_back(gsnew);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::CONSTANT_MACH);
-      result.mass_kg.push_back(-1.0);
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-
-      curr_time = result.time_to_go_sec.back();
-
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(gamma);
+      vertical_path.gs_mps.push_back(gsnew);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::CONSTANT_MACH);
+      vertical_path.mass_kg.push_back(-1.0);
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+
+      curr_time = vertical_path.time_to_go_sec.back();
+
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
                                                                    // fabs(delta_t) is 0.5
 
       if (!bracket_found && dist_new > Units::MetersLength(aircraft_distance_to_go).value()) {
@@ -679,7 +735,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantMachVerticalPath(VerticalPath
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_high = true;
-            return result;
+            return;
          }
          if ((h_new + Units::MetersLength(m_vertical_tolerance_distance).value()) <
              Units::MetersLength(m_start_altitude_msl).value()) {
@@ -687,7 +743,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantMachVerticalPath(VerticalPath
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_low = true;
-            return result;
+            return;
          }
       }
 
@@ -710,16 +766,12 @@ VerticalPath KinematicDescent4DPredictor::ConstantMachVerticalPath(VerticalPath
                                                                   << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_high = true;
    }
-
-   return result;
 }
 
-VerticalPath KinematicDescent4DPredictor::ConstantGeometricFpaVerticalPath(
-      VerticalPath vertical_path, double altitude_at_end, double flight_path_angle,
+void KinematicDescent4DPredictor::ConstantGeometricFpaVerticalPath(
+      VerticalPath &vertical_path, double altitude_at_end, double flight_path_angle,
       vector<HorizontalPath> &horizontal_path, vector<PrecalcWaypoint> &precalc_waypoints,
       const WeatherPrediction &weather_prediction, const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result = vertical_path;
-
    const double delta_t = -TIME_STEP_SECONDS;
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
@@ -794,23 +846,23 @@ VerticalPath KinematicDescent4DPredictor::ConstantGeometricFpaVerticalPath(
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(theta_new);
-      result.gs_mps.push_back(gsnew);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::FPA);
-      result.mass_kg.push_back(-1.0);
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-
-      curr_time = result.time_to_go_sec.back();
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(theta_new);
+      vertical_path.gs_mps.push_back(gsnew);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::FPA);
+      vertical_path.mass_kg.push_back(-1.0);
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+
+      curr_time = vertical_path.time_to_go_sec.back();
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
                                                                    // fabs(delta_t) is 0.5
 
       if (!bracket_found && dist_new > Units::MetersLength(aircraft_distance_to_go).value()) {
@@ -821,7 +873,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantGeometricFpaVerticalPath(
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_high = true;
-            return result;
+            return;
          }
          if ((h_new + Units::MetersLength(m_vertical_tolerance_distance).value()) <
              Units::MetersLength(m_start_altitude_msl).value()) {
@@ -829,7 +881,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantGeometricFpaVerticalPath(
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_low = true;
-            return result;
+            return;
          }
       }
 
@@ -846,16 +898,12 @@ VerticalPath KinematicDescent4DPredictor::ConstantGeometricFpaVerticalPath(
                                                                   << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_high = true;
    }
-
-   return result;
 }
 
-VerticalPath KinematicDescent4DPredictor::ConstantFpaDecelerationVerticalPath(
-      VerticalPath vertical_path, double altitude_at_end, double deceleration_mps, double velocity_cas_end,
+void KinematicDescent4DPredictor::ConstantFpaDecelerationVerticalPath(
+      VerticalPath &vertical_path, double altitude_at_end, double deceleration_mps, double velocity_cas_end,
       double flight_path_angle, vector<HorizontalPath> &horizontal_path, vector<PrecalcWaypoint> &precalc_waypoints,
       const WeatherPrediction &weather_prediction, const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result = vertical_path;
-
    const double delta_t = -TIME_STEP_SECONDS;
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
@@ -914,22 +962,22 @@ VerticalPath KinematicDescent4DPredictor::ConstantFpaDecelerationVerticalPath(
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(theta);
-      result.gs_mps.push_back(gs_new);
-      result.mass_kg.push_back(-1.0);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::FPA_DECEL);
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-      curr_time = result.time_to_go_sec.back();
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(theta);
+      vertical_path.gs_mps.push_back(gs_new);
+      vertical_path.mass_kg.push_back(-1.0);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::FPA_DECEL);
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+      curr_time = vertical_path.time_to_go_sec.back();
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
                                                                    // fabs(delta_t) is 0.5
 
       if (!bracket_found && dist_new > Units::MetersLength(aircraft_distance_to_go).value()) {
@@ -940,7 +988,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantFpaDecelerationVerticalPath(
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_high = true;
-            return result;
+            return;
          }
          if ((h_new + Units::MetersLength(m_vertical_tolerance_distance).value()) <
              Units::MetersLength(m_start_altitude_msl).value()) {
@@ -948,7 +996,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantFpaDecelerationVerticalPath(
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_low = true;
-            return result;
+            return;
          }
       }
 
@@ -964,17 +1012,13 @@ VerticalPath KinematicDescent4DPredictor::ConstantFpaDecelerationVerticalPath(
                                                                   << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_high = true;
    }
-
-   return result;
 }
 
-VerticalPath KinematicDescent4DPredictor::LevelDecelerationVerticalPath(VerticalPath vertical_path, double deceleration,
-                                                                        double velocity_cas_end,
-                                                                        vector<HorizontalPath> &horizontal_path,
-                                                                        const WeatherPrediction &weather_prediction,
-                                                                        const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result = vertical_path;
-
+void KinematicDescent4DPredictor::LevelDecelerationVerticalPath(VerticalPath &vertical_path, double deceleration,
+                                                                double velocity_cas_end,
+                                                                vector<HorizontalPath> &horizontal_path,
+                                                                const WeatherPrediction &weather_prediction,
+                                                                const Units::Length &aircraft_distance_to_go) {
    const double delta_t = -TIME_STEP_SECONDS;
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
@@ -1021,23 +1065,23 @@ VerticalPath KinematicDescent4DPredictor::LevelDecelerationVerticalPath(Vertical
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(theta_new);
-      result.gs_mps.push_back(gsnew);
-      result.mass_kg.push_back(-1.0);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::LEVEL_DECEL1);
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-
-      curr_time = result.time_to_go_sec.back();
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(theta_new);
+      vertical_path.gs_mps.push_back(gsnew);
+      vertical_path.mass_kg.push_back(-1.0);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::LEVEL_DECEL1);
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+
+      curr_time = vertical_path.time_to_go_sec.back();
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
                                                                    // fabs(delta_t) is 0.5
 
       dist = dist_new;    // in meters
@@ -1045,25 +1089,21 @@ VerticalPath KinematicDescent4DPredictor::LevelDecelerationVerticalPath(Vertical
       v_cas = v_cas_new;  // in meters per second
    }
 
-   if ((result.along_path_distance_m.back() > Units::MetersLength(aircraft_distance_to_go).value()) &&
+   if ((vertical_path.along_path_distance_m.back() > Units::MetersLength(aircraft_distance_to_go).value()) &&
        ((h + Units::MetersLength(m_vertical_tolerance_distance).value()) <
         Units::MetersLength(m_start_altitude_msl).value())) {
       LOG4CPLUS_TRACE(m_logger, "Prediction alt too low. pred: " << h << " start_alt: "
                                                                  << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_low = true;
    }
-
-   return result;
 }
 
-VerticalPath KinematicDescent4DPredictor::LevelDecelerationVerticalPath(VerticalPath vertical_path,
-                                                                        Units::Length distance_to_go,
-                                                                        double deceleration, double velocity_cas_end,
-                                                                        vector<HorizontalPath> &horizontal_path,
-                                                                        const WeatherPrediction &weather_prediction,
-                                                                        const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result = vertical_path;
-
+void KinematicDescent4DPredictor::LevelDecelerationVerticalPath(VerticalPath &vertical_path,
+                                                                Units::Length distance_to_go, double deceleration,
+                                                                double velocity_cas_end,
+                                                                vector<HorizontalPath> &horizontal_path,
+                                                                const WeatherPrediction &weather_prediction,
+                                                                const Units::Length &aircraft_distance_to_go) {
    const double delta_t = -TIME_STEP_SECONDS;
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
@@ -1112,23 +1152,23 @@ VerticalPath KinematicDescent4DPredictor::LevelDecelerationVerticalPath(Vertical
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(theta_new);
-      result.gs_mps.push_back(gsnew);
-      result.mass_kg.push_back(-1.0);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::LEVEL_DECEL2);
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-
-      curr_time = result.time_to_go_sec.back();
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(theta_new);
+      vertical_path.gs_mps.push_back(gsnew);
+      vertical_path.mass_kg.push_back(-1.0);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::LEVEL_DECEL2);
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+
+      curr_time = vertical_path.time_to_go_sec.back();
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
                                                                    // fabs(delta_t) is 0.5
 
       dist = dist_new;    // in meters
@@ -1136,30 +1176,24 @@ VerticalPath KinematicDescent4DPredictor::LevelDecelerationVerticalPath(Vertical
       v_cas = v_cas_new;  // in meters per second
    }
 
-   if ((result.along_path_distance_m.back() > Units::MetersLength(aircraft_distance_to_go).value()) &&
+   if ((vertical_path.along_path_distance_m.back() > Units::MetersLength(aircraft_distance_to_go).value()) &&
        ((h + Units::MetersLength(m_vertical_tolerance_distance).value()) <
         Units::MetersLength(m_start_altitude_msl).value())) {
       LOG4CPLUS_TRACE(m_logger, "Prediction alt too low. pred: " << h << " start_alt: "
                                                                  << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_low = true;
    }
-
-   return result;
 }
 
-VerticalPath KinematicDescent4DPredictor::LevelVerticalPath(VerticalPath vertical_path, double x_end,
-                                                            vector<HorizontalPath> &horizontal_path,
-                                                            const WeatherPrediction &weather_prediction,
-                                                            const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result;
-
+void KinematicDescent4DPredictor::LevelVerticalPath(VerticalPath &vertical_path, double x_end,
+                                                    vector<HorizontalPath> &horizontal_path,
+                                                    const WeatherPrediction &weather_prediction,
+                                                    const Units::Length &aircraft_distance_to_go) {
    const double delta_t = -TIME_STEP_SECONDS;
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
    double h = vertical_path.altitude_m[vertical_path.altitude_m.size() - 1];
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
 
-   result = vertical_path;
-
    while (fabs(dist) < fabs(x_end)) {
       double v_tas = Units::MetersPerSecondSpeed(weather_prediction.getAtmosphere()->CAS2TAS(
                                                        Units::MetersPerSecondSpeed(v_cas), Units::MetersLength(h)))
@@ -1206,23 +1240,23 @@ VerticalPath KinematicDescent4DPredictor::LevelVerticalPath(VerticalPath vertica
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(theta_new);
-      result.gs_mps.push_back(gsnew);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::LEVEL);
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-      result.mass_kg.push_back(-1.0);
-
-      curr_time = result.time_to_go_sec.back();
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(theta_new);
+      vertical_path.gs_mps.push_back(gsnew);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::LEVEL);
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+      vertical_path.mass_kg.push_back(-1.0);
+
+      curr_time = vertical_path.time_to_go_sec.back();
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
                                                                    // fabs(delta_t) is 0.5
 
       // set values for next iteration of the loop
@@ -1231,24 +1265,20 @@ VerticalPath KinematicDescent4DPredictor::LevelVerticalPath(VerticalPath vertica
       v_cas = v_cas_new;
    }
 
-   if ((result.along_path_distance_m.back() > Units::MetersLength(aircraft_distance_to_go).value()) &&
+   if ((vertical_path.along_path_distance_m.back() > Units::MetersLength(aircraft_distance_to_go).value()) &&
        ((h + Units::MetersLength(m_vertical_tolerance_distance).value()) <
         Units::MetersLength(m_start_altitude_msl).value())) {
       LOG4CPLUS_TRACE(m_logger, "Prediction alt too low. pred: " << h << " start_alt: "
                                                                  << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_low = true;
    }
-
-   return result;
 }
 
 // TODO: change velocity_cas_end to Units
-VerticalPath KinematicDescent4DPredictor::ConstantDecelerationVerticalPath(
-      VerticalPath vertical_path, Units::Length distance_to_go, Units::Length altitude_high, double deceleration,
+void KinematicDescent4DPredictor::ConstantDecelerationVerticalPath(
+      VerticalPath &vertical_path, Units::Length distance_to_go, Units::Length altitude_high, double deceleration,
       double velocity_cas_end, vector<HorizontalPath> &horizontal_path, const WeatherPrediction &weather_prediction,
       const Units::Length &aircraft_distance_to_go) {
-   VerticalPath result = vertical_path;
-
    const double delta_t = -TIME_STEP_SECONDS;
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
@@ -1304,24 +1334,24 @@ VerticalPath KinematicDescent4DPredictor::ConstantDecelerationVerticalPath(
       const double mach = weather_prediction.GetForecastAtmosphere()->IASToMach(Units::MetersPerSecondSpeed(v_cas_new),
                                                                                 Units::MetersLength(h_new));
 
-      result.along_path_distance_m.push_back(dist_new);
-      result.cas_mps.push_back(v_cas_new);
-      result.mach.push_back(mach);
-      result.altitude_m.push_back(h_new);
-      result.altitude_rate_mps.push_back(dh_dt);
-      result.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
-      result.tas_rate_mps.push_back(dv_dt);
-      result.theta_radians.push_back(theta_new);
-      result.gs_mps.push_back(gsnew);
-      result.wind_velocity_east.push_back(Vwx);
-      result.wind_velocity_north.push_back(Vwy);
-      result.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::CONSTANT_DECEL);
-      result.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
-      result.mass_kg.push_back(-1.0);
-
-      curr_time = result.time_to_go_sec.back();
-
-      result.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
+      vertical_path.along_path_distance_m.push_back(dist_new);
+      vertical_path.cas_mps.push_back(v_cas_new);
+      vertical_path.mach.push_back(mach);
+      vertical_path.altitude_m.push_back(h_new);
+      vertical_path.altitude_rate_mps.push_back(dh_dt);
+      vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(v_tas_new));
+      vertical_path.tas_rate_mps.push_back(dv_dt);
+      vertical_path.theta_radians.push_back(theta_new);
+      vertical_path.gs_mps.push_back(gsnew);
+      vertical_path.wind_velocity_east.push_back(Vwx);
+      vertical_path.wind_velocity_north.push_back(Vwy);
+      vertical_path.algorithm_type.push_back(VerticalPath::PredictionAlgorithmType::CONSTANT_DECEL);
+      vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+      vertical_path.mass_kg.push_back(-1.0);
+
+      curr_time = vertical_path.time_to_go_sec.back();
+
+      vertical_path.time_to_go_sec.push_back(curr_time + fabs(delta_t));  // adds last time +0.5 to the end since
                                                                    // fabs(delta_t) is 0.5
 
       if (!bracket_found && dist_new > Units::MetersLength(aircraft_distance_to_go).value()) {
@@ -1332,7 +1362,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantDecelerationVerticalPath(
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_high = true;
-            return result;
+            return;
          }
          if ((h_new + Units::MetersLength(m_vertical_tolerance_distance).value()) <
              Units::MetersLength(m_start_altitude_msl).value()) {
@@ -1340,7 +1370,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantDecelerationVerticalPath(
                                             << h_new
                                             << " start_alt: " << Units::MetersLength(m_start_altitude_msl).value());
             m_prediction_too_low = true;
-            return result;
+            return;
          }
       }
 
@@ -1357,12 +1387,10 @@ VerticalPath KinematicDescent4DPredictor::ConstantDecelerationVerticalPath(
                                                                   << Units::MetersLength(m_start_altitude_msl).value());
       m_prediction_too_high = true;
    }
-
-   return result;
 }
 
-VerticalPath KinematicDescent4DPredictor::ConstantFpaToCurrentPositionVerticalPath(
-      VerticalPath vertical_path, std::vector<HorizontalPath> &horizontal_path,
+void KinematicDescent4DPredictor::ConstantFpaToCurrentPositionVerticalPath(
+      VerticalPath &vertical_path, std::vector<HorizontalPath> &horizontal_path,
       std::vector<PrecalcWaypoint> &precalc_waypoints, double const_gamma_mach,
       const WeatherPrediction &weather_prediction, const Units::Length &aircraft_distance_to_go) {
    Units::Length distance_to_plan = aircraft_distance_to_go;
@@ -1374,8 +1402,7 @@ VerticalPath KinematicDescent4DPredictor::ConstantFpaToCurrentPositionVerticalPa
       distance_to_plan = Units::MetersLength(horizontal_path.back().m_path_length_cumulative_meters);
    }
 
-   VerticalPath result = vertical_path;
-   result.algorithm_type.back() = VerticalPath::FPA_TO_CURRENT_POS;
+   vertical_path.algorithm_type.back() = VerticalPath::FPA_TO_CURRENT_POS;
 
    double dist = vertical_path.along_path_distance_m[vertical_path.along_path_distance_m.size() - 1];
    double v_cas = vertical_path.cas_mps[vertical_path.cas_mps.size() - 1];
@@ -1409,62 +1436,61 @@ VerticalPath KinematicDescent4DPredictor::ConstantFpaToCurrentPositionVerticalPa
          if (fpa > Units::RadiansAngle(DESCENT_ANGLE_MAX).value()) {
             fpa = Units::RadiansAngle(DESCENT_ANGLE_MAX).value();
          }
-         result = ConstantGeometricFpaVerticalPath(result, altitude_at_end, fpa, horizontal_path, precalc_waypoints,
-                                                   weather_prediction, Units::Length(Units::infinity()));
-         result.altitude_m.back() = altitude_at_end;
-         if (result.altitude_m.size() > 2) {
-            result.altitude_m[result.altitude_m.size() - 2] = altitude_at_end;
+         ConstantGeometricFpaVerticalPath(vertical_path, altitude_at_end, fpa, horizontal_path, precalc_waypoints,
+                                          weather_prediction, Units::Length(Units::infinity()));
+         vertical_path.altitude_m.back() = altitude_at_end;
+         if (vertical_path.altitude_m.size() > 2) {
+            vertical_path.altitude_m[vertical_path.altitude_m.size() - 2] = altitude_at_end;
          }
-         h = result.altitude_m.back();
-         dist = result.along_path_distance_m.back();
+         h = vertical_path.altitude_m.back();
+         dist = vertical_path.along_path_distance_m.back();
       }
 
       while (dist < Units::MetersLength(constraints.constraint_along_path_distance).value() && h < altitude_at_end) {
          if (v_cas < Units::MetersPerSecondSpeed(constraints.constraint_speedHi).value()) {
             if (m_prediction_too_high || m_prediction_too_low) {
-               result = ConstantFpaDecelerationVerticalPath(
-                     result, altitude_at_end, m_deceleration_fpa_mps,
+               ConstantFpaDecelerationVerticalPath(
+                     vertical_path, altitude_at_end, m_deceleration_fpa_mps,
                      Units::MetersPerSecondSpeed(constraints.constraint_speedHi).value(), fpa, horizontal_path,
                      precalc_waypoints, weather_prediction, Units::Length(Units::infinity()));
             } else {
-               result = ConstantFpaDecelerationVerticalPath(
-                     result, altitude_at_end, m_deceleration_mps,
+               ConstantFpaDecelerationVerticalPath(
+                     vertical_path, altitude_at_end, m_deceleration_mps,
                      Units::MetersPerSecondSpeed(constraints.constraint_speedHi).value(), fpa, horizontal_path,
                      precalc_waypoints, weather_prediction, Units::Length(Units::infinity()));
             }
          }
-         result = ConstantGeometricFpaVerticalPath(result, altitude_at_end, fpa, horizontal_path, precalc_waypoints,
-                                                   weather_prediction, Units::Length(Units::infinity()));
+         ConstantGeometricFpaVerticalPath(vertical_path, altitude_at_end, fpa, horizontal_path, precalc_waypoints,
+                                          weather_prediction, Units::Length(Units::infinity()));
 
-         dist = result.along_path_distance_m.back();
-         v_cas = result.cas_mps.back();
-         h = result.altitude_m.back();
+         dist = vertical_path.along_path_distance_m.back();
+         v_cas = vertical_path.cas_mps.back();
+         h = vertical_path.altitude_m.back();
          if (dist > Units::MetersLength(aircraft_distance_to_go).value()) {
             break;
          }
       }
       if (h > altitude_at_end && dist < Units::MetersLength(constraints.constraint_along_path_distance).value()) {
-         result = LevelVerticalPath(result, Units::MetersLength(constraints.constraint_along_path_distance).value(),
-                                    horizontal_path, weather_prediction, Units::Length(Units::infinity()));
-         dist = result.along_path_distance_m.back();
-         v_cas = result.cas_mps.back();
-         h = result.altitude_m.back();
+         LevelVerticalPath(vertical_path, Units::MetersLength(constraints.constraint_along_path_distance).value(),
+                           horizontal_path, weather_prediction, Units::Length(Units::infinity()));
+         dist = vertical_path.along_path_distance_m.back();
+         v_cas = vertical_path.cas_mps.back();
+         h = vertical_path.altitude_m.back();
       }
    }
 
    // either at transition altitude or prediction goes past aircraft distance to go
-   if (result.altitude_m.back() < Units::MetersLength(m_start_altitude_msl).value()) {
-      result = ConstantMachVerticalPath(result, m_start_altitude_msl.value(), horizontal_path, precalc_waypoints,
-                                        const_gamma_mach, weather_prediction, Units::Length(Units::infinity()));
+   if (vertical_path.altitude_m.back() < Units::MetersLength(m_start_altitude_msl).value()) {
+      ConstantMachVerticalPath(vertical_path, m_start_altitude_msl.value(), horizontal_path, precalc_waypoints,
+                               const_gamma_mach, weather_prediction, Units::Length(Units::infinity()));
    }
 
    double prediction_dist =
          Units::MetersLength(
                precalc_waypoints[precalc_waypoints.size() - 1].m_precalc_constraints.constraint_along_path_distance)
                .value();
-   result = LevelVerticalPath(result, prediction_dist, horizontal_path, weather_prediction,
-                              Units::Length(Units::infinity()));
-   return result;
+   LevelVerticalPath(vertical_path, prediction_dist, horizontal_path, weather_prediction,
+                     Units::Length(Units::infinity()));
 };
 
 void KinematicDescent4DPredictor::ComputeWindCoefficients(Units::Length altitude, Units::Angle course,
@@ -1487,27 +1513,182 @@ void KinematicDescent4DPredictor::TrimVerticalPath(VerticalPath &vertical_path,
       LOG4CPLUS_WARN(m_logger, "path_index greater than vertical path size: unable to trim it");
       return;
    }
-   vertical_path.along_path_distance_m.erase(vertical_path.along_path_distance_m.begin() + path_index + 1,
-                                             vertical_path.along_path_distance_m.end());
-   vertical_path.algorithm_type.erase(vertical_path.algorithm_type.begin() + path_index + 1,
-                                      vertical_path.algorithm_type.end());
-   vertical_path.altitude_m.erase(vertical_path.altitude_m.begin() + path_index + 1, vertical_path.altitude_m.end());
-   vertical_path.altitude_rate_mps.erase(vertical_path.altitude_rate_mps.begin() + path_index + 1,
-                                         vertical_path.altitude_rate_mps.end());
-   vertical_path.tas_rate_mps.erase(vertical_path.tas_rate_mps.begin() + path_index + 1,
-                                    vertical_path.tas_rate_mps.end());
-   vertical_path.cas_mps.erase(vertical_path.cas_mps.begin() + path_index + 1, vertical_path.cas_mps.end());
-   vertical_path.gs_mps.erase(vertical_path.gs_mps.begin() + path_index + 1, vertical_path.gs_mps.end());
-   vertical_path.mass_kg.erase(vertical_path.mass_kg.begin() + path_index + 1, vertical_path.mass_kg.end());
-   vertical_path.theta_radians.erase(vertical_path.theta_radians.begin() + path_index + 1,
-                                     vertical_path.theta_radians.end());
-   vertical_path.time_to_go_sec.erase(vertical_path.time_to_go_sec.begin() + path_index + 1,
-                                      vertical_path.time_to_go_sec.end());
-   vertical_path.true_airspeed.erase(vertical_path.true_airspeed.begin() + path_index + 1,
-                                     vertical_path.true_airspeed.end());
-   vertical_path.wind_velocity_east.erase(vertical_path.wind_velocity_east.begin() + path_index + 1,
-                                          vertical_path.wind_velocity_east.end());
-   vertical_path.wind_velocity_north.erase(vertical_path.wind_velocity_north.begin() + path_index + 1,
-                                           vertical_path.wind_velocity_north.end());
-   vertical_path.mass_kg.erase(vertical_path.mass_kg.begin() + path_index + 1, vertical_path.mass_kg.end());
+   vertical_path.Truncate(path_index + 1);
+}
+
+std::size_t KinematicDescent4DPredictor::EstimateVerticalPathSize(
+      const std::vector<HorizontalPath> &horizontal_path) const {
+   // The descent is integrated backward from the end of the route one time step at a time, and it does not get
+   // any slower than the speed at the end of the route, so that speed bounds the number of records. The estimate
+   // is also capped at the number of steps in a long descent; headwinds or longer routes simply grow the columns.
+   const double slowest_speed_mps = Units::MetersPerSecondSpeed(m_ias_at_end_of_route).value();
+   if (horizontal_path.empty() || !(slowest_speed_mps > 0)) {
+      return 0;
+   }
+   const double records = horizontal_path.back().m_path_length_cumulative_meters /
+                          (slowest_speed_mps * TIME_STEP_SECONDS);
+   const double maximum_records = Units::SecondsTime(m_maximum_reserved_descent_duration).value() / TIME_STEP_SECONDS;
+   return static_cast<std::size_t>(std::min(1.25 * records, maximum_records)) + 1;
+}
+
+void KinematicDescent4DPredictor::RollBackVerticalPath(std::size_t size) {
+   // points about to be discarded were still generated, so they count toward the checkpoint extents
+   ScanGeneratedPath(size);
+   m_vertical_path.Truncate(size);
+   m_prediction_cache.scanned_path_size = std::min(m_prediction_cache.scanned_path_size, size);
+}
+
+void KinematicDescent4DPredictor::ScanGeneratedPath(std::size_t begin) {
+   for (auto ix = std::max(begin, m_prediction_cache.scanned_path_size); ix < m_vertical_path.Size(); ++ix) {
+      m_prediction_cache.max_along_path_distance_m =
+            std::max(m_prediction_cache.max_along_path_distance_m, m_vertical_path.along_path_distance_m[ix]);
+      m_prediction_cache.max_altitude_m = std::max(m_prediction_cache.max_altitude_m, m_vertical_path.altitude_m[ix]);
+   }
+}
+
+void KinematicDescent4DPredictor::RecordCheckpoint(std::size_t last_waypoint_state_size) {
+   ScanGeneratedPath(m_prediction_cache.scanned_path_size);
+   m_prediction_cache.scanned_path_size = m_vertical_path.Size();
+
+   PredictionCheckpoint checkpoint;
+   checkpoint.path_size = m_vertical_path.Size();
+   checkpoint.last_waypoint_state_size = last_waypoint_state_size;
+   checkpoint.vertical_path_waypoint_index = m_vertical_path_waypoint_index;
+   checkpoint.max_along_path_distance_m = m_prediction_cache.max_along_path_distance_m;
+   checkpoint.max_altitude_m = m_prediction_cache.max_altitude_m;
+   m_prediction_cache.checkpoints.push_back(std::move(checkpoint));
+}
+
+const KinematicDescent4DPredictor::PredictionCheckpoint *KinematicDescent4DPredictor::FindResumableCheckpoint(
+      const Units::Length &aircraft_distance_to_go) const {
+   if (aircraft_distance_to_go < Units::NauticalMilesLength(1)) {
+      return nullptr;
+   }
+
+   // Up to a checkpoint, the aircraft's distance to go and altitude only matter through the "prediction too
+   // high/low" tests, which need a point beyond the aircraft, and the start altitude test, which needs a point
+   // above it. If no point generated so far is either, the new aircraft state would have built the same path.
+   const double distance_to_go_m = Units::MetersLength(aircraft_distance_to_go).value();
+   const double start_altitude_m = Units::MetersLength(m_start_altitude_msl).value();
+   const PredictionCheckpoint *resumable = nullptr;
+   for (const auto &checkpoint : m_prediction_cache.checkpoints) {
+      if (checkpoint.max_along_path_distance_m > distance_to_go_m || checkpoint.max_altitude_m > start_altitude_m) {
+         break;
+      }
+      resumable = &checkpoint;
+   }
+   return resumable;
+}
+
+KinematicDescent4DPredictor::PredictionSettings KinematicDescent4DPredictor::CapturePredictionSettings(
+      const WeatherPrediction &weather_prediction) const {
+   PredictionSettings settings;
+   settings.forecast_atmosphere = weather_prediction.getAtmosphere();
+   if (settings.forecast_atmosphere != nullptr) {
+      settings.forecast_sea_level_temperature = settings.forecast_atmosphere->GetSeaLevelTemperature();
+   }
+   settings.predictor_atmosphere = m_atmosphere;
+   if (settings.predictor_atmosphere != nullptr) {
+      settings.predictor_sea_level_temperature = settings.predictor_atmosphere->GetSeaLevelTemperature();
+   }
+   settings.altitude_at_end_of_route = m_altitude_at_end_of_route;
+   settings.ias_at_end_of_route = m_ias_at_end_of_route;
+   settings.cruise_altitude = m_cruise_altitude_msl;
+   settings.transition_altitude = m_transition_altitude_msl;
+   settings.transition_ias = m_transition_ias;
+   settings.transition_mach = m_transition_mach;
+   settings.descent_start_time = m_descent_start_time;
+   return settings;
+}
+
+namespace {
+// FNV-1a over the bytes of each value
+class Fingerprint {
+  public:
+   template <typename T>
+   void Add(const T &value) {
+      unsigned char bytes[sizeof(T)];
+      std::memcpy(bytes, &value, sizeof(T));
+      for (const unsigned char byte : bytes) {
+         m_hash ^= byte;
+         m_hash *= 0x100000001b3ULL;
+      }
+   }
+   std::uint64_t Get() const { return m_hash; }
+
+  private:
+   std::uint64_t m_hash{0xcbf29ce484222325ULL};
+};
+
+void AddWindStack(Fingerprint &fingerprint, const WindStack &wind_stack) {
+   fingerprint.Add(wind_stack.GetMinRow());
+   fingerprint.Add(wind_stack.GetMaxRow());
+   // WindStack::operator== ignores the rows of a one-row stack
+   if (wind_stack.GetMinRow() == wind_stack.GetMaxRow()) {
+      return;
+   }
+   for (auto ix = wind_stack.GetMinRow(); ix <= wind_stack.GetMaxRow(); ++ix) {
+      fingerprint.Add(wind_stack.GetAltitude(ix).value());
+      fingerprint.Add(wind_stack.GetSpeed(ix).value());
+   }
+}
+}  // namespace
+
+std::uint64_t KinematicDescent4DPredictor::FingerprintPredictionInputs(
+      const std::vector<HorizontalPath> &horizontal_path, const std::vector<PrecalcWaypoint> &precalc_waypoints,
+      const WeatherPrediction &weather_prediction) {
+   // Only values that the equality tests compare go in, so equal inputs always have equal fingerprints. Other
+   // fields are left to the full comparison that follows a match.
+   Fingerprint fingerprint;
+   fingerprint.Add(horizontal_path.size());
+   for (const auto &path_point : horizontal_path) {
+      fingerprint.Add(path_point.GetXPositionMeters());
+      fingerprint.Add(path_point.GetYPositionMeters());
+      fingerprint.Add(path_point.m_segment_type);
+   }
+   fingerprint.Add(precalc_waypoints.size());
+   for (const auto &waypoint : precalc_waypoints) {
+      fingerprint.Add(Units::MetersLength(waypoint.m_leg_length).value());
+      fingerprint.Add(waypoint.m_x_pos_meters.value());
+      fingerprint.Add(waypoint.m_y_pos_meters.value());
+   }
+   AddWindStack(fingerprint, weather_prediction.east_west());
+   AddWindStack(fingerprint, weather_prediction.north_south());
+   return fingerprint.Get();
+}
+
+bool KinematicDescent4DPredictor::CachedInputsMatch(const PredictionSettings &settings, std::uint64_t fingerprint,
+                                                    const std::vector<HorizontalPath> &horizontal_path,
+                                                    const std::vector<PrecalcWaypoint> &precalc_waypoints,
+                                                    const WeatherPrediction &weather_prediction) const {
+   const PredictionInputs &cached = m_prediction_cache.inputs;
+   return m_prediction_cache.valid && cached.fingerprint == fingerprint && cached.settings == settings &&
+          cached.east_west_wind == weather_prediction.east_west() &&
+          cached.north_south_wind == weather_prediction.north_south() &&
+          cached.precalc_waypoints == precalc_waypoints && cached.horizontal_path == horizontal_path;
+}
+
+void KinematicDescent4DPredictor::CapturePredictionInputs(const PredictionSettings &settings,
+                                                          std::uint64_t fingerprint,
+                                                          const std::vector<HorizontalPath> &horizontal_path,
+                                                          const std::vector<PrecalcWaypoint> &precalc_waypoints,
+                                                          const WeatherPrediction &weather_prediction) {
+   PredictionInputs &cached = m_prediction_cache.inputs;
+   cached.settings = settings;
+   cached.fingerprint = fingerprint;
+   cached.horizontal_path = horizontal_path;
+   cached.precalc_waypoints = precalc_waypoints;
+   cached.east_west_wind = weather_prediction.east_west();
+   cached.north_south_wind = weather_prediction.north_south();
+}
+
+bool KinematicDescent4DPredictor::PredictionSettings::operator==(const PredictionSettings &obj) const {
+   return forecast_atmosphere == obj.forecast_atmosphere &&
+          forecast_sea_level_temperature == obj.forecast_sea_level_temperature &&
+          predictor_atmosphere == obj.predictor_atmosphere &&
+          predictor_sea_level_temperature == obj.predictor_sea_level_temperature &&
+          altitude_at_end_of_route == obj.altitude_at_end_of_route && ias_at_end_of_route == obj.ias_at_end_of_route &&
+          cruise_altitude == obj.cruise_altitude && transition_altitude == obj.transition_altitude &&
+          transition_ias == obj.transition_ias && transition_mach == obj.transition_mach &&
+          descent_start_time == obj.descent_start_time;
 }
@@ -21,24 +21,76 @@
 
 using namespace aaesim::open_source;
 
-EarthModel::GeodeticPosition LegacyPositionEstimator::ComputeLatLon(const EquationsOfMotionState &eqm_state) const {
+EarthModel::LocalPositionEnu LegacyPositionEstimator::ToLocalPosition(const EquationsOfMotionState &eqm_state) {
    auto local_position = EarthModel::LocalPositionEnu{};
    local_position.x = eqm_state.enu_x;
    local_position.y = eqm_state.enu_y;
    local_position.z = eqm_state.altitude_msl;
+   return local_position;
+}
+
+EarthModel::GeodeticPosition LegacyPositionEstimator::ComputeLatLon(const EquationsOfMotionState &eqm_state) {
    EarthModel::GeodeticPosition geodetic_position;
-   m_tangent_plane_sequence->ConvertLocalToGeodetic(local_position, geodetic_position);
+   m_tangent_plane_sequence->ConvertLocalToGeodetic(ToLocalPosition(eqm_state), geodetic_position,
+                                                    m_closest_tangent_plane_hint);
    geodetic_position.altitude = eqm_state.altitude_msl;
    return geodetic_position;
 }
 
+EarthModel::GeodeticPosition LegacyPositionEstimator::GetLastPosition() {
+   if (m_last_position_is_deferred) {
+      const auto last_deferred_position = m_last_deferred_position.lock();
+      if (last_deferred_position) {
+         m_last_resolved_position = last_deferred_position->GetPosition();
+      } else {
+         m_tangent_plane_sequence->ConvertLocalToGeodetic(m_last_local_position, m_last_resolved_position,
+                                                          m_closest_tangent_plane_hint);
+         m_last_resolved_position.altitude = m_last_local_position.z;
+      }
+      m_last_position_is_deferred = false;
+   }
+   return m_last_resolved_position;
+}
+
 void LegacyPositionEstimator::ComputePosition(const SimulationTime &simtime, const EquationsOfMotionState &eqm_state,
                                               const EquationsOfMotionStateDeriv &eqm_state_derivative,
                                               EarthModel::GeodeticPosition &position, LatLonDerivative &position_rate) {
+   const EarthModel::GeodeticPosition last_position = GetLastPosition();
    position = ComputeLatLon(eqm_state);
    position_rate.latitude_time_derivative =
-         (position.latitude - m_last_resolved_position.latitude) / simtime.GetSimulationTimeStep();
+         (position.latitude - last_position.latitude) / simtime.GetSimulationTimeStep();
    position_rate.longitude_time_derivative =
-         (position.longitude - m_last_resolved_position.longitude) / simtime.GetSimulationTimeStep();
+         (position.longitude - last_position.longitude) / simtime.GetSimulationTimeStep();
    m_last_resolved_position = position;
 }
+
+std::shared_ptr<const DeferredGeodeticPosition> LegacyPositionEstimator::DeferPosition(
+      const SimulationTime &simtime, const EquationsOfMotionState &eqm_state,
+      const EquationsOfMotionStateDeriv &eqm_state_derivative) {
+   // The rate needs the previous position too. It is taken from the previous step when that is already known or
+   // already resolved, which is the usual case when states are written in order; otherwise it is converted again.
+   auto deferred_position = std::make_shared<const DeferredGeodeticPosition>(
+         [tangent_plane_sequence = m_tangent_plane_sequence, local_position = ToLocalPosition(eqm_state),
+          last_position_is_known = !m_last_position_is_deferred, last_position = m_last_resolved_position,
+          last_local_position = m_last_local_position, last_deferred_position = m_last_deferred_position,
+          closest_tangent_plane_hint = m_closest_tangent_plane_hint, time_step = simtime.GetSimulationTimeStep()](
+               EarthModel::GeodeticPosition &position, LatLonDerivative &position_rate) mutable {
+            if (!last_position_is_known) {
+               const auto last_deferred = last_deferred_position.lock();
+               if (last_deferred && last_deferred->IsResolved()) {
+                  last_position = last_deferred->GetPosition();
+               } else {
+                  tangent_plane_sequence->ConvertLocalToGeodetic(last_local_position, last_position,
+                                                                 closest_tangent_plane_hint);
+               }
+            }
+            tangent_plane_sequence->ConvertLocalToGeodetic(local_position, position, closest_tangent_plane_hint);
+            position.altitude = local_position.z;
+            position_rate.latitude_time_derivative = (position.latitude - last_position.latitude) / time_step;
+            position_rate.longitude_time_derivative = (position.longitude - last_position.longitude) / time_step;
+         });
+   m_last_position_is_deferred = true;
+   m_last_local_position = ToLocalPosition(eqm_state);
+   m_last_deferred_position = deferred_position;
+   return deferred_position;
+}
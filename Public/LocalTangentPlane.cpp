@@ -30,9 +30,8 @@
 using namespace std;
 
 log4cplus::Logger LocalTangentPlane::logger = log4cplus::Logger::getInstance(LOG4CPLUS_TEXT("LocalTangentPlane"));
-const double LocalTangentPlane::identity3x3[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
-const double yzx[3][3] = {{0, 0, 1}, {1, 0, 0}, {0, 1, 0}};
-const double zxy[3][3] = {{0, 1, 0}, {0, 0, 1}, {1, 0, 0}};
+constexpr aaesim::open_source::Mat3 yzx({{{0, 0, 1}, {1, 0, 0}, {0, 1, 0}}});
+constexpr aaesim::open_source::Mat3 zxy({{{0, 1, 0}, {0, 0, 1}, {1, 0, 0}}});
 
 LocalTangentPlane::LocalTangentPlane(const EarthModel *earthModel,
                                      const EarthModel::AbsolutePositionEcef &ecefPointOfTangency,
@@ -40,28 +39,19 @@ LocalTangentPlane::LocalTangentPlane(const EarthModel *earthModel,
    : earthModel(earthModel),
      pointOfTangencyEcef(ecefPointOfTangency),
      pointOfTangencyEnu(enuPointOfTangency),
-     m_ecef_to_enu(DMatrix((double **)&identity3x3, 0, 2, 0, 2)),
-     m_enu_to_ecef(DMatrix((double **)&identity3x3, 0, 2, 0, 2)) {}
+     m_ecef_to_enu(aaesim::open_source::Mat3::Identity()),
+     m_enu_to_ecef(aaesim::open_source::Mat3::Identity()) {}
 
 LocalTangentPlane::~LocalTangentPlane() {}
 
 void LocalTangentPlane::InitializeRotationForGeodeticOrigin() {
-   m_ecef_to_enu = DMatrix((double **)zxy, 0, 2, 0, 2);
-   m_enu_to_ecef = DMatrix((double **)yzx, 0, 2, 0, 2);
+   m_ecef_to_enu = zxy;
+   m_enu_to_ecef = yzx;
 }
 
 void LocalTangentPlane::RotateEnuFrame(const double x, const double y, const double z, const Units::Angle theta) {
-   DMatrix &r = CreateRotationMatrix(x, y, z, theta);
-   DMatrix &ecefToEnu1 = m_ecef_to_enu * r;
-   m_ecef_to_enu = ecefToEnu1;
-   delete &r;
-   delete &ecefToEnu1;
-
-   DMatrix &rInv = CreateRotationMatrix(x, y, z, -theta);
-   DMatrix &enuToEcef1 = rInv * m_enu_to_ecef;
-   m_enu_to_ecef = enuToEcef1;
-   delete &rInv;
-   delete &enuToEcef1;
+   m_ecef_to_enu = m_ecef_to_enu * CreateRotationMatrix(x, y, z, theta);
+   m_enu_to_ecef = CreateRotationMatrix(x, y, z, -theta) * m_enu_to_ecef;
 }
 
 void LocalTangentPlane::ConvertGeodeticToAbsolute(const EarthModel::GeodeticPosition &geo,
@@ -134,6 +124,68 @@ void LocalTangentPlane::ConvertLocalToGeodetic(const EarthModel::LocalPositionEn
    earthModel->ConvertAbsoluteToGeodetic(temp, geo);
 }
 
+namespace {
+void CheckBatchSizes(const EarthModel::CartesianArrays<const double> &from,
+                     const EarthModel::CartesianArrays<double> &to) {
+   if (!from.IsConsistent() || !to.IsConsistent() || from.size() != to.size()) {
+      throw logic_error("Batch ENU/ECEF conversion requires arrays of the same size");
+   }
+}
+
+// Applies to = rotation * (from - from_origin) + to_origin with the rotation held in locals, one position at a time
+void RotateAndTranslate(const aaesim::open_source::Mat3 &rotation, const double from_origin[3],
+                        const double to_origin[3], const EarthModel::CartesianArrays<const double> &from,
+                        const EarthModel::CartesianArrays<double> &to) {
+   const double r00 = rotation[0][0], r01 = rotation[0][1], r02 = rotation[0][2];
+   const double r10 = rotation[1][0], r11 = rotation[1][1], r12 = rotation[1][2];
+   const double r20 = rotation[2][0], r21 = rotation[2][1], r22 = rotation[2][2];
+   for (std::size_t i = 0; i < from.size(); ++i) {
+      const double x1 = from.x_meters[i] - from_origin[0];
+      const double y1 = from.y_meters[i] - from_origin[1];
+      const double z1 = from.z_meters[i] - from_origin[2];
+      to.x_meters[i] = (r00 * x1 + r01 * y1 + r02 * z1) + to_origin[0];
+      to.y_meters[i] = (r10 * x1 + r11 * y1 + r12 * z1) + to_origin[1];
+      to.z_meters[i] = (r20 * x1 + r21 * y1 + r22 * z1) + to_origin[2];
+   }
+}
+}  // namespace
+
+void LocalTangentPlane::ConvertLocalToAbsolute(const EarthModel::CartesianArrays<const double> &enu,
+                                               const EarthModel::CartesianArrays<double> &ecef) const {
+   CheckBatchSizes(enu, ecef);
+   const double enu_origin[3] = {Units::MetersLength(pointOfTangencyEnu.x).value(),
+                                 Units::MetersLength(pointOfTangencyEnu.y).value(),
+                                 Units::MetersLength(pointOfTangencyEnu.z).value()};
+   const double ecef_origin[3] = {pointOfTangencyEcef.x.value(), pointOfTangencyEcef.y.value(),
+                                  pointOfTangencyEcef.z.value()};
+   RotateAndTranslate(m_enu_to_ecef, enu_origin, ecef_origin, enu, ecef);
+}
+
+void LocalTangentPlane::ConvertAbsoluteToLocal(const EarthModel::CartesianArrays<const double> &ecef,
+                                               const EarthModel::CartesianArrays<double> &enu) const {
+   CheckBatchSizes(ecef, enu);
+   const double ecef_origin[3] = {pointOfTangencyEcef.x.value(), pointOfTangencyEcef.y.value(),
+                                  pointOfTangencyEcef.z.value()};
+   const double enu_origin[3] = {Units::MetersLength(pointOfTangencyEnu.x).value(),
+                                 Units::MetersLength(pointOfTangencyEnu.y).value(),
+                                 Units::MetersLength(pointOfTangencyEnu.z).value()};
+   RotateAndTranslate(m_ecef_to_enu, ecef_origin, enu_origin, ecef, enu);
+}
+
+void LocalTangentPlane::ConvertGeodeticToLocal(const EarthModel::GeodeticArrays<const double> &geo,
+                                               const EarthModel::CartesianArrays<double> &enu) const {
+   std::vector<double> x(geo.size()), y(geo.size()), z(geo.size());
+   earthModel->ConvertGeodeticToAbsolute(geo, EarthModel::CartesianArrays<double>{x, y, z});
+   ConvertAbsoluteToLocal(EarthModel::CartesianArrays<const double>{x, y, z}, enu);
+}
+
+void LocalTangentPlane::ConvertLocalToGeodetic(const EarthModel::CartesianArrays<const double> &enu,
+                                               const EarthModel::GeodeticArrays<double> &geo) const {
+   std::vector<double> x(enu.size()), y(enu.size()), z(enu.size());
+   ConvertLocalToAbsolute(enu, EarthModel::CartesianArrays<double>{x, y, z});
+   earthModel->ConvertAbsoluteToGeodetic(EarthModel::CartesianArrays<const double>{x, y, z}, geo);
+}
+
 const EarthModel::LocalPositionEnu &LocalTangentPlane::getPointOfTangencyEnu() const { return pointOfTangencyEnu; }
 
 const EarthModel::AbsolutePositionEcef &LocalTangentPlane::getPointOfTangencyEcef() const {
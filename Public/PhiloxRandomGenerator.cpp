@@ -0,0 +1,154 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "public/PhiloxRandomGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+const std::uint32_t PHILOX_M0 = 0xD2511F53;
+const std::uint32_t PHILOX_M1 = 0xCD9E8D57;
+const std::uint32_t PHILOX_W0 = 0x9E3779B9;
+const std::uint32_t PHILOX_W1 = 0xBB67AE85;
+const int PHILOX_ROUNDS = 10;
+
+// keys used to derive split streams are kept apart from the keys that produce samples
+const std::uint64_t SPLIT_KEY_MASK = 0x5851F42D4C957F2DULL;
+
+const std::size_t GAUSSIAN_BATCH_SIZE = 64;
+
+inline std::uint32_t Low(std::uint64_t value) { return static_cast<std::uint32_t>(value); }
+inline std::uint32_t High(std::uint64_t value) { return static_cast<std::uint32_t>(value >> 32); }
+inline std::uint64_t Join(std::uint32_t high, std::uint32_t low) {
+   return (static_cast<std::uint64_t>(high) << 32) | low;
+}
+}  // namespace
+
+PhiloxRandomGenerator::PhiloxRandomGenerator(std::uint64_t seed, std::uint64_t stream)
+   : m_key(seed), m_stream(stream) {}
+
+PhiloxRandomGenerator::Block PhiloxRandomGenerator::Philox(Block counter, std::uint64_t key) {
+   std::uint32_t key0 = Low(key), key1 = High(key);
+   for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+      const std::uint64_t product0 = static_cast<std::uint64_t>(PHILOX_M0) * counter[0];
+      const std::uint64_t product1 = static_cast<std::uint64_t>(PHILOX_M1) * counter[2];
+      counter = {High(product1) ^ counter[1] ^ key0, Low(product1), High(product0) ^ counter[3] ^ key1,
+                 Low(product0)};
+      key0 += PHILOX_W0;
+      key1 += PHILOX_W1;
+   }
+   return counter;
+}
+
+double PhiloxRandomGenerator::ToUnitInterval(std::uint32_t high, std::uint32_t low) {
+   // 53 random bits centred in their interval, so neither 0 nor 1 is returned
+   return (static_cast<double>(Join(high, low) >> 11) + 0.5) * 0x1.0p-53;
+}
+
+PhiloxRandomGenerator PhiloxRandomGenerator::Split(std::uint64_t stream_id) const {
+   const Block derived =
+         Philox({Low(stream_id), High(stream_id), Low(m_stream), High(m_stream)}, m_key ^ SPLIT_KEY_MASK);
+   return PhiloxRandomGenerator(Join(derived[1], derived[0]), Join(derived[3], derived[2]));
+}
+
+void PhiloxRandomGenerator::Discard(std::uint64_t number_of_blocks) {
+   m_block_counter += number_of_blocks;
+   m_buffer_index = m_buffer.size();
+}
+
+void PhiloxRandomGenerator::Refill() {
+   const Block block =
+         Philox({Low(m_block_counter), High(m_block_counter), Low(m_stream), High(m_stream)}, m_key);
+   ++m_block_counter;
+   m_buffer = {ToUnitInterval(block[0], block[1]), ToUnitInterval(block[2], block[3])};
+   m_buffer_index = 0;
+}
+
+double PhiloxRandomGenerator::UniformSample() {
+   if (m_buffer_index == m_buffer.size()) {
+      Refill();
+   }
+   return m_buffer[m_buffer_index++];
+}
+
+double PhiloxRandomGenerator::GaussianSample() {
+   const double u1 = UniformSample();
+   const double u2 = UniformSample();
+   return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+double PhiloxRandomGenerator::TruncatedGaussianSample(double max_standard_deviation) {
+   double value = GaussianSample();
+   while (value > max_standard_deviation || value < -max_standard_deviation) {
+      value = GaussianSample();
+   }
+   return value;
+}
+
+double PhiloxRandomGenerator::RayleighSample() {
+   const double u1 = UniformSample();
+   return (std::sqrt(-2.0 * std::log(u1)) - 1.253) / std::sqrt(0.429);
+}
+
+double PhiloxRandomGenerator::LaplaceSample() {
+   double err = -std::log(UniformSample());
+   if (UniformSample() < 0.5) {
+      err = -err;
+   }
+   return err;
+}
+
+void PhiloxRandomGenerator::FillUniform(std::span<double> samples) {
+   std::size_t n = 0;
+   while (n < samples.size() && m_buffer_index < m_buffer.size()) {
+      samples[n++] = m_buffer[m_buffer_index++];
+   }
+   // whole blocks are independent of each other, so this loop has no carried dependency
+   const std::size_t whole_block_end = n + (samples.size() - n) / 2 * 2;
+   const std::uint64_t first_block = m_block_counter;
+   for (std::size_t i = n; i < whole_block_end; i += 2) {
+      const std::uint64_t block_counter = first_block + (i - n) / 2;
+      const Block block =
+            Philox({Low(block_counter), High(block_counter), Low(m_stream), High(m_stream)}, m_key);
+      samples[i] = ToUnitInterval(block[0], block[1]);
+      samples[i + 1] = ToUnitInterval(block[2], block[3]);
+   }
+   m_block_counter += (whole_block_end - n) / 2;
+   for (n = whole_block_end; n < samples.size(); ++n) {
+      samples[n] = UniformSample();
+   }
+}
+
+void PhiloxRandomGenerator::FillGaussian(std::span<double> samples) {
+   std::array<double, 2 * GAUSSIAN_BATCH_SIZE> uniforms;
+   for (std::size_t first = 0; first < samples.size(); first += GAUSSIAN_BATCH_SIZE) {
+      const std::size_t count = std::min(GAUSSIAN_BATCH_SIZE, samples.size() - first);
+      FillUniform(std::span<double>(uniforms.data(), 2 * count));
+      for (std::size_t i = 0; i < count; ++i) {
+         samples[first + i] = std::sqrt(-2.0 * std::log(uniforms[2 * i])) * std::cos(2.0 * M_PI * uniforms[2 * i + 1]);
+      }
+   }
+}
+
+void PhiloxRandomGenerator::FillTruncatedGaussian(std::span<double> samples, double max_standard_deviation) {
+   // rejection makes the number of uniform samples used unknown in advance
+   std::generate(samples.begin(), samples.end(),
+                 [this, max_standard_deviation]() { return TruncatedGaussianSample(max_standard_deviation); });
+}
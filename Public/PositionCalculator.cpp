@@ -29,6 +29,10 @@ PositionCalculator::PositionCalculator(const std::vector<HorizontalPath> &horizo
                                        TrajectoryIndexProgressionDirection expected_index_progression)
    : DirectionOfFlightCourseCalculator(horizontal_path, expected_index_progression) {}
 
+PositionCalculator::PositionCalculator(std::shared_ptr<const ExtendedHorizontalPath> horizontal_path,
+                                       TrajectoryIndexProgressionDirection expected_index_progression)
+   : DirectionOfFlightCourseCalculator(std::move(horizontal_path), expected_index_progression) {}
+
 PositionCalculator::PositionCalculator() : DirectionOfFlightCourseCalculator() {}
 
 PositionCalculator::~PositionCalculator() = default;
@@ -37,7 +41,7 @@ bool PositionCalculator::CalculatePositionFromAlongPathDistance(const Units::Len
                                                                 Units::Length &position_x, Units::Length &position_y,
                                                                 Units::UnsignedAngle &course) {
    std::vector<HorizontalPath>::size_type resolved_index;
-   bool return_value = CalculatePosition(distance_along_path + EXTENSION_LENGTH, m_extended_horizontal_trajectory,
+   bool return_value = CalculatePosition(distance_along_path + EXTENSION_LENGTH, m_path->GetExtendedPath(),
                                          m_current_index, position_x, position_y, course, resolved_index);
 
    // Check for end of route is based on passed in distance_along_path
@@ -69,7 +73,7 @@ bool PositionCalculator::CalculatePositionFromAlongPathDistance(const Units::Len
       UpdateCurrentIndex(resolved_index);
 
    } else if (distance_along_path + EXTENSION_LENGTH >
-              Units::MetersLength(m_extended_horizontal_trajectory.back().m_path_length_cumulative_meters)) {
+              Units::MetersLength(m_path->GetExtendedPath().back().m_path_length_cumulative_meters)) {
       // distance_along_path is very large so off the back of the path. The old code allowed this situation to quietly
       // happen. For now, it helps a lot to allow this. But, we should consider this deprecated behavior and throw in
       // the future.
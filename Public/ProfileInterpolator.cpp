@@ -0,0 +1,49 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "public/ProfileInterpolator.h"
+
+#include <algorithm>
+
+int ProfileInterpolator::FindUpperIndex(double x, const std::vector<double> &x_values) {
+   const int last_index = static_cast<int>(x_values.size()) - 1;
+   if (x >= x_values[last_index]) {
+      m_upper_index = last_index;
+      return m_upper_index;
+   }
+
+   // the bracket is [upper_index - 1, upper_index] with x_values[upper_index] the first value above x
+   int upper_index = std::min(m_upper_index, last_index);
+   if (x_values[upper_index] <= x) {
+      upper_index = static_cast<int>(
+            std::upper_bound(x_values.begin() + upper_index + 1, x_values.end(), x) - x_values.begin());
+   } else {
+      int steps = 0;
+      while (upper_index > 0 && x_values[upper_index - 1] > x && steps < MAXIMUM_STEPS_BEFORE_SEARCH) {
+         --upper_index;
+         ++steps;
+      }
+      if (upper_index > 0 && x_values[upper_index - 1] > x) {
+         upper_index = static_cast<int>(
+               std::upper_bound(x_values.begin(), x_values.begin() + upper_index, x) - x_values.begin());
+      }
+   }
+   m_upper_index = upper_index;
+   return m_upper_index;
+}
@@ -28,14 +28,11 @@ const double RandomGenerator::m_IM = 2147483647;
 const double RandomGenerator::m_AM = 1.0 / m_IM;
 const double RandomGenerator::m_IQ = 127773.0;
 const double RandomGenerator::m_IR = 2836.0;
+const double RandomGenerator::m_default_seed = 1.0;
 
 log4cplus::Logger RandomGenerator::m_logger = log4cplus::Logger::getInstance(LOG4CPLUS_TEXT("RandomGenerator"));
 
-RandomGenerator::RandomGenerator() {
-   double seed = time(NULL);
-   long k = seed / m_IM;
-   m_seed = seed - (k * m_IM);
-}
+RandomGenerator::RandomGenerator() : m_seed(m_default_seed) {}
 
 RandomGenerator::RandomGenerator(const double seed) {
    assert(seed != 0.0);
@@ -19,6 +19,6 @@
 
 #include "public/ScenarioUtils.h"
 
-RandomGenerator aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR;
+thread_local RandomGenerator aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR;
 const int aaesim::open_source::ScenarioUtils::AIRCRAFT_ID_NOT_IN_MAP = -1;
 std::map<std::string, int> aaesim::open_source::ScenarioUtils::m_aircraft_string_int_map;
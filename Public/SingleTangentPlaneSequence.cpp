@@ -23,7 +23,7 @@
 
 using namespace std;
 
-std::list<Waypoint> SingleTangentPlaneSequence::m_master_waypoint_sequence = {};
+thread_local std::list<Waypoint> SingleTangentPlaneSequence::m_master_waypoint_sequence = {};
 log4cplus::Logger SingleTangentPlaneSequence::m_logger = log4cplus::Logger::getInstance("SingleTangentPlaneSequence");
 
 SingleTangentPlaneSequence::SingleTangentPlaneSequence(const list<Waypoint> &waypoint_list) {
@@ -140,11 +140,9 @@ Units::Time StatisticalPilotDelay::ComputeTimeToSpeedChange(Units::Length curren
    Units::SecondsTime tval;
 
    if ((current_altitude - altitude_at_end_of_route) > Units::FeetLength(9000.0)) {
-      tval = aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR.TruncatedGaussianSample(
-            m_pilot_delay_mean, m_pilot_delay_standard_deviation, STANDARD_DEVIATION_LIMIT);
+      tval = SampleDelay(m_pilot_delay_mean, m_pilot_delay_standard_deviation);
    } else {
-      tval = aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR.TruncatedGaussianSample(
-            m_pilot_delay_mean / 2, m_pilot_delay_standard_deviation / 2, STANDARD_DEVIATION_LIMIT);
+      tval = SampleDelay(m_pilot_delay_mean / 2, m_pilot_delay_standard_deviation / 2);
    }
 
    tval = abs(quantize(tval, Units::SecondsTime(1)));
@@ -158,6 +156,21 @@ Units::Time StatisticalPilotDelay::ComputeTimeToSpeedChange(Units::Length curren
    return tval;
 }
 
+Units::Time StatisticalPilotDelay::SampleDelay(Units::Time mean, Units::Time standard_deviation) {
+   if (!m_random_stream) {
+      return aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR.TruncatedGaussianSample(
+            mean, standard_deviation, STANDARD_DEVIATION_LIMIT);
+   }
+   if (standard_deviation == Units::zero()) {
+      return mean;
+   }
+   if (m_sample_batch_index == SAMPLE_BATCH_SIZE) {
+      m_random_stream->FillTruncatedGaussian(m_sample_batch, STANDARD_DEVIATION_LIMIT);
+      m_sample_batch_index = 0;
+   }
+   return mean + standard_deviation * m_sample_batch[m_sample_batch_index++];
+}
+
 void StatisticalPilotDelay::SetPilotDelayParameters(const Units::Time mean, const Units::Time standard_deviation) {
    m_pilot_delay_mean = mean;
    m_pilot_delay_standard_deviation = standard_deviation;
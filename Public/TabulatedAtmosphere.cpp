@@ -0,0 +1,185 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "public/TabulatedAtmosphere.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+const Units::MetersLength TabulatedAtmosphere::DEFAULT_ALTITUDE_STEP(10);
+const Units::MetersLength TabulatedAtmosphere::DEFAULT_MINIMUM_ALTITUDE(-1000);
+const Units::MetersLength TabulatedAtmosphere::DEFAULT_MAXIMUM_ALTITUDE(20000);
+
+TabulatedAtmosphere::TabulatedAtmosphere(std::unique_ptr<Atmosphere> analytic_atmosphere, Units::Length altitude_step,
+                                         Units::Length minimum_altitude, Units::Length maximum_altitude)
+   : m_analytic_atmosphere(std::move(analytic_atmosphere)),
+     m_altitude_step_meters(Units::MetersLength(altitude_step).value()),
+     m_minimum_altitude_meters(Units::MetersLength(minimum_altitude).value()),
+     m_maximum_altitude_meters(Units::MetersLength(maximum_altitude).value()),
+     m_troposphere(),
+     m_tropopause() {
+   if (!m_analytic_atmosphere) {
+      throw std::logic_error("TabulatedAtmosphere requires an analytic atmosphere");
+   }
+   if (!(m_altitude_step_meters > 0) || !(m_maximum_altitude_meters > m_minimum_altitude_meters)) {
+      throw std::logic_error("TabulatedAtmosphere requires a positive step and a non-empty altitude range");
+   }
+   Atmosphere::SetTemperatureOffset(m_analytic_atmosphere->GetTemperatureOffset());
+   BuildTables();
+}
+
+TabulatedAtmosphere::TabulatedAtmosphere(const TabulatedAtmosphere &obj)
+   : Atmosphere(obj),
+     m_analytic_atmosphere(obj.m_analytic_atmosphere->Clone()),
+     m_altitude_step_meters(obj.m_altitude_step_meters),
+     m_minimum_altitude_meters(obj.m_minimum_altitude_meters),
+     m_maximum_altitude_meters(obj.m_maximum_altitude_meters),
+     m_troposphere(obj.m_troposphere),
+     m_tropopause(obj.m_tropopause) {}
+
+Atmosphere *TabulatedAtmosphere::Clone() const { return new TabulatedAtmosphere(*this); }
+
+void TabulatedAtmosphere::SetTemperatureOffset(const Units::Temperature temperature_offset) {
+   m_analytic_atmosphere->SetTemperatureOffset(temperature_offset);
+   Atmosphere::SetTemperatureOffset(temperature_offset);
+   BuildTables();
+}
+
+void TabulatedAtmosphere::CalibrateTemperatureAtAltitude(const Units::KelvinTemperature temperature,
+                                                         const Units::Length altitude) {
+   m_analytic_atmosphere->CalibrateTemperatureAtAltitude(temperature, altitude);
+   Atmosphere::SetTemperatureOffset(m_analytic_atmosphere->GetTemperatureOffset());
+   BuildTables();
+}
+
+Units::KelvinTemperature TabulatedAtmosphere::GetTemperature(const Units::Length altitude_msl) const {
+   const double altitude_meters = Units::MetersLength(altitude_msl).value();
+   const Segment *segment = FindSegment(altitude_meters);
+   if (segment == nullptr) {
+      return m_analytic_atmosphere->GetTemperature(altitude_msl);
+   }
+   return Units::KelvinTemperature(segment->Interpolate(altitude_meters).temperature_kelvin);
+}
+
+void TabulatedAtmosphere::AirDensity(const Units::Length h, Units::Density &rho, Units::Pressure &P) const {
+   const double altitude_meters = Units::MetersLength(h).value();
+   const Segment *segment = FindSegment(altitude_meters);
+   if (segment == nullptr) {
+      m_analytic_atmosphere->AirDensity(h, rho, P);
+      return;
+   }
+   const Sample sample = segment->Interpolate(altitude_meters);
+   rho = Units::KilogramsMeterDensity(sample.density_kilograms_per_cubic_meter);
+   P = Units::PascalsPressure(sample.pressure_pascals);
+   AirDensity_Log(h, Units::KelvinTemperature(sample.temperature_kelvin), P, rho);
+}
+
+Units::Speed TabulatedAtmosphere::CAS2TAS(const Units::Speed vcas, const Units::Pressure p,
+                                          const Units::Density rho) const {
+   return m_analytic_atmosphere->CAS2TAS(vcas, p, rho);
+}
+
+Units::Speed TabulatedAtmosphere::TAS2CAS(const Units::Speed vtas, const Units::Pressure p,
+                                          const Units::Density rho) const {
+   return m_analytic_atmosphere->TAS2CAS(vtas, p, rho);
+}
+
+Units::Length TabulatedAtmosphere::GetMachIASTransition(const Units::Speed ias, const double mach) const {
+   return m_analytic_atmosphere->GetMachIASTransition(ias, mach);
+}
+
+Units::Speed TabulatedAtmosphere::SpeedOfSound(Units::KelvinTemperature temperature) const {
+   return m_analytic_atmosphere->SpeedOfSound(temperature);
+}
+
+Units::KelvinTemperature TabulatedAtmosphere::GetSeaLevelTemperature() const {
+   return m_analytic_atmosphere->GetSeaLevelTemperature();
+}
+
+Units::MetersLength TabulatedAtmosphere::GetTropopauseHeight() const {
+   return m_analytic_atmosphere->GetTropopauseHeight();
+}
+
+Units::Pressure TabulatedAtmosphere::GetTropopausePressure() const {
+   return m_analytic_atmosphere->GetTropopausePressure();
+}
+
+double TabulatedAtmosphere::ESFconstantCAS(const Units::Speed true_airspeed, const Units::Length altitude_msl,
+                                           const Units::KelvinTemperature temperature) const {
+   return m_analytic_atmosphere->ESFconstantCAS(true_airspeed, altitude_msl, temperature);
+}
+
+void TabulatedAtmosphere::BuildTables() {
+   // split at the tropopause so the lapse rate discontinuity lands on a sample
+   const double tropopause_meters = m_analytic_atmosphere->GetTropopauseHeight().value();
+   const double split_meters =
+         std::min(std::max(tropopause_meters, m_minimum_altitude_meters), m_maximum_altitude_meters);
+   m_troposphere = BuildSegment(m_minimum_altitude_meters, split_meters);
+   m_tropopause = BuildSegment(split_meters, m_maximum_altitude_meters);
+}
+
+TabulatedAtmosphere::Segment TabulatedAtmosphere::BuildSegment(double lower_meters, double upper_meters) const {
+   Segment segment;
+   if (!(upper_meters > lower_meters)) {
+      return segment;
+   }
+   const auto interval_count =
+         static_cast<std::size_t>(std::ceil((upper_meters - lower_meters) / m_altitude_step_meters));
+   segment.minimum_meters = lower_meters;
+   segment.maximum_meters = upper_meters;
+   segment.step_meters = (upper_meters - lower_meters) / interval_count;
+   segment.samples.reserve(interval_count + 1);
+   for (std::size_t i = 0; i <= interval_count; ++i) {
+      const Units::MetersLength altitude(i == interval_count ? upper_meters : lower_meters + segment.step_meters * i);
+      Units::KilogramsMeterDensity rho;
+      Units::PascalsPressure pressure;
+      m_analytic_atmosphere->AirDensity(altitude, rho, pressure);
+      segment.samples.push_back({m_analytic_atmosphere->GetTemperature(altitude).value(), pressure.value(),
+                                 rho.value()});
+   }
+   return segment;
+}
+
+const TabulatedAtmosphere::Segment *TabulatedAtmosphere::FindSegment(double altitude_meters) const {
+   // same convention as the analytic models: the tropopause itself belongs to the upper layer
+   if (m_tropopause.Contains(altitude_meters)) {
+      return &m_tropopause;
+   }
+   if (m_troposphere.Contains(altitude_meters)) {
+      return &m_troposphere;
+   }
+   return nullptr;
+}
+
+bool TabulatedAtmosphere::Segment::Contains(double altitude_meters) const {
+   return !samples.empty() && altitude_meters >= minimum_meters && altitude_meters <= maximum_meters;
+}
+
+TabulatedAtmosphere::Sample TabulatedAtmosphere::Segment::Interpolate(double altitude_meters) const {
+   const double position = (altitude_meters - minimum_meters) / step_meters;
+   const auto lower_index = std::min(static_cast<std::size_t>(position), samples.size() - 2);
+   const double fraction = position - lower_index;
+   const Sample &lower = samples[lower_index];
+   const Sample &upper = samples[lower_index + 1];
+   return {lower.temperature_kelvin + fraction * (upper.temperature_kelvin - lower.temperature_kelvin),
+           lower.pressure_pascals + fraction * (upper.pressure_pascals - lower.pressure_pascals),
+           lower.density_kilograms_per_cubic_meter +
+                 fraction * (upper.density_kilograms_per_cubic_meter - lower.density_kilograms_per_cubic_meter)};
+}
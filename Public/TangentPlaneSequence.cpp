@@ -33,6 +33,22 @@ void TangentPlaneSequence::Copy(const TangentPlaneSequence &in) {
    this->local_positions_from_initialization_ = in.local_positions_from_initialization_;
    this->tangent_planes_from_initialization_ = in.tangent_planes_from_initialization_;
    this->waypoints_from_initialization_ = in.waypoints_from_initialization_;
+   this->closest_plane_by_enu_ = in.closest_plane_by_enu_;
+   this->closest_plane_by_ecef_ = in.closest_plane_by_ecef_;
+}
+
+void TangentPlaneSequence::BuildClosestPlaneSearches() {
+   std::vector<aaesim::open_source::SortedAxisNearestPoint<2>::Point> enu_points;
+   std::vector<aaesim::open_source::SortedAxisNearestPoint<3>::Point> ecef_points;
+   for (const auto &tangent_plane : tangent_planes_from_initialization_) {
+      const EarthModel::LocalPositionEnu &enu = tangent_plane->getPointOfTangencyEnu();
+      const EarthModel::AbsolutePositionEcef &ecef = tangent_plane->getPointOfTangencyEcef();
+      enu_points.push_back({Units::MetersLength(enu.x).value(), Units::MetersLength(enu.y).value()});
+      ecef_points.push_back({Units::MetersLength(ecef.x).value(), Units::MetersLength(ecef.y).value(),
+                             Units::MetersLength(ecef.z).value()});
+   }
+   closest_plane_by_enu_ = aaesim::open_source::SortedAxisNearestPoint<2>(enu_points);
+   closest_plane_by_ecef_ = aaesim::open_source::SortedAxisNearestPoint<3>(ecef_points);
 }
 
 void TangentPlaneSequence::Initialize(const std::list<Waypoint> &waypoint_list) {
@@ -71,58 +87,68 @@ void TangentPlaneSequence::Initialize(const std::list<Waypoint> &waypoint_list)
    };
    // use reverse iterator so that last will be processed first
    std::for_each(waypoint_list.rbegin(), waypoint_list.rend(), build_tangent_planes);
+   BuildClosestPlaneSearches();
 }
 
 void TangentPlaneSequence::ConvertLocalToGeodetic(EarthModel::LocalPositionEnu local_position,
                                                   EarthModel::GeodeticPosition &geo_position) const {
-   std::vector<Units::Area> areas;
-   auto compute_metric = [&areas, local_position](const EarthModel::LocalPositionEnu &point_of_tangency) {
-      Units::Length x = local_position.x - point_of_tangency.x;
-      Units::Length y = local_position.y - point_of_tangency.y;
-      Units::Area d2 = x * x + y * y;
-      areas.push_back(d2);
-   };
-   auto get_point_of_tangency = [&compute_metric](const std::shared_ptr<LocalTangentPlane> &tangent_plane) {
-      compute_metric(tangent_plane->getPointOfTangencyEnu());
-   };
-   std::for_each(tangent_planes_from_initialization_.begin(), tangent_planes_from_initialization_.end(),
-                 get_point_of_tangency);
-   auto minimum = std::min_element(areas.begin(), areas.end());
-   if (minimum == areas.end()) {
+   std::vector<LocalTangentPlane>::size_type closest_plane_hint = 0;
+   ConvertLocalToGeodetic(local_position, geo_position, closest_plane_hint);
+}
+
+void TangentPlaneSequence::ConvertGeodeticToLocal(EarthModel::GeodeticPosition geo_position,
+                                                  EarthModel::LocalPositionEnu &local_position) const {
+   std::vector<LocalTangentPlane>::size_type closest_plane_hint = 0;
+   ConvertGeodeticToLocal(geo_position, local_position, closest_plane_hint);
+}
+
+void TangentPlaneSequence::ConvertLocalToGeodetic(EarthModel::LocalPositionEnu local_position,
+                                                  EarthModel::GeodeticPosition &geo_position,
+                                                  std::vector<LocalTangentPlane>::size_type &closest_plane_hint) const {
+   if (closest_plane_by_enu_.IsEmpty()) {
       LOG4CPLUS_FATAL(logger_,
                       "size of tangent_planes_from_initialization_: " << tangent_planes_from_initialization_.size());
       throw logic_error("Unable to determine closest point (empty?)");
    }
-   auto closest_tangent_plane_itr = std::distance(areas.begin(), minimum);
-   tangent_planes_from_initialization_[closest_tangent_plane_itr]->ConvertLocalToGeodetic(local_position, geo_position);
+   closest_plane_hint = closest_plane_by_enu_.FindNearest(
+         {Units::MetersLength(local_position.x).value(), Units::MetersLength(local_position.y).value()},
+         closest_plane_hint);
+   tangent_planes_from_initialization_[closest_plane_hint]->ConvertLocalToGeodetic(local_position, geo_position);
 }
 
 void TangentPlaneSequence::ConvertGeodeticToLocal(EarthModel::GeodeticPosition geo_position,
-                                                  EarthModel::LocalPositionEnu &local_position) const {
+                                                  EarthModel::LocalPositionEnu &local_position,
+                                                  std::vector<LocalTangentPlane>::size_type &closest_plane_hint) const {
    EarthModel::AbsolutePositionEcef ecef_position;
    Environment::GetInstance()->GetEarthModel()->ConvertGeodeticToAbsolute(geo_position, ecef_position);
-   std::vector<Units::Area> areas;
-   auto compute_metric = [&areas, ecef_position](const EarthModel::AbsolutePositionEcef &point_of_tangency) {
-      Units::Length x = ecef_position.x - point_of_tangency.x;
-      Units::Length y = ecef_position.y - point_of_tangency.y;
-      Units::Length z = ecef_position.z - point_of_tangency.z;
-      Units::Area d2 = x * x + y * y + z * z;
-      areas.push_back(d2);
-   };
-   auto get_point_of_tangency = [&compute_metric](const std::shared_ptr<LocalTangentPlane> &tangent_plane) {
-      compute_metric(tangent_plane->getPointOfTangencyEcef());
-   };
-   std::for_each(tangent_planes_from_initialization_.begin(), tangent_planes_from_initialization_.end(),
-                 get_point_of_tangency);
-   auto minimum = std::min_element(areas.begin(), areas.end());
-   if (minimum == areas.end()) {
+   if (closest_plane_by_ecef_.IsEmpty()) {
       LOG4CPLUS_FATAL(logger_,
                       "size of tangent_planes_from_initialization_: " << tangent_planes_from_initialization_.size());
       throw logic_error("Unable to determine closest point (empty?)");
    }
-   auto closest_tangent_plane_itr = std::distance(areas.begin(), minimum);
-   tangent_planes_from_initialization_[closest_tangent_plane_itr]->ConvertAbsoluteToLocal(ecef_position,
-                                                                                          local_position);
+   closest_plane_hint = closest_plane_by_ecef_.FindNearest(
+         {Units::MetersLength(ecef_position.x).value(), Units::MetersLength(ecef_position.y).value(),
+          Units::MetersLength(ecef_position.z).value()},
+         closest_plane_hint);
+   tangent_planes_from_initialization_[closest_plane_hint]->ConvertAbsoluteToLocal(ecef_position, local_position);
+}
+
+void TangentPlaneSequence::ConvertLocalToGeodetic(const std::vector<EarthModel::LocalPositionEnu> &local_positions,
+                                                  std::vector<EarthModel::GeodeticPosition> &geo_positions) const {
+   geo_positions.resize(local_positions.size());
+   std::vector<LocalTangentPlane>::size_type closest_plane_hint = 0;
+   for (auto i = 0; i < local_positions.size(); ++i) {
+      ConvertLocalToGeodetic(local_positions[i], geo_positions[i], closest_plane_hint);
+   }
+}
+
+void TangentPlaneSequence::ConvertGeodeticToLocal(const std::vector<EarthModel::GeodeticPosition> &geo_positions,
+                                                  std::vector<EarthModel::LocalPositionEnu> &local_positions) const {
+   local_positions.resize(geo_positions.size());
+   std::vector<LocalTangentPlane>::size_type closest_plane_hint = 0;
+   for (auto i = 0; i < geo_positions.size(); ++i) {
+      ConvertGeodeticToLocal(geo_positions[i], local_positions[i], closest_plane_hint);
+   }
 }
 
 const std::vector<EarthModel::LocalPositionEnu> &TangentPlaneSequence::GetLocalPositionsFromInitialization() const {
@@ -29,20 +29,22 @@ using json = nlohmann::json;
 using namespace std;
 using namespace aaesim::open_source;
 
+// Per-component absolute tolerances for the adaptive integrator: enu x, y and altitude [m], true airspeed [m/s],
+// gamma and psi [rad], thrust [N], phi [rad], speed brake [fraction].
+static const RungeKuttaIntegrator<EquationsOfMotionKernel::STATE_SIZE>::Tolerance ADAPTIVE_STEP_TOLERANCE{
+      {1e-3, 1e-3, 1e-3, 1e-4, 1e-7, 1e-7, 1e-1, 1e-7, 1e-6}, 1e-6};
+
 AircraftState ThreeDOFDynamics::Update(const int unique_acid, const aaesim::open_source::SimulationTime &simtime,
                                        const Guidance &guidance, const shared_ptr<AircraftControl> &aircraft_control) {
    auto dynamics_state = Integrate(guidance, aircraft_control);
-   m_dynamics_history.insert(std::make_pair(simtime, dynamics_state));
+   m_dynamics_history.Record(simtime, dynamics_state);
 
-   LatLonDerivative position_rate;
-   m_position_estimator->ComputePosition(simtime, m_equations_of_motion_state, m_equations_of_motion_state_derivative,
-                                         m_last_resolved_position, position_rate);
    Units::Angle trk = Units::RadiansAngle(dynamics_state.psi);
    Units::Speed Vw_para = m_wind_velocity_east * cos(trk) + m_wind_velocity_north * sin(trk);
    Units::Speed Vw_perp = -m_wind_velocity_east * sin(trk) + m_wind_velocity_north * cos(trk);
    Units::Temperature outside_air_temperature = m_true_weather_operator->GetTemperature();
-   return AircraftState::Builder(unique_acid, simtime.GetCurrentSimulationTime())
-         .Position(m_equations_of_motion_state.enu_x, m_equations_of_motion_state.enu_y)
+   AircraftState::Builder state_builder(unique_acid, simtime.GetCurrentSimulationTime());
+   state_builder.Position(m_equations_of_motion_state.enu_x, m_equations_of_motion_state.enu_y)
          ->AltitudeMsl(dynamics_state.h)
          ->Psi(dynamics_state.psi)
          ->GroundSpeed(dynamics_state.xd, dynamics_state.yd)
@@ -56,12 +58,24 @@ AircraftState ThreeDOFDynamics::Update(const int unique_acid, const aaesim::open
          ->SensedTemperature(outside_air_temperature)
          ->SensedDensity(m_true_weather_operator->GetDensity())
          ->SensedPressure(m_true_weather_operator->GetPressure())
-         ->DynamicsState(dynamics_state)
-         ->Latitude(m_last_resolved_position.latitude)
-         ->Longitude(m_last_resolved_position.longitude)
-         ->LatitudeRate(position_rate.latitude_time_derivative)
-         ->LongitudeRate(position_rate.longitude_time_derivative)
-         ->Build();
+         ->DynamicsState(dynamics_state);
+
+   // The true weather is the only per-step user of the geodetic position. When it does not need one, the conversion
+   // is left to whoever reads the state's latitude and longitude, usually only the output writers.
+   if (m_true_weather_operator->IsPositionDependent()) {
+      LatLonDerivative position_rate;
+      m_position_estimator->ComputePosition(simtime, m_equations_of_motion_state,
+                                            m_equations_of_motion_state_derivative, m_last_resolved_position,
+                                            position_rate);
+      state_builder.Latitude(m_last_resolved_position.latitude)
+            ->Longitude(m_last_resolved_position.longitude)
+            ->LatitudeRate(position_rate.latitude_time_derivative)
+            ->LongitudeRate(position_rate.longitude_time_derivative);
+   } else {
+      state_builder.DeferredPosition(m_position_estimator->DeferPosition(simtime, m_equations_of_motion_state,
+                                                                         m_equations_of_motion_state_derivative));
+   }
+   return state_builder.Build();
 }
 
 DynamicsState ThreeDOFDynamics::Integrate(const Guidance &guidance,
@@ -76,12 +90,25 @@ DynamicsState ThreeDOFDynamics::Integrate(const Guidance &guidance,
    if (perform_takeoff_roll_logic) {
       m_equations_of_motion_state_derivative = StatePropagationOnRunway(controller_response.first, guidance);
    } else {
-      // First-order derivative of the state calculated by the EOM
-      m_equations_of_motion_state_derivative = StatePropagation(
-            m_true_weather_operator->GetWindSpeedVerticalDerivativeEast(),
-            m_true_weather_operator->GetWindSpeedVerticalDerivativeNorth(),
-            controller_response.second.k_flight_path_angle, controller_response.second.k_thrust,
-            controller_response.second.k_roll, controller_response.second.k_speed_brake, controller_response.first);
+      // Weather, guidance and control commands are held for every evaluation within this step
+      const EquationsOfMotionKernel::StepInputs step_inputs =
+            BuildStepInputs(controller_response.first, controller_response.second);
+      const EquationsOfMotionKernel::State initial_state = ToStateVector(m_equations_of_motion_state);
+      if (m_logger.getLogLevel() == log4cplus::TRACE_LOG_LEVEL) {
+         LogKineticForces(step_inputs, initial_state,
+                          EquationsOfMotionKernel::CalculateKineticForces(m_aircraft_constants, step_inputs,
+                                                                          initial_state));
+      }
+
+      // Effective derivative over the step; for forward Euler this is the derivative at the current state
+      const EquationsOfMotionKernel::State slope = StateIntegrator::Slope(
+            m_integration_method, initial_state, dt.value(),
+            [this, &step_inputs](const EquationsOfMotionKernel::State &state) {
+               return EquationsOfMotionKernel::Derivative(m_aircraft_constants, step_inputs, state);
+            },
+            ADAPTIVE_STEP_TOLERANCE);
+      m_equations_of_motion_state_derivative =
+            FromDerivativeVector(slope, controller_response.first.flap_configuration);
    }
 
    // Integrate the state
@@ -103,96 +130,65 @@ DynamicsState ThreeDOFDynamics::Integrate(const Guidance &guidance,
    return ComputeDynamicsState(m_equations_of_motion_state, m_equations_of_motion_state_derivative);
 }
 
-EquationsOfMotionStateDeriv ThreeDOFDynamics::StatePropagation(Units::Frequency dVwx_dh, Units::Frequency dVwy_dh,
-                                                               Units::Frequency k_gamma, Units::Frequency k_t,
-                                                               Units::Frequency k_phi, double k_speedBrake,
-                                                               ControlCommands commands) {
-   // Aircraft Configuration
-   const Units::Mass ac_mass = m_bada_calculator->GetAircraftMass();
-
-   // States
-   const Units::Speed true_airspeed = m_equations_of_motion_state.true_airspeed;
-   const Units::Angle gamma = m_equations_of_motion_state.gamma;
-   const Units::Angle psi = m_equations_of_motion_state.psi_enu;
-   const Units::Force thrust = m_equations_of_motion_state.thrust;
-   const Units::Angle phi = m_equations_of_motion_state.phi;
-   const double speed_brake_percentage = m_equations_of_motion_state.speed_brake_percentage;
-
-   Units::Force drag, lift;
-   CalculateKineticForces(lift, drag);
-
-   // calculate the first-order derivative of the state vector
-   EquationsOfMotionStateDeriv dX;
-   dX.enu_velocity_x = Units::MetersPerSecondSpeed(true_airspeed * cos(gamma) * cos(psi) + m_wind_velocity_east);
-   dX.enu_velocity_y = Units::MetersPerSecondSpeed(true_airspeed * cos(gamma) * sin(psi) + m_wind_velocity_north);
-   dX.enu_velocity_z = Units::MetersPerSecondSpeed(-true_airspeed * sin(gamma));
-   dX.true_airspeed_deriv = (thrust - drag) / ac_mass + Units::ONE_G_ACCELERATION * sin(gamma) +
-                            true_airspeed * (dVwx_dh * cos(psi) + dVwy_dh * sin(psi)) * sin(gamma) * cos(gamma);
-   dX.gamma_deriv = k_gamma * (commands.flight_path_angle_command - gamma) -
-                    (dVwx_dh * cos(psi) + dVwy_dh * sin(psi)) * pow(sin(gamma), 2) * Units::ONE_RADIAN_ANGLE;
-   dX.heading_deriv = (-lift * sin(phi) / (ac_mass * true_airspeed * cos(gamma)) -
-                       (dVwx_dh * sin(psi) - dVwy_dh * cos(psi)) * tan(gamma)) *
-                      Units::ONE_RADIAN_ANGLE;
-   dX.thrust_deriv = k_t * (commands.thrust_command - thrust);
-   dX.roll_rate = k_phi * (commands.roll_angle_command - phi);
-   dX.speed_brake_deriv = k_speedBrake * (commands.speed_brake_command - speed_brake_percentage);
-   dX.flap_configuration = commands.flap_configuration;
-
-   return dX;
+EquationsOfMotionKernel::StepInputs ThreeDOFDynamics::BuildStepInputs(const ControlCommands &commands,
+                                                                      const ControlGains &gains) const {
+   EquationsOfMotionKernel::StepInputs inputs;
+   inputs.density_kg_m3 = Units::KilogramsMeterDensity(m_true_weather_operator->GetDensity()).value();
+   inputs.wind_east_mps = Units::MetersPerSecondSpeed(m_wind_velocity_east).value();
+   inputs.wind_north_mps = Units::MetersPerSecondSpeed(m_wind_velocity_north).value();
+   inputs.wind_gradient_east_hz =
+         Units::HertzFrequency(m_true_weather_operator->GetWindSpeedVerticalDerivativeEast()).value();
+   inputs.wind_gradient_north_hz =
+         Units::HertzFrequency(m_true_weather_operator->GetWindSpeedVerticalDerivativeNorth()).value();
+   m_bada_calculator->GetCurrentDragCoefficients(inputs.cd0, inputs.cd2, inputs.gear_drag);
+   inputs.k_flight_path_angle_hz = Units::HertzFrequency(gains.k_flight_path_angle).value();
+   inputs.k_thrust_hz = Units::HertzFrequency(gains.k_thrust).value();
+   inputs.k_roll_hz = Units::HertzFrequency(gains.k_roll).value();
+   inputs.k_speed_brake = gains.k_speed_brake;
+   inputs.flight_path_angle_command_rad = Units::RadiansAngle(commands.flight_path_angle_command).value();
+   inputs.thrust_command_newtons = Units::NewtonsForce(commands.thrust_command).value();
+   inputs.roll_angle_command_rad = Units::RadiansAngle(commands.roll_angle_command).value();
+   inputs.speed_brake_command = commands.speed_brake_command;
+   return inputs;
 }
 
-void ThreeDOFDynamics::CalculateKineticForces(Units::Force &lift, Units::Force &drag) {
-   // Aircraft Configuration
-   const Units::Mass ac_mass = m_bada_calculator->GetAircraftMass();
-   const Units::Area wing_area = m_bada_calculator->GetAerodynamicsInformation().S;
-
-   // States important for this method
-   const Units::Length altitude_msl = m_equations_of_motion_state.altitude_msl;
-   const Units::Speed true_airspeed = m_equations_of_motion_state.true_airspeed;
-   const Units::Angle phi = m_equations_of_motion_state.phi;  // roll angle
-   const double speed_brake_setting =
-         m_equations_of_motion_state.speed_brake_percentage;  // speed brake (% of deployment)
-
-   // Get temp, density, and pressure
-   Units::KilogramsMeterDensity rho(m_true_weather_operator->GetDensity());
-   Units::PascalsPressure pressure(m_true_weather_operator->GetPressure());
-
-   // Get aerodynamic configuration
-   double cd0, cd2, gear;
-   m_bada_calculator->GetCurrentDragCoefficients(cd0, cd2, gear);
-
-   // Lift and Drag Coefficients
-   const double cL =
-         (2. * ac_mass * Units::ONE_G_ACCELERATION) / (rho * Units::sqr(true_airspeed) * wing_area * cos(phi));
-   double cD = cd0 + gear + cd2 * pow(cL, 2);
-   if (speed_brake_setting != 0.0) {
-      cD = (1.0 + 0.6 * speed_brake_setting) * cD;
-   }
-
-   // Drag & Lift
-   drag = 1. / 2. * rho * cD * Units::sqr(true_airspeed) * wing_area;
-   lift = 1. / 2. * rho * cL * Units::sqr(true_airspeed) * wing_area;
+void ThreeDOFDynamics::CalculateKineticForces(const EquationsOfMotionState &state, Units::Force &lift,
+                                              Units::Force &drag) {
+   // Only the weather and drag terms of the step inputs are needed for the forces
+   const EquationsOfMotionKernel::StepInputs inputs = BuildStepInputs(ControlCommands{}, ControlGains{});
+   const EquationsOfMotionKernel::State state_vector = ToStateVector(state);
+   const EquationsOfMotionKernel::KineticForces forces =
+         EquationsOfMotionKernel::CalculateKineticForces(m_aircraft_constants, inputs, state_vector);
+   drag = Units::NewtonsForce(forces.drag_newtons);
+   lift = Units::NewtonsForce(forces.lift_newtons);
 
    if (m_logger.getLogLevel() == log4cplus::TRACE_LOG_LEVEL) {
-      json j;
-      j["mass_kg"] = Units::KilogramsMass(ac_mass).value();
-      j["altitude_msl_ft"] = Units::FeetLength(altitude_msl).value();
-      j["true_airspeed_kts"] = Units::KnotsSpeed(true_airspeed).value();
-      j["rho_kgm3"] = Units::KilogramsMeterDensity(rho).value();
-      j["gear"] = gear;
-      j["cd0"] = cd0;
-      j["cd2"] = cd2;
-      j["cD"] = cD;
-      j["drag_newtons"] = Units::NewtonsForce(drag).value();
-      j["cL"] = cL;
-      j["lift_newtons"] = Units::NewtonsForce(lift).value();
-      j["speed_brake_setting"] = speed_brake_setting;
-      j["updated_flap_setting"] = aaesim::open_source::bada_utils::GetFlapConfigurationAsString(
-            m_bada_calculator->GetCurrentFlapConfiguration());
-      LOG4CPLUS_TRACE(m_logger, j.dump());
+      LogKineticForces(inputs, state_vector, forces);
    }
 }
 
+void ThreeDOFDynamics::LogKineticForces(const EquationsOfMotionKernel::StepInputs &inputs,
+                                        const EquationsOfMotionKernel::State &state,
+                                        const EquationsOfMotionKernel::KineticForces &forces) const {
+   json j;
+   j["mass_kg"] = m_aircraft_constants.mass_kg;
+   j["altitude_msl_ft"] = Units::FeetLength(Units::MetersLength(state[EquationsOfMotionKernel::ALTITUDE])).value();
+   j["true_airspeed_kts"] =
+         Units::KnotsSpeed(Units::MetersPerSecondSpeed(state[EquationsOfMotionKernel::TRUE_AIRSPEED])).value();
+   j["rho_kgm3"] = inputs.density_kg_m3;
+   j["gear"] = inputs.gear_drag;
+   j["cd0"] = inputs.cd0;
+   j["cd2"] = inputs.cd2;
+   j["cD"] = forces.drag_coefficient;
+   j["drag_newtons"] = forces.drag_newtons;
+   j["cL"] = forces.lift_coefficient;
+   j["lift_newtons"] = forces.lift_newtons;
+   j["speed_brake_setting"] = state[EquationsOfMotionKernel::SPEED_BRAKE];
+   j["updated_flap_setting"] = aaesim::open_source::bada_utils::GetFlapConfigurationAsString(
+         m_bada_calculator->GetCurrentFlapConfiguration());
+   LOG4CPLUS_TRACE(m_logger, j.dump());
+}
+
 Units::SignedRadiansAngle ThreeDOFDynamics::CalculateTrimmedPsiForWind(Units::SignedAngle ground_track_enu) {
    UpdateTrueWeatherConditions();
    const double gamma = Units::RadiansAngle(m_equations_of_motion_state.gamma).value();
@@ -237,6 +233,9 @@ void ThreeDOFDynamics::Initialize(
       std::shared_ptr<aaesim::open_source::EllipsoidalPositionEstimator> position_estimator,
       std::shared_ptr<aaesim::open_source::TrueWeatherOperator> true_weather_operator) {
    m_bada_calculator = aircraft_performance;
+   m_aircraft_constants.mass_kg = Units::KilogramsMass(m_bada_calculator->GetAircraftMass()).value();
+   m_aircraft_constants.wing_area_m2 =
+         Units::MetersArea(m_bada_calculator->GetAerodynamicsInformation().S).value();
    m_position_estimator = position_estimator;
    m_true_weather_operator = true_weather_operator;
 
@@ -291,7 +290,7 @@ void ThreeDOFDynamics::Initialize(
       // Calculate initial Aircraft Thrust
       Units::Mass ac_mass = m_bada_calculator->GetAircraftMass();
       Units::Force drag, lift;
-      CalculateKineticForces(lift, drag);
+      CalculateKineticForces(m_equations_of_motion_state, lift, drag);
       Units::Force equilibrium_thrust_required = drag - ac_mass * Units::ONE_G_ACCELERATION * sin(asin(0.0));
       const Units::Force max_thrust = m_bada_calculator->GetMaxThrust(
             Units::MetersLength(initial_dynamics_state.h), aaesim::open_source::bada_utils::FlapConfiguration::CRUISE,
@@ -306,7 +305,7 @@ void ThreeDOFDynamics::Initialize(
       }
       m_equations_of_motion_state.thrust = equilibrium_thrust_required;
    }
-   m_dynamics_history.insert(std::make_pair(simulation_time, initial_dynamics_state));
+   m_dynamics_history.Record(simulation_time, initial_dynamics_state);
 }
 
 EquationsOfMotionStateDeriv ThreeDOFDynamics::StatePropagationOnRunway(ControlCommands commands,
@@ -416,3 +415,32 @@ void ThreeDOFDynamics::UpdateTrueWeatherConditions() {
    m_wind_velocity_east = m_true_weather_operator->GetWindSpeedEast();
    m_wind_velocity_north = m_true_weather_operator->GetWindSpeedNorth();
 }
+
+EquationsOfMotionKernel::State ThreeDOFDynamics::ToStateVector(const EquationsOfMotionState &state) {
+   return {Units::MetersLength(state.enu_x).value(),
+           Units::MetersLength(state.enu_y).value(),
+           Units::MetersLength(state.altitude_msl).value(),
+           Units::MetersPerSecondSpeed(state.true_airspeed).value(),
+           Units::RadiansAngle(state.gamma).value(),
+           Units::SignedRadiansAngle(state.psi_enu).value(),
+           Units::NewtonsForce(state.thrust).value(),
+           Units::RadiansAngle(state.phi).value(),
+           state.speed_brake_percentage};
+}
+
+EquationsOfMotionStateDeriv ThreeDOFDynamics::FromDerivativeVector(
+      const EquationsOfMotionKernel::State &vector,
+      aaesim::open_source::bada_utils::FlapConfiguration flap_configuration) {
+   EquationsOfMotionStateDeriv derivative;
+   derivative.enu_velocity_x = Units::MetersPerSecondSpeed(vector[0]);
+   derivative.enu_velocity_y = Units::MetersPerSecondSpeed(vector[1]);
+   derivative.enu_velocity_z = Units::MetersPerSecondSpeed(vector[2]);
+   derivative.true_airspeed_deriv = Units::MetersSecondAcceleration(vector[3]);
+   derivative.gamma_deriv = Units::RadiansPerSecondAngularSpeed(vector[4]);
+   derivative.heading_deriv = Units::RadiansPerSecondAngularSpeed(vector[5]);
+   derivative.thrust_deriv = Units::NewtonsPerSecondForceChange(vector[6]);
+   derivative.roll_rate = Units::RadiansPerSecondAngularSpeed(vector[7]);
+   derivative.speed_brake_deriv = vector[8];
+   derivative.flap_configuration = flap_configuration;
+   return derivative;
+}
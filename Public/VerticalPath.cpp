@@ -47,6 +47,53 @@ void VerticalPath::Append(const VerticalPath &in) {
 
 void VerticalPath::operator+=(const VerticalPath &in) { Append(in); }
 
+namespace {
+template <typename T>
+void TruncateColumn(std::vector<T> &column, std::size_t size) {
+   if (column.size() > size) {
+      column.erase(column.begin() + size, column.end());
+   }
+}
+}  // namespace
+
+void VerticalPath::Reserve(std::size_t size) {
+   along_path_distance_m.reserve(size);
+   altitude_m.reserve(size);
+   cas_mps.reserve(size);
+   mach.reserve(size);
+   altitude_rate_mps.reserve(size);
+   true_airspeed.reserve(size);
+   tas_rate_mps.reserve(size);
+   theta_radians.reserve(size);
+   gs_mps.reserve(size);
+   time_to_go_sec.reserve(size);
+   mass_kg.reserve(size);
+   wind_velocity_east.reserve(size);
+   wind_velocity_north.reserve(size);
+   algorithm_type.reserve(size);
+   flap_setting.reserve(size);
+}
+
+void VerticalPath::Clear() { Truncate(0); }
+
+void VerticalPath::Truncate(std::size_t size) {
+   TruncateColumn(along_path_distance_m, size);
+   TruncateColumn(altitude_m, size);
+   TruncateColumn(cas_mps, size);
+   TruncateColumn(mach, size);
+   TruncateColumn(altitude_rate_mps, size);
+   TruncateColumn(true_airspeed, size);
+   TruncateColumn(tas_rate_mps, size);
+   TruncateColumn(theta_radians, size);
+   TruncateColumn(gs_mps, size);
+   TruncateColumn(time_to_go_sec, size);
+   TruncateColumn(mass_kg, size);
+   TruncateColumn(wind_velocity_east, size);
+   TruncateColumn(wind_velocity_north, size);
+   TruncateColumn(algorithm_type, size);
+   TruncateColumn(flap_setting, size);
+}
+
 bool VerticalPath::operator==(const VerticalPath &obj) const {
 
    bool match = (along_path_distance_m.size() == obj.along_path_distance_m.size());
@@ -42,6 +42,7 @@ void VerticalPredictor::SetMembers(const VerticalPredictor &vertical_predictor)
    m_cruise_altitude_msl = vertical_predictor.m_cruise_altitude_msl;
    m_transition_altitude_msl = vertical_predictor.m_transition_altitude_msl;
    m_current_trajectory_index = vertical_predictor.m_current_trajectory_index;
+   m_profile_interpolator = vertical_predictor.m_profile_interpolator;
 }
 
 Guidance VerticalPredictor::Update(const AircraftState &current_state, const Guidance &current_guidance,
@@ -169,40 +170,14 @@ Guidance VerticalPredictor::CalculateGuidanceCommands(const AircraftState &state
    }
 
    const Units::MetersLength distance_remaining(distance_to_go);
-   double h_next;
-   double v_next;
-   double h_dot_next;
-   double gs_next;
 
    // if the check if the distance left is <= the start of the precalculated descent distance
    if (distance_remaining.value() <= fabs(m_vertical_path.along_path_distance_m.back())) {
-      // Get index.
-      m_current_trajectory_index =
-            CoreUtils::FindNearestIndex(distance_remaining.value(), m_vertical_path.along_path_distance_m);
-
-      // Set _next values.
-      if (m_current_trajectory_index == 0) {
-         // Below lowest distance-take values at end of route.
-
-         h_next = m_vertical_path.altitude_m[m_current_trajectory_index];
-         v_next = m_vertical_path.cas_mps[m_current_trajectory_index];
-         h_dot_next = m_vertical_path.altitude_rate_mps[m_current_trajectory_index];
-         gs_next = m_vertical_path.gs_mps[m_current_trajectory_index];
-
-      } else {
-         // Interpolate values using distance.
-         h_next = CoreUtils::LinearlyInterpolate(m_current_trajectory_index, distance_remaining.value(),
-                                                 m_vertical_path.along_path_distance_m, m_vertical_path.altitude_m);
-
-         v_next = CoreUtils::LinearlyInterpolate(m_current_trajectory_index, distance_remaining.value(),
-                                                 m_vertical_path.along_path_distance_m, m_vertical_path.cas_mps);
-
-         h_dot_next =
-               CoreUtils::LinearlyInterpolate(m_current_trajectory_index, distance_remaining.value(),
-                                              m_vertical_path.along_path_distance_m, m_vertical_path.altitude_rate_mps);
-         gs_next = CoreUtils::LinearlyInterpolate(m_current_trajectory_index, distance_remaining.value(),
-                                                  m_vertical_path.along_path_distance_m, m_vertical_path.gs_mps);
-      }
+      // Below lowest distance the interpolator takes values at end of route.
+      const auto [h_next, v_next, h_dot_next, gs_next] = m_profile_interpolator.Interpolate(
+            distance_remaining.value(), m_vertical_path.along_path_distance_m, m_vertical_path.altitude_m,
+            m_vertical_path.cas_mps, m_vertical_path.altitude_rate_mps, m_vertical_path.gs_mps);
+      m_current_trajectory_index = m_profile_interpolator.GetUpperIndex();
 
       // Set result
       result.m_reference_altitude = Units::MetersLength(h_next);
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <list>
+#include <stdexcept>
 
 #include "utility/CustomUnits.h"
 #include "public/CustomMath.h"
@@ -28,12 +29,23 @@
 using namespace aaesim::open_source;
 using namespace std;
 
-WindStack::WindStack() : m_altitude(), m_speed(), m_minimum_data_index(0), m_maximum_data_index(0) {
+WindStack::WindStack()
+   : m_inline_altitude(),
+     m_inline_speed(),
+     m_altitude(),
+     m_speed(),
+     m_minimum_data_index(0),
+     m_maximum_data_index(0) {
    SetBounds(m_minimum_data_index, m_maximum_data_index);
 }
 
 WindStack::WindStack(const int min, const int max)
-   : m_altitude(), m_speed(), m_minimum_data_index(min), m_maximum_data_index(max) {
+   : m_inline_altitude(),
+     m_inline_speed(),
+     m_altitude(),
+     m_speed(),
+     m_minimum_data_index(min),
+     m_maximum_data_index(max) {
    SetBounds(min, max);
 }
 
@@ -47,8 +59,13 @@ WindStack &WindStack::operator=(const WindStack &in) {
 void WindStack::Copy(const WindStack &in) {
    m_minimum_data_index = in.m_minimum_data_index;
    m_maximum_data_index = in.m_maximum_data_index;
-   m_altitude = in.m_altitude;
-   m_speed = in.m_speed;
+   if (in.UsesInlineStorage()) {
+      m_inline_altitude = in.m_inline_altitude;
+      m_inline_speed = in.m_inline_speed;
+   } else {
+      m_altitude = in.m_altitude;
+      m_speed = in.m_speed;
+   }
 }
 
 bool WindStack::operator==(const WindStack &obj) const {
@@ -63,42 +80,63 @@ bool WindStack::operator==(const WindStack &obj) const {
 
 bool WindStack::operator!=(const WindStack &obj) const { return !operator==(obj); }
 
-Units::FeetLength WindStack::GetAltitude(const int index) const { return m_altitude.at(index); }
+int WindStack::RowOffset(const int index) const {
+   if (index < m_minimum_data_index || index > m_maximum_data_index) {
+      throw std::out_of_range("WindStack index " + std::to_string(index) + " outside [" +
+                              std::to_string(m_minimum_data_index) + ", " + std::to_string(m_maximum_data_index) +
+                              "]");
+   }
+   return index - m_minimum_data_index;
+}
 
-Units::KnotsSpeed WindStack::GetSpeed(const int index) const { return m_speed.at(index); }
+Units::FeetLength WindStack::GetAltitude(const int index) const {
+   if (index >= 0 && index < m_minimum_data_index) {
+      return Units::Length(Units::Infinity());
+   }
+   return AltitudeRow(RowOffset(index));
+}
+
+Units::KnotsSpeed WindStack::GetSpeed(const int index) const {
+   if (index >= 0 && index < m_minimum_data_index) {
+      return Units::Speed(Units::Infinity());
+   }
+   return SpeedRow(RowOffset(index));
+}
 
 void WindStack::SetBounds(int min, int max) {
    m_minimum_data_index = min;
    m_maximum_data_index = max;
 
-   m_altitude.clear();
-   m_speed.clear();
-
-   for (int i = 0; i <= max; ++i) {
-      m_altitude.push_back(Units::Infinity());
-      m_speed.push_back(Units::Infinity());
+   // Neither branch allocates once the vectors have grown to the largest stack seen.
+   if (UsesInlineStorage()) {
+      m_inline_altitude.fill(Units::Length(Units::Infinity()));
+      m_inline_speed.fill(Units::Speed(Units::Infinity()));
+   } else {
+      m_altitude.assign(GetRowCount(), Units::Infinity());
+      m_speed.assign(GetRowCount(), Units::Infinity());
    }
 }
 
 void WindStack::Insert(const int index, const Units::Length altitude, const Units::Speed speed) {
-   m_altitude.at(index) = altitude;
-   m_speed.at(index) = speed;
+   const int row = RowOffset(index);
+   AltitudeRow(row) = altitude;
+   SpeedRow(row) = speed;
 }
 
 void WindStack::SortAltitudesAscending() {
    if (m_minimum_data_index == m_maximum_data_index) return;
 
    std::vector<std::pair<Units::Length, Units::Speed>> zipped_data;
-   for (auto idx = m_minimum_data_index; idx <= m_maximum_data_index; ++idx) {
-      zipped_data.push_back(std::make_pair(m_altitude.at(idx), m_speed.at(idx)));
+   for (auto row = 0; row < GetRowCount(); ++row) {
+      zipped_data.push_back(std::make_pair(AltitudeRow(row), SpeedRow(row)));
    }
    std::sort(zipped_data.begin(), zipped_data.end(), AltitudeComparator);
 
-   auto insert_index = m_minimum_data_index;
-   auto vector_inserter = [this, &insert_index](const std::pair<Units::Length, Units::Speed> item) {
-      m_altitude.at(insert_index) = item.first;
-      m_speed.at(insert_index) = item.second;
-      ++insert_index;
+   auto insert_row = 0;
+   auto vector_inserter = [this, &insert_row](const std::pair<Units::Length, Units::Speed> item) {
+      AltitudeRow(insert_row) = item.first;
+      SpeedRow(insert_row) = item.second;
+      ++insert_row;
    };
    std::for_each(zipped_data.cbegin(), zipped_data.cend(), vector_inserter);
 }
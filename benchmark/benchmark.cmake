@@ -0,0 +1,39 @@
+# *************************** BENCHMARKS ******************************** #
+# Timing of the simulation hot path. Results are written as JSON so that
+# they can be compared across commits, e.g. with google/benchmark's
+# tools/compare.py.
+add_subdirectory(${BENCHMARK_DIR})
+
+set(FMACM_BENCHMARK_SOURCE
+   ${BENCHMARK_DIR}/src/RunFilesAircraft.cpp
+   ${BENCHMARK_DIR}/src/public_benchmarks.cpp
+   ${BENCHMARK_DIR}/src/framework_benchmarks.cpp
+)
+add_executable(fmacm_benchmark
+   ${FMACM_BENCHMARK_SOURCE}
+   ${BENCHMARK_DIR}/src/main.cpp)
+target_link_libraries(fmacm_benchmark
+   benchmark::benchmark
+   framework
+)
+target_include_directories(fmacm_benchmark
+    PRIVATE
+    ${aaesim_INCLUDE_DIRS}
+    ${minicsv_INCLUDE_DIR}
+    ${nlohmann_json_INCLUDE_DIR}
+    ${LOG4CPLUS_DIRS}
+    ${BENCHMARK_DIR}/src
+    ${geolib_idealab_INCLUDE_DIRS}
+)
+set_target_properties(fmacm_benchmark PROPERTIES
+   RUNTIME_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/benchmark/bin
+   EXCLUDE_FROM_ALL TRUE)
+
+# runs from Run_Files/ so that the bundled scenario data resolves
+add_custom_target(run_benchmarks
+   ${CMAKE_SOURCE_DIR}/benchmark/bin/fmacm_benchmark
+         --benchmark_out=${CMAKE_SOURCE_DIR}/benchmark/fmacm_benchmark_results.json
+         --benchmark_out_format=json
+   DEPENDS ${CMAKE_SOURCE_DIR}/benchmark/bin/fmacm_benchmark
+   WORKING_DIRECTORY ${CMAKE_SOURCE_DIR}/Run_Files/
+)
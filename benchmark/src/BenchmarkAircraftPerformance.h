@@ -0,0 +1,179 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include "public/FixedMassAircraftPerformance.h"
+#include "utility/CustomUnits.h"
+
+namespace aaesim::bench {
+/**
+ * Fixed performance of a generic twin-engine narrow-body jet in clean configuration.
+ *
+ * The open source build has no BADA implementation, so the benchmarks fly with this model instead. Values are
+ * representative rather than exact; the benchmarks only need a flyable aircraft whose cost per cycle is comparable.
+ */
+class BenchmarkAircraftPerformance final : public aaesim::open_source::FixedMassAircraftPerformance {
+  public:
+   BenchmarkAircraftPerformance() = default;
+   ~BenchmarkAircraftPerformance() = default;
+
+   void GetDragCoefficients(const Units::Speed &calibrated_airspeed, const Units::Length &altitude_msl,
+                            const aaesim::open_source::bada_utils::FlapConfiguration &current_flap_configuration,
+                            double &cd0, double &cd2, double &gear,
+                            aaesim::open_source::bada_utils::FlapConfiguration &flap_configuration) const override {
+      GetCurrentDragCoefficients(cd0, cd2, gear);
+      flap_configuration = GetCurrentFlapConfiguration();
+   }
+
+   void GetCurrentDragCoefficients(double &cd0, double &cd2, double &gear) const override {
+      cd0 = CRUISE_CD0;
+      cd2 = CRUISE_CD2;
+      gear = 0.0;
+   }
+
+   void GetDragCoefficientsAndIncrementFlapConfiguration(
+         const Units::Speed &calibrated_airspeed, const Units::Length &altitude_msl, double &cd0, double &cd2,
+         double &gear, aaesim::open_source::bada_utils::FlapConfiguration &updated_flap_setting) override {
+      GetDragCoefficients(calibrated_airspeed, altitude_msl, GetCurrentFlapConfiguration(), cd0, cd2, gear,
+                          updated_flap_setting);
+   }
+
+   void GetConfigurationForIncreasedDrag(
+         const Units::Speed &calibrated_airspeed, const Units::Length &altitude_msl,
+         aaesim::open_source::bada_utils::FlapConfiguration &updated_flap_setting) override {
+      updated_flap_setting = GetCurrentFlapConfiguration();
+   }
+
+   Units::NewtonsForce GetMaxThrust(const Units::Length &altitude_msl,
+                                    aaesim::open_source::bada_utils::FlapConfiguration flap_configuration,
+                                    aaesim::open_source::bada_utils::EngineThrustMode engine_thrust_mode,
+                                    Units::AbsCelsiusTemperature temperature_offset) const override {
+      // BADA-style jet maximum climb thrust, with cruise and idle descent thrust as fixed fractions of it
+      const double altitude_feet = Units::FeetLength(altitude_msl).value();
+      const double max_climb_thrust = MAX_CLIMB_THRUST_C1 * (1.0 - altitude_feet / MAX_CLIMB_THRUST_C2 +
+                                                             MAX_CLIMB_THRUST_C3 * altitude_feet * altitude_feet);
+      switch (engine_thrust_mode) {
+         case aaesim::open_source::bada_utils::EngineThrustMode::MAXIMUM_CRUISE:
+            return Units::NewtonsForce(0.95 * max_climb_thrust);
+         case aaesim::open_source::bada_utils::EngineThrustMode::DESCENT:
+            return Units::NewtonsForce(0.04 * max_climb_thrust);
+         case aaesim::open_source::bada_utils::EngineThrustMode::MAXIMUM_CLIMB:
+         default:
+            return Units::NewtonsForce(max_climb_thrust);
+      }
+   }
+
+   void GetCoefficientsForFlapConfiguration(aaesim::open_source::bada_utils::FlapConfiguration flap_configuration,
+                                            double &cd0, double &cd2, double &gear) const override {
+      GetCurrentDragCoefficients(cd0, cd2, gear);
+   }
+
+   aaesim::open_source::bada_utils::FlapConfiguration GetFlapConfigurationForState(
+         const Units::Speed &calibrated_airspeed, const Units::Length &altitude_msl,
+         const aaesim::open_source::bada_utils::FlapConfiguration &current_flap_configuration) const override {
+      return GetCurrentFlapConfiguration();
+   }
+
+   Units::Mass GetAircraftMass() const override { return Units::KilogramsMass(MASS_KG); }
+
+   double GetAircraftMassPercentile() const override { return 0.5; }
+
+   aaesim::open_source::bada_utils::FlapSpeeds GetFlapSpeeds() const override {
+      aaesim::open_source::bada_utils::FlapSpeeds flap_speeds{};
+      flap_speeds.cas_approach_minimum = Units::KnotsSpeed(150);
+      flap_speeds.cas_approach_maximum = Units::KnotsSpeed(230);
+      flap_speeds.cas_landing_minimum = Units::KnotsSpeed(130);
+      flap_speeds.cas_landing_maximum = Units::KnotsSpeed(185);
+      flap_speeds.cas_gear_out_minimum = Units::KnotsSpeed(140);
+      flap_speeds.cas_gear_out_maximum = Units::KnotsSpeed(250);
+      flap_speeds.cas_takeoff_minimum = Units::KnotsSpeed(140);
+      flap_speeds.cas_climb_minimum = Units::KnotsSpeed(160);
+      flap_speeds.cas_cruise_minimum = Units::KnotsSpeed(180);
+      return flap_speeds;
+   }
+
+   aaesim::open_source::bada_utils::FlapConfiguration GetCurrentFlapConfiguration() const override {
+      return aaesim::open_source::bada_utils::FlapConfiguration::CRUISE;
+   }
+
+   void UpdateMassFraction(BoundedValue<double, 0, 1> mass_fraction) override {}
+
+   aaesim::open_source::bada_utils::AircraftType GetAircraftTypeInformation() const override {
+      return {2, aaesim::open_source::bada_utils::ENGINE_TYPE::JET,
+              aaesim::open_source::bada_utils::WAKE_CATEGORY::MEDIUM_};
+   }
+
+   aaesim::open_source::bada_utils::Mass GetAircraftMassInformation() const override {
+      aaesim::open_source::bada_utils::Mass mass{};
+      mass.m_ref = Units::KilogramsMass(MASS_KG);
+      mass.m_min = Units::KilogramsMass(39000);
+      mass.m_max = Units::KilogramsMass(77000);
+      mass.m_pyld = Units::KilogramsMass(21500);
+      return mass;
+   }
+
+   aaesim::open_source::bada_utils::FlightEnvelope GetFlightEnvelopeInformation() const override {
+      aaesim::open_source::bada_utils::FlightEnvelope flight_envelope{};
+      flight_envelope.V_mo = Units::KnotsSpeed(350);
+      flight_envelope.M_mo = 0.82;
+      flight_envelope.h_mo = Units::FeetLength(41000);
+      flight_envelope.h_max = Units::FeetLength(39000);
+      return flight_envelope;
+   }
+
+   aaesim::open_source::bada_utils::Aerodynamics GetAerodynamicsInformation() const override {
+      aaesim::open_source::bada_utils::Aerodynamics aerodynamics{};
+      aerodynamics.S = Units::MetersArea(WING_AREA_M2);
+      aerodynamics.cruise.V_stall = Units::KnotsSpeed(145);
+      aerodynamics.cruise.cd0 = CRUISE_CD0;
+      aerodynamics.cruise.cd2 = CRUISE_CD2;
+      aerodynamics.initial_climb.V_stall = Units::KnotsSpeed(125);
+      aerodynamics.take_off.V_stall = Units::KnotsSpeed(115);
+      aerodynamics.approach.V_stall = Units::KnotsSpeed(110);
+      aerodynamics.landing.V_stall = Units::KnotsSpeed(105);
+      return aerodynamics;
+   }
+
+   aaesim::open_source::bada_utils::EngineThrust GetEngineThrustInformation() const override { return {}; }
+
+   aaesim::open_source::bada_utils::FuelFlow GetFuelFlowInformation() const override { return {}; }
+
+   aaesim::open_source::bada_utils::GroundMovement GetGroundMovementInformation() const override { return {}; }
+
+   aaesim::open_source::bada_utils::Procedure GetProcedureInformation(unsigned int index) const override {
+      return {};
+   }
+
+   aaesim::open_source::bada_utils::AircraftPerformance GetAircraftPerformanceInformation() const override {
+      return {};
+   }
+
+   std::string GetAircraftTypeIdentifier() const override { return "BENCHMARK_JET"; }
+
+  private:
+   static constexpr double MASS_KG = 64000.0;
+   static constexpr double WING_AREA_M2 = 122.6;
+   static constexpr double CRUISE_CD0 = 0.024;
+   static constexpr double CRUISE_CD2 = 0.0375;
+   static constexpr double MAX_CLIMB_THRUST_C1 = 140000.0;  // N
+   static constexpr double MAX_CLIMB_THRUST_C2 = 50000.0;   // ft
+   static constexpr double MAX_CLIMB_THRUST_C3 = 1.1e-10;   // 1/ft^2
+};
+}  // namespace aaesim::bench
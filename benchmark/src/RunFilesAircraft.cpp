@@ -0,0 +1,176 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "RunFilesAircraft.h"
+
+#include <stdexcept>
+
+#include "BenchmarkAircraftPerformance.h"
+#include "loader/DecodedStream.h"
+#include "public/AircraftControllerFactory.h"
+#include "public/DirectionOfFlightCourseCalculator.h"
+#include "public/FullWindTrueWeatherOperator.h"
+#include "public/LegacyPositionEstimator.h"
+#include "public/SimulationTime.h"
+#include "public/SingleTangentPlaneSequence.h"
+
+using namespace aaesim::open_source;
+
+namespace aaesim::bench {
+
+const std::string RunFilesAircraft::SCENARIO_FILE = "./test-framework-scenario.txt";
+const std::string RunFilesAircraft::GUIDANCE_FILE = "../benchmark/resources/run-files-guidance.txt";
+const std::string RunFilesAircraft::ENV_FILE = "./FimAcTv-P~W_JET_ENV.csv";
+const std::size_t RunFilesAircraft::MAX_FLIGHT_CYCLES = 3 * 3600;
+
+RunFilesAircraft::RunFilesAircraft() : m_guidance_loader(), m_guidance() {
+   SingleTangentPlaneSequence::ClearStaticMembers();
+
+   DecodedStream stream;
+   if (!stream.open_file(GUIDANCE_FILE)) {
+      throw std::runtime_error("Cannot open file " + GUIDANCE_FILE + "; run the benchmarks from Run_Files/");
+   }
+   stream.set_echo(false);
+   m_guidance_loader.load(&stream);
+   m_guidance = m_guidance_loader.BuildGuidanceCalculator();
+}
+
+const RunFilesAircraft &RunFilesAircraft::GetInstance() {
+   static const RunFilesAircraft instance;
+   return instance;
+}
+
+const RunFilesAircraft::ReferenceFlight &RunFilesAircraft::GetReferenceFlight() {
+   static const ReferenceFlight reference_flight = GetInstance().FlyReferenceFlight();
+   return reference_flight;
+}
+
+RunFilesAircraft::FlightModel RunFilesAircraft::BuildFlightModel(IntegrationMethod integration_method) const {
+   const SimulationTime start_time = SimulationTime::Of(Units::ZERO_TIME);
+   const double mass_fraction = 0.5;
+   const auto &vertical_data = m_guidance->GetVerticalData();
+   const Units::MetersLength initial_altitude(vertical_data.m_altitude_meters.back());
+   const Units::MetersPerSecondSpeed initial_ias(vertical_data.m_ias_mps.back());
+
+   FlightModel model;
+   model.performance = std::make_shared<BenchmarkAircraftPerformance>();
+   model.guidance = BuildGuidance();
+   model.true_weather = std::make_shared<fmacm::WeatherTruthFromStaticData>();
+   model.true_weather->Initialize(ENV_FILE, initial_altitude,
+                                  fmacm::WeatherTruthFromStaticData::DataIndexParameter::SIMULATION_TIME);
+
+   // start where the path starts, as the loader does for a valid HFP file
+   Units::MetersLength start_x, start_y;
+   Units::UnsignedRadiansAngle start_course;
+   PositionCalculator position_calculator(m_guidance->GetExtendedHorizontalPath(),
+                                          TrajectoryIndexProgressionDirection::DECREMENTING);
+   position_calculator.CalculatePositionFromAlongPathDistance(
+         Units::MetersLength(GetHorizontalPath().back().m_path_length_cumulative_meters), start_x, start_y,
+         start_course);
+   const auto initial_position_enu = EarthModel::LocalPositionEnu::Of(start_x, start_y, Units::zero());
+   EarthModel::GeodeticPosition initial_position;
+   GetTangentPlaneSequence()->ConvertLocalToGeodetic(initial_position_enu, initial_position);
+
+   const Units::Angle initial_heading =
+         DirectionOfFlightCourseCalculator(m_guidance->GetExtendedHorizontalPath(),
+                                           TrajectoryIndexProgressionDirection::UNDEFINED)
+               .GetCourseAtPathStart();
+   model.true_weather->Update(start_time, Units::infinity(), initial_altitude);
+   const Units::Speed initial_tas = model.true_weather->getAtmosphere()->CAS2TAS(initial_ias, initial_altitude);
+   std::shared_ptr<EllipsoidalPositionEstimator> position_estimator =
+         std::make_shared<LegacyPositionEstimator>(GetTangentPlaneSequence(), initial_position);
+   std::shared_ptr<TrueWeatherOperator> true_weather_operator =
+         std::make_shared<FullWindTrueWeatherOperator>(model.true_weather);
+   model.dynamics = std::make_shared<ThreeDOFDynamics>();
+   model.dynamics->SetIntegrationMethod(integration_method);
+   model.dynamics->Initialize(start_time, model.performance, initial_position, initial_position_enu,
+                              initial_altitude, initial_tas, initial_heading, mass_fraction, position_estimator,
+                              true_weather_operator);
+
+   auto descent_config = AircraftControllerFactory::DescentSpeedControlConfig{
+         AircraftControllerFactory::DescentSpeedControlStrategy::PITCH, Units::KnotsSpeed(20.0),
+         Units::FeetLength(500.0)};
+   auto config = AircraftControllerFactory::AircraftControllerConfig{descent_config, Units::DegreesAngle{30}};
+   model.control = AircraftControllerFactory::BuildForCruiseDescentOnly(config);
+   model.control->Initialize(model.performance);
+
+   const auto wind_components = model.dynamics->GetWindComponents();
+   model.initial_state = AircraftState::Builder(1, start_time.GetCurrentSimulationTime())
+                               .Position(initial_position_enu.x, initial_position_enu.y)
+                               ->Latitude(initial_position.latitude)
+                               ->Longitude(initial_position.longitude)
+                               ->AltitudeMsl(initial_altitude)
+                               ->GroundSpeed(model.dynamics->GetDynamicsState().xd,
+                                             model.dynamics->GetDynamicsState().yd)
+                               ->SensedWindComponents(wind_components.first, wind_components.second)
+                               ->DynamicsState(model.dynamics->GetDynamicsState())
+                               ->Build();
+   return model;
+}
+
+std::shared_ptr<TestFrameworkAircraft> RunFilesAircraft::BuildAircraft(IntegrationMethod integration_method) const {
+   FlightModel model = BuildFlightModel(integration_method);
+   TestFrameworkAircraft::Builder builder;
+   return builder.WithInitialState(model.initial_state)
+         ->WithAircraftPerformance(model.performance)
+         ->WithAircraftDynamics(model.dynamics)
+         ->WithAircraftControl(model.control)
+         ->WithTrueWeather(model.true_weather)
+         ->WithGuidanceCalculator(model.guidance)
+         ->Build();
+}
+
+std::size_t RunFilesAircraft::Fly(TestFrameworkAircraft &aircraft, std::size_t max_cycles) {
+   SimulationTime time;
+   std::size_t cycles = 0;
+   bool finished = false;
+   while (!finished && cycles < max_cycles) {
+      time.Increment();
+      finished = aircraft.Update(time);
+      ++cycles;
+   }
+   return cycles;
+}
+
+RunFilesAircraft::ReferenceFlight RunFilesAircraft::FlyReferenceFlight() const {
+   auto aircraft = BuildAircraft(IntegrationMethod::FORWARD_EULER);
+   Fly(*aircraft, MAX_FLIGHT_CYCLES);
+
+   // replay the flown states through fresh guidance to recover what the dynamics were given each cycle
+   ReferenceFlight flight;
+   flight.states = aircraft->GetAircraftStates();
+   auto guidance = BuildGuidance();
+   for (auto state = flight.states.cbegin(); state + 1 != flight.states.cend(); ++state) {
+      flight.guidance.push_back(guidance->Update(*state));
+   }
+   return flight;
+}
+
+std::shared_ptr<fmacm::GuidanceFromStaticData> RunFilesAircraft::BuildGuidance() const {
+   return std::make_shared<fmacm::GuidanceFromStaticData>(*m_guidance);
+}
+
+const std::vector<HorizontalPath> &RunFilesAircraft::GetHorizontalPath() const {
+   return m_guidance->GetHorizontalTrajectory();
+}
+
+std::shared_ptr<TangentPlaneSequence> RunFilesAircraft::GetTangentPlaneSequence() const {
+   return m_guidance_loader.GetTangentPlaneSequence();
+}
+}  // namespace aaesim::bench
@@ -0,0 +1,102 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "framework/GuidanceDataLoader.h"
+#include "framework/GuidanceFromStaticData.h"
+#include "framework/TestFrameworkAircraft.h"
+#include "public/AircraftControl.h"
+#include "public/AircraftState.h"
+#include "public/Guidance.h"
+#include "public/RungeKuttaIntegrator.h"
+#include "public/TangentPlaneSequence.h"
+#include "public/ThreeDOFDynamics.h"
+
+namespace aaesim::bench {
+/**
+ * The FimAcTv-P~W_JET aircraft from Run_Files/, assembled the way FrameworkAircraftLoader builds a framework aircraft
+ * but flown with BenchmarkAircraftPerformance. File names are relative to Run_Files/, which is where the benchmarks
+ * run.
+ */
+class RunFilesAircraft final {
+  public:
+   static const std::string SCENARIO_FILE;
+   static const std::string GUIDANCE_FILE;
+   static const std::string ENV_FILE;
+
+   /**
+    * The parts of one aircraft that TestFrameworkAircraft::Update drives each cycle, initialized at the path start.
+    */
+   struct FlightModel {
+      std::shared_ptr<aaesim::open_source::FixedMassAircraftPerformance> performance;
+      std::shared_ptr<fmacm::WeatherTruthFromStaticData> true_weather;
+      std::shared_ptr<fmacm::GuidanceFromStaticData> guidance;
+      std::shared_ptr<aaesim::open_source::ThreeDOFDynamics> dynamics;
+      std::shared_ptr<aaesim::open_source::AircraftControl> control;
+      aaesim::open_source::AircraftState initial_state;
+   };
+
+   /**
+    * A flight of the whole path: the state after every cycle, starting with the initial state, and the guidance that
+    * produced each of them.
+    */
+   struct ReferenceFlight {
+      std::vector<aaesim::open_source::AircraftState> states;
+      std::vector<aaesim::open_source::Guidance> guidance;
+   };
+
+   RunFilesAircraft();
+
+   /** Loaded on first use and shared by all benchmarks. */
+   static const RunFilesAircraft &GetInstance();
+
+   /** Flown on first use with forward Euler integration and shared by all benchmarks. */
+   static const ReferenceFlight &GetReferenceFlight();
+
+   FlightModel BuildFlightModel(aaesim::open_source::IntegrationMethod integration_method) const;
+
+   std::shared_ptr<TestFrameworkAircraft> BuildAircraft(
+         aaesim::open_source::IntegrationMethod integration_method) const;
+
+   /**
+    * Fly the aircraft until it reaches the end of the path, or until max_cycles have been simulated.
+    */
+   static std::size_t Fly(TestFrameworkAircraft &aircraft, std::size_t max_cycles);
+
+   ReferenceFlight FlyReferenceFlight() const;
+
+   std::shared_ptr<fmacm::GuidanceFromStaticData> BuildGuidance() const;
+
+   const std::vector<aaesim::open_source::HorizontalPath> &GetHorizontalPath() const;
+
+   std::shared_ptr<TangentPlaneSequence> GetTangentPlaneSequence() const;
+
+   /** More than enough for the Run_Files flight, which takes about twenty minutes. */
+   static const std::size_t MAX_FLIGHT_CYCLES;
+
+  private:
+   fmacm::GuidanceDataLoader m_guidance_loader;
+   std::shared_ptr<fmacm::GuidanceFromStaticData> m_guidance;
+};
+}  // namespace aaesim::bench
@@ -0,0 +1,82 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include <benchmark/benchmark.h>
+
+#include "RunFilesAircraft.h"
+#include "public/SimulationTime.h"
+
+using namespace aaesim::open_source;
+using namespace aaesim::bench;
+
+static void BM_ThreeDOFDynamicsUpdate(benchmark::State &state) {
+   const auto integration_method = static_cast<IntegrationMethod>(state.range(0));
+   const auto &flight = RunFilesAircraft::GetReferenceFlight();
+   for (auto _ : state) {
+      state.PauseTiming();
+      auto model = RunFilesAircraft::GetInstance().BuildFlightModel(integration_method);
+      SimulationTime time;
+      state.ResumeTiming();
+      for (const auto &guidance : flight.guidance) {
+         time.Increment();
+         benchmark::DoNotOptimize(model.dynamics->Update(1, time, guidance, model.control));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * flight.guidance.size());
+}
+BENCHMARK(BM_ThreeDOFDynamicsUpdate)
+      ->Arg(static_cast<int>(IntegrationMethod::FORWARD_EULER))
+      ->Arg(static_cast<int>(IntegrationMethod::RUNGE_KUTTA_4))
+      ->Arg(static_cast<int>(IntegrationMethod::DORMAND_PRINCE))
+      ->Unit(benchmark::kMillisecond);
+
+static void BM_GuidanceFromStaticDataUpdate(benchmark::State &state) {
+   const auto &flight = RunFilesAircraft::GetReferenceFlight();
+   for (auto _ : state) {
+      state.PauseTiming();
+      auto guidance_calculator = RunFilesAircraft::GetInstance().BuildGuidance();
+      state.ResumeTiming();
+      for (auto aircraft_state = flight.states.cbegin(); aircraft_state + 1 != flight.states.cend();
+           ++aircraft_state) {
+         benchmark::DoNotOptimize(guidance_calculator->Update(*aircraft_state));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * flight.guidance.size());
+}
+BENCHMARK(BM_GuidanceFromStaticDataUpdate)->Unit(benchmark::kMicrosecond);
+
+/*
+ * The whole Run_Files flight, from the path start to its end, through TestFrameworkAircraft::Update.
+ */
+static void BM_RunFilesFlight(benchmark::State &state) {
+   const auto integration_method = static_cast<IntegrationMethod>(state.range(0));
+   std::size_t cycles = 0;
+   for (auto _ : state) {
+      state.PauseTiming();
+      auto aircraft = RunFilesAircraft::GetInstance().BuildAircraft(integration_method);
+      state.ResumeTiming();
+      cycles = RunFilesAircraft::Fly(*aircraft, RunFilesAircraft::MAX_FLIGHT_CYCLES);
+   }
+   state.counters["cycles"] = static_cast<double>(cycles);
+   state.SetItemsProcessed(state.iterations() * cycles);
+}
+BENCHMARK(BM_RunFilesFlight)
+      ->Arg(static_cast<int>(IntegrationMethod::FORWARD_EULER))
+      ->Arg(static_cast<int>(IntegrationMethod::DORMAND_PRINCE))
+      ->Unit(benchmark::kMillisecond);
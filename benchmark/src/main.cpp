@@ -0,0 +1,40 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include <stdlib.h>
+#include <benchmark/benchmark.h>
+
+#include "public/Logging.h"
+#include <log4cplus/initializer.h>
+
+int main(int argc, char **argv) {
+   log4cplus::Initializer initializer;
+   LoadLoggerProperties();
+   if (getenv("LOG4CPLUS_PROPERTIES") == NULL) {
+      // debug logging would dominate the timings; a properties file can still ask for it
+      log4cplus::Logger::getRoot().setLogLevel(log4cplus::WARN_LOG_LEVEL);
+   }
+   benchmark::Initialize(&argc, argv);
+   if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+      return 1;
+   }
+   benchmark::RunSpecifiedBenchmarks();
+   benchmark::Shutdown();
+   return 0;
+}
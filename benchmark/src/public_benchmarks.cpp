@@ -0,0 +1,160 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "RunFilesAircraft.h"
+#include "loader/DecodedStream.h"
+#include "public/AlongPathDistanceCalculator.h"
+#include "public/TabulatedAtmosphere.h"
+#include "public/USStandardAtmosphere1976.h"
+#include "utility/CustomUnits.h"
+
+using namespace aaesim::open_source;
+using namespace aaesim::bench;
+
+namespace {
+std::vector<Units::Length> StandardAltitudes() {
+   std::vector<Units::Length> altitudes;
+   for (int altitude_feet = 0; altitude_feet <= 45000; altitude_feet += 100) {
+      altitudes.push_back(Units::FeetLength(altitude_feet));
+   }
+   return altitudes;
+}
+}  // namespace
+
+static void BM_AlongPathDistanceCalculator(benchmark::State &state) {
+   const auto &horizontal_path = RunFilesAircraft::GetInstance().GetHorizontalPath();
+   const auto &flight = RunFilesAircraft::GetReferenceFlight();
+   for (auto _ : state) {
+      AlongPathDistanceCalculator distance_calculator(horizontal_path,
+                                                      TrajectoryIndexProgressionDirection::DECREMENTING);
+      Units::Length distance_along_path;
+      for (const auto &aircraft_state : flight.states) {
+         distance_calculator.CalculateAlongPathDistanceFromPosition(
+               aircraft_state.GetPositionEnuX(), aircraft_state.GetPositionEnuY(), distance_along_path);
+         benchmark::DoNotOptimize(distance_along_path);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * flight.states.size());
+}
+BENCHMARK(BM_AlongPathDistanceCalculator)->Unit(benchmark::kMicrosecond);
+
+static void BM_TangentPlaneSequenceConvertLocalToGeodetic(benchmark::State &state) {
+   const auto tangent_plane_sequence = RunFilesAircraft::GetInstance().GetTangentPlaneSequence();
+   const auto &flight = RunFilesAircraft::GetReferenceFlight();
+   for (auto _ : state) {
+      EarthModel::GeodeticPosition geodetic_position;
+      for (const auto &aircraft_state : flight.states) {
+         tangent_plane_sequence->ConvertLocalToGeodetic(
+               EarthModel::LocalPositionEnu::Of(aircraft_state.GetPositionEnuX(), aircraft_state.GetPositionEnuY(),
+                                                aircraft_state.GetAltitudeMsl()),
+               geodetic_position);
+         benchmark::DoNotOptimize(geodetic_position);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * flight.states.size());
+}
+BENCHMARK(BM_TangentPlaneSequenceConvertLocalToGeodetic)->Unit(benchmark::kMicrosecond);
+
+static void BM_TangentPlaneSequenceConvertLocalToGeodeticBatch(benchmark::State &state) {
+   const auto tangent_plane_sequence = RunFilesAircraft::GetInstance().GetTangentPlaneSequence();
+   const auto &flight = RunFilesAircraft::GetReferenceFlight();
+   std::vector<EarthModel::LocalPositionEnu> local_positions;
+   for (const auto &aircraft_state : flight.states) {
+      local_positions.push_back(EarthModel::LocalPositionEnu::Of(
+            aircraft_state.GetPositionEnuX(), aircraft_state.GetPositionEnuY(), aircraft_state.GetAltitudeMsl()));
+   }
+   std::vector<EarthModel::GeodeticPosition> geodetic_positions;
+   for (auto _ : state) {
+      tangent_plane_sequence->ConvertLocalToGeodetic(local_positions, geodetic_positions);
+      benchmark::DoNotOptimize(geodetic_positions.data());
+   }
+   state.SetItemsProcessed(state.iterations() * flight.states.size());
+}
+BENCHMARK(BM_TangentPlaneSequenceConvertLocalToGeodeticBatch)->Unit(benchmark::kMicrosecond);
+
+static void BM_StandardAtmosphereAirDensity(benchmark::State &state) {
+   const USStandardAtmosphere1976 atmosphere;
+   const auto altitudes = StandardAltitudes();
+   for (auto _ : state) {
+      Units::Density density;
+      Units::Pressure pressure;
+      for (const auto &altitude : altitudes) {
+         atmosphere.AirDensity(altitude, density, pressure);
+         benchmark::DoNotOptimize(density);
+         benchmark::DoNotOptimize(pressure);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * altitudes.size());
+}
+BENCHMARK(BM_StandardAtmosphereAirDensity);
+
+static void BM_TabulatedAtmosphereAirDensity(benchmark::State &state) {
+   const TabulatedAtmosphere atmosphere(std::make_unique<USStandardAtmosphere1976>());
+   const auto altitudes = StandardAltitudes();
+   for (auto _ : state) {
+      Units::Density density;
+      Units::Pressure pressure;
+      for (const auto &altitude : altitudes) {
+         atmosphere.AirDensity(altitude, density, pressure);
+         benchmark::DoNotOptimize(density);
+         benchmark::DoNotOptimize(pressure);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * altitudes.size());
+}
+BENCHMARK(BM_TabulatedAtmosphereAirDensity);
+
+static void BM_StandardAtmosphereCas2Tas(benchmark::State &state) {
+   const USStandardAtmosphere1976 standard_atmosphere;
+   const Atmosphere &atmosphere = standard_atmosphere;  // the altitude overload lives in the base class
+   const auto altitudes = StandardAltitudes();
+   const Units::KnotsSpeed calibrated_airspeed(250);
+   for (auto _ : state) {
+      for (const auto &altitude : altitudes) {
+         benchmark::DoNotOptimize(atmosphere.CAS2TAS(calibrated_airspeed, altitude));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * altitudes.size());
+}
+BENCHMARK(BM_StandardAtmosphereCas2Tas);
+
+static void BM_LoaderParseScenarioFile(benchmark::State &state) {
+   std::size_t token_count = 0;
+   for (auto _ : state) {
+      DecodedStream stream;
+      if (!stream.open_file(RunFilesAircraft::SCENARIO_FILE)) {
+         state.SkipWithError("cannot open the scenario file; run the benchmarks from Run_Files/");
+         break;
+      }
+      stream.set_echo(false);
+      std::string token;
+      token_count = 0;
+      while (stream.get_datum(token)) {
+         ++token_count;
+      }
+      benchmark::DoNotOptimize(token);
+   }
+   state.counters["tokens"] = static_cast<double>(token_count);
+}
+BENCHMARK(BM_LoaderParseScenarioFile)->Unit(benchmark::kMicrosecond);
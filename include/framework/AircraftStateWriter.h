@@ -19,18 +19,40 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stdexcept>
+
 #include "public/OutputHandler.h"
 #include "public/AircraftState.h"
 
 namespace fmacm {
-class AircraftStateWriter final : public OutputHandler {
+class AircraftStateWriter : public OutputHandler {
   public:
+   enum OutputFormat { CSV, BINARY };
+   static OutputFormat OutputFormatFromString(std::string s) {
+      std::transform(s.cbegin(), s.cend(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+      if (s == "csv") return OutputFormat::CSV;
+      if (s == "binary") return OutputFormat::BINARY;
+      std::string msg = "Invalid OutputFormat string: '" + s + "'. Must be 'csv' or 'binary'.";
+      throw std::runtime_error(msg);
+   };
+   static std::unique_ptr<AircraftStateWriter> Create(OutputFormat output_format);
+
+   static const std::size_t COLUMN_COUNT = 10;
+
    AircraftStateWriter() : OutputHandler("", "_AcStates.csv"), m_data_to_write() {}
+   virtual ~AircraftStateWriter() = default;
    void Finish() override;
-   void Gather(std::vector<aaesim::open_source::AircraftState> aircraft_states);
+   void Gather(const std::vector<aaesim::open_source::AircraftState> &aircraft_states);
+
+   /**
+    * Gather the states of one Monte Carlo iteration. Once any iteration has been gathered, the file starts with an
+    * ITERATION_COLUMN_NAME column that holds the iteration of each row.
+    */
+   void Gather(const std::vector<aaesim::open_source::AircraftState> &aircraft_states, int iteration);
 
-  private:
-   static std::vector<std::string> COLUMN_NAMES;
    struct DataToWrite {
       DataToWrite() {
          simulation_time = Units::NegInfinity();
@@ -55,8 +77,28 @@ class AircraftStateWriter final : public OutputHandler {
       Units::Length altitude_msl;
       Units::Speed dynamics_ground_speed;
       Units::DegreesAngle latitude, longitude;
+      int iteration{0};
    };
 
+   // row formatting shared with the streaming writer so that both produce identical files
+   static DataToWrite ExtractDataToWrite(const aaesim::open_source::AircraftState &state);
+   static void WriteColumnNames(mini::csv::ofstream &os, bool with_iteration = false);
+   static void WriteRow(mini::csv::ofstream &os, const DataToWrite &data_row, bool with_iteration = false);
+
+   // the values of one row in COLUMN_NAMES order and units
+   static std::array<double, COLUMN_COUNT> ColumnValues(const DataToWrite &data_row);
+   static const std::vector<std::string> &GetColumnNames() { return COLUMN_NAMES; }
+
+   static const int OUTPUT_PRECISION;
+   static const std::string ITERATION_COLUMN_NAME;
+
+  protected:
+   AircraftStateWriter(const std::string &file_suffix) : OutputHandler("", file_suffix), m_data_to_write() {}
+
    std::vector<DataToWrite> m_data_to_write;
+   bool m_with_iteration{false};
+
+  private:
+   static std::vector<std::string> COLUMN_NAMES;
 };
 }  // namespace fmacm
@@ -22,11 +22,13 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <optional>
 
 #include "public/LoggingLoadable.h"
 #include "public/FlightDeckApplication.h"
 #include "public/WeatherPrediction.h"
 #include "framework/SpeedCommandsLoader.h"
+#include "public/PhiloxRandomGenerator.h"
 #include "scalar/Time.h"
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
@@ -47,21 +49,48 @@ class ApplicationLoader final : public Loadable {
 
    bool IsLoaded() const { return m_loaded; }
 
+   /**
+    * Enable the pilot delay with the given mean and standard deviation, replacing the loaded configuration.
+    */
+   void SetPilotDelay(Units::Time mean, Units::Time standard_deviation) {
+      m_pilot_delay_configuration.Set(mean, standard_deviation);
+   }
+   /**
+    * Draw the pilot delays of the created application from random_stream instead of the thread's shared generator.
+    */
+   void SetRandomStream(const PhiloxRandomGenerator &random_stream) { m_random_stream = random_stream; }
+   void SetInputTableCache(std::shared_ptr<InputTableCache> input_tables) {
+      m_im_speed_command_file.SetInputTableCache(std::move(input_tables));
+   }
+   bool IsPilotDelayEnabled() const { return m_pilot_delay_configuration.IsEnabled(); }
+   Units::SecondsTime GetPilotDelayMean() const { return m_pilot_delay_configuration.DelayDuration(); }
+   Units::SecondsTime GetPilotDelayStandardDeviation() const {
+      return m_pilot_delay_configuration.DelayStandardDeviation();
+   }
+
   private:
    class PilotConfiguration final : public Loadable {
      public:
-      PilotConfiguration() : m_is_enabled(false), m_delay_duration(0) {}
+      PilotConfiguration() : m_is_enabled(false), m_delay_duration(0), m_delay_standard_deviation(0) {}
       bool load(DecodedStream *input) override;
+      void Set(Units::Time mean, Units::Time standard_deviation) {
+         m_is_enabled = true;
+         m_delay_duration = mean;
+         m_delay_standard_deviation = standard_deviation;
+      }
       bool IsEnabled() const { return m_is_enabled; }
       Units::SecondsTime DelayDuration() const { return m_delay_duration; }
+      Units::SecondsTime DelayStandardDeviation() const { return m_delay_standard_deviation; }
 
      private:
       bool m_is_enabled;
       Units::SecondsTime m_delay_duration;
+      Units::SecondsTime m_delay_standard_deviation;
    };
    bool m_loaded{false};
    fmacm::loader::SpeedCommandsLoader m_im_speed_command_file{};
    PilotConfiguration m_pilot_delay_configuration{};
+   std::optional<PhiloxRandomGenerator> m_random_stream{};
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
    interval_management::open_source::IMTimeBasedAchieve m_sample_algorithm_time_goal;
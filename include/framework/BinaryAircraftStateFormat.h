@@ -0,0 +1,77 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace fmacm {
+/**
+ * Layout of the binary columnar aircraft state file.
+ *
+ * All integers and values are little-endian.
+ *
+ *   offset  size  content
+ *   0       8     magic "FMACMBIN"
+ *   8       4     format version (uint32)
+ *   12      4     column count C (uint32)
+ *   16      8     row count R (uint64)
+ *   24      8     data offset D (uint64), a multiple of 8
+ *   32      ...   C column names, each a uint32 length followed by that many characters
+ *   ...           zero padding up to D
+ *   D       8*R*C column data: all R doubles of column 0, then all R doubles of column 1, ...
+ *
+ * Because the data block is 8-byte aligned and column-major, a column can be used in place from a memory-mapped file.
+ */
+namespace binary_aircraft_state_format {
+inline const std::string MAGIC{"FMACMBIN"};
+inline constexpr std::uint32_t FORMAT_VERSION{1};
+inline constexpr std::size_t FIXED_HEADER_SIZE{32};
+inline constexpr std::size_t DATA_ALIGNMENT{8};
+
+template <typename T>
+inline void EncodeLittleEndian(T value, char *destination) {
+   unsigned char bytes[sizeof(T)];
+   std::memcpy(bytes, &value, sizeof(T));
+   if constexpr (std::endian::native == std::endian::big) {
+      for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+         std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+      }
+   }
+   std::memcpy(destination, bytes, sizeof(T));
+}
+
+template <typename T>
+inline T DecodeLittleEndian(const char *source) {
+   unsigned char bytes[sizeof(T)];
+   std::memcpy(bytes, source, sizeof(T));
+   if constexpr (std::endian::native == std::endian::big) {
+      for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+         std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+      }
+   }
+   T value;
+   std::memcpy(&value, bytes, sizeof(T));
+   return value;
+}
+}  // namespace binary_aircraft_state_format
+}  // namespace fmacm
@@ -0,0 +1,51 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace fmacm {
+/**
+ * Reads a file written by BinaryAircraftStateWriter.
+ */
+class BinaryAircraftStateReader final {
+  public:
+   explicit BinaryAircraftStateReader(const std::string &file_name);
+   ~BinaryAircraftStateReader() = default;
+
+   const std::vector<std::string> &GetColumnNames() const { return m_column_names; }
+   std::size_t GetRowCount() const { return m_row_count; }
+   const std::vector<double> &GetColumn(std::size_t column_index) const { return m_columns.at(column_index); }
+
+   /**
+    * Writes the content in the same column layout as the CSV state writer. The default precision is enough to
+    * reproduce every value exactly.
+    */
+   void WriteCsv(std::ostream &os, int precision) const;
+   void WriteCsv(std::ostream &os) const;
+
+  private:
+   std::vector<std::string> m_column_names;
+   std::size_t m_row_count;
+   std::vector<std::vector<double>> m_columns;
+};
+}  // namespace fmacm
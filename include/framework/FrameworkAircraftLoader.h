@@ -33,19 +33,45 @@ class FrameworkAircraftLoader final : public LoggingLoadable {
    bool load(DecodedStream *input) override;
    std::shared_ptr<TestFrameworkAircraft> BuildAircraft();
 
+   // Overrides applied before BuildAircraft(), used to vary a copy of this loader between Monte Carlo iterations
+   void SetMassFraction(double mass_fraction) { m_mass_fraction = mass_fraction; }
+   void SetWindScaleFactor(double wind_scale_factor) { m_wind_scale_factor = wind_scale_factor; }
+   void SetPilotDelay(Units::Time mean, Units::Time standard_deviation) {
+      m_flightdeck_application_loader.SetPilotDelay(mean, standard_deviation);
+   }
+   void SetRandomStream(const PhiloxRandomGenerator &random_stream) {
+      m_flightdeck_application_loader.SetRandomStream(random_stream);
+   }
+   // Parse the input files through input_tables, shared with the other aircraft of the scenario
+   void SetInputTableCache(std::shared_ptr<InputTableCache> input_tables) {
+      m_guidance_loader.SetInputTableCache(input_tables);
+      m_flightdeck_application_loader.SetInputTableCache(input_tables);
+      m_input_tables = std::move(input_tables);
+   }
+   double GetMassFraction() const { return m_mass_fraction; }
+   double GetWindScaleFactor() const { return m_wind_scale_factor; }
+   const fmacm::ApplicationLoader &GetFlightDeckApplicationLoader() const { return m_flightdeck_application_loader; }
+
   private:
    static double m_mass_fraction_default, m_start_time_default;
    int m_start_time{0};
    double m_mass_fraction{0};
+   double m_wind_scale_factor{1};
    std::string m_ac_type{};
    std::string m_speed_management_type{};
    std::string m_ttv_csv_file{};
    std::string m_forewind_csv_file{};
    std::string m_env_csv_file{};
    std::string m_env_csv_data_index{};
+   bool m_env_csv_interpolate{false};
+   bool m_tabulated_atmosphere{false};
+   std::string m_dynamics_integrator{};
+   std::string m_dynamics_history{};
+   int m_dynamics_history_length{1};
    fmacm::GuidanceDataLoader m_guidance_loader{};
    fmacm::ApplicationLoader m_flightdeck_application_loader{};
    EarthModel::LocalPositionEnu m_initial_local_position{};
+   std::shared_ptr<InputTableCache> m_input_tables{std::make_shared<InputTableCache>()};
 
    std::shared_ptr<aaesim::open_source::FixedMassAircraftPerformance> BuildAircraftPerformance(
          std::string bada_aircraft_code);
@@ -59,6 +85,8 @@ class FrameworkAircraftLoader final : public LoggingLoadable {
          std::shared_ptr<aaesim::open_source::FixedMassAircraftPerformance> &bada_calculator);
    std::shared_ptr<fmacm::WeatherTruthFromStaticData> BuildTrueWeather(std::string env_csv_file,
                                                                        std::string env_csv_data_index,
+                                                                       bool interpolate_between_rows,
+                                                                       bool tabulated_atmosphere,
                                                                        Units::Length initial_altitude);
    std::shared_ptr<aaesim::open_source::ADSBReceiver> BuildAdsbReceiver(std::string ttv_csv_file);
    aaesim::open_source::AircraftState BuildInitialState(
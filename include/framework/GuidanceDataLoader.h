@@ -24,6 +24,7 @@
 #include <list>
 
 #include "framework/GuidanceFromStaticData.h"
+#include "framework/InputTableCache.h"
 #include "public/TangentPlaneSequence.h"
 #include "HfpReader2020.h"
 #include "public/Waypoint.h"
@@ -38,12 +39,14 @@ class GuidanceDataLoader final : public Loadable {
         m_vfp_filename(),
         m_tangent_plane(),
         m_compute_xy(true),
-        m_planned_descent_parameters() {}
+        m_planned_descent_parameters(),
+        m_input_tables(std::make_shared<InputTableCache>()) {}
    bool load(DecodedStream *input) override;
    std::shared_ptr<GuidanceFromStaticData> BuildGuidanceCalculator();
    std::shared_ptr<TangentPlaneSequence> GetTangentPlaneSequence() const;
    const bool IsLoaded() const;
    GuidanceFromStaticData::PlannedDescentParameters GetPlannedDescentParameters() const;
+   void SetInputTableCache(std::shared_ptr<InputTableCache> input_tables) { m_input_tables = std::move(input_tables); }
 
   private:
    static log4cplus::Logger m_logger;
@@ -77,17 +80,35 @@ class GuidanceDataLoader final : public Loadable {
       NUM_HORIZONTAL_TRAJ_FIELDS
    };
 
+   // one row of an HFP file, as read by HfpReader2020
+   struct HfpRow {
+      std::string name;
+      Units::Length x, y, distance_to_go;
+      aaesim::open_source::HorizontalPath::SegmentType segment_type;
+      Units::UnsignedAngle course;
+      Units::Length turn_center_x, turn_center_y;
+      Units::UnsignedAngle angle_start_of_turn, angle_end_of_turn;
+      Units::Length turn_radius;
+      Units::Speed ground_speed;
+      Units::Angle bank_angle;
+      Units::Angle latitude, longitude;
+      Units::Angle turn_center_latitude, turn_center_longitude;
+   };
+   using HfpTable = std::vector<HfpRow>;
+
+   static HfpTable ReadHfpTable(const std::shared_ptr<const aaesim::open_source::CsvFile> &csv_file);
    static void DoDebugLogging(const std::vector<aaesim::open_source::HorizontalPath> &horizontal_path);
-   GuidanceFromStaticData::VerticalData BuildVerticalGuidanceData() const;
+   GuidanceFromStaticData::VerticalData ReadVerticalData(
+         const std::shared_ptr<const aaesim::open_source::CsvFile> &csv_file) const;
    std::pair<std::shared_ptr<TangentPlaneSequence>, std::vector<aaesim::open_source::HorizontalPath>> ProcessHfpData()
          const;
    std::pair<std::shared_ptr<TangentPlaneSequence>, std::vector<aaesim::open_source::HorizontalPath>>
          ProcessWaypointSequenceData() const;
    std::vector<aaesim::open_source::HorizontalPath> BuildHorizontalPathUsingAllColumns(
-         testvector::HfpReader2020 &hfp_reader) const;
+         const HfpTable &hfp_table) const;
    std::vector<aaesim::open_source::HorizontalPath> BuildHorizontalPathComputeEuclideanComponents(
-         testvector::HfpReader2020 &hfp_reader, std::shared_ptr<TangentPlaneSequence> &tangent_plane_sequence) const;
-   std::shared_ptr<TangentPlaneSequence> BuildTangentPlaneFromFileData() const;
+         const HfpTable &hfp_table, std::shared_ptr<TangentPlaneSequence> &tangent_plane_sequence) const;
+   std::shared_ptr<TangentPlaneSequence> BuildTangentPlaneFromFileData(const HfpTable &hfp_table) const;
    std::shared_ptr<TangentPlaneSequence> BuildTangentPlane(const std::list<Waypoint> &ordered_waypoints) const;
    void ComputeCourseColumnsInPlace(std::vector<aaesim::open_source::HorizontalPath> &horizontal_path) const;
 
@@ -96,6 +117,7 @@ class GuidanceDataLoader final : public Loadable {
    std::shared_ptr<TangentPlaneSequence> m_tangent_plane;
    bool m_compute_xy;
    GuidanceFromStaticData::PlannedDescentParameters m_planned_descent_parameters;
+   std::shared_ptr<InputTableCache> m_input_tables;
 };
 
 inline const bool GuidanceDataLoader::IsLoaded() const { return m_loaded; }
@@ -19,7 +19,9 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
+#include "public/ExtendedHorizontalPath.h"
 #include "public/HorizontalPath.h"
 #include "public/Guidance.h"
 #include "public/AircraftState.h"
@@ -30,6 +32,7 @@
 #include <scalar/Length.h>
 #include "public/AlongPathDistanceCalculator.h"
 #include "public/PositionCalculator.h"
+#include "public/ProfileInterpolator.h"
 #include "public/GuidanceCalculator.h"
 #include "utility/BoundedValue.h"
 
@@ -76,6 +79,11 @@ class GuidanceFromStaticData final : aaesim::open_source::GuidanceCalculator {
 
    const std::vector<aaesim::open_source::HorizontalPath> &GetHorizontalTrajectory() const;
 
+   /**
+    * @return the horizontal trajectory as shared by the calculators of this guidance
+    */
+   const std::shared_ptr<const aaesim::open_source::ExtendedHorizontalPath> &GetExtendedHorizontalPath() const;
+
   private:
    static log4cplus::Logger m_logger;
    enum TurnDirection { LEFT, RIGHT };
@@ -89,7 +97,8 @@ class GuidanceFromStaticData final : aaesim::open_source::GuidanceCalculator {
                                                              const Units::UnsignedAngle &estimated_course);
 
    VerticalData m_vertical_data;
-   std::vector<aaesim::open_source::HorizontalPath> m_horizontal_trajectory;
+   ProfileInterpolator m_profile_interpolator;
+   std::shared_ptr<const aaesim::open_source::ExtendedHorizontalPath> m_horizontal_path;
    aaesim::open_source::AlongPathDistanceCalculator m_decrementing_distance_calculator;
    aaesim::open_source::PositionCalculator m_decrementing_position_calculator;
    Units::Length m_estimated_distance_to_go;
@@ -102,7 +111,12 @@ inline const Units::MetersLength GuidanceFromStaticData::GetEstimatedDistanceAlo
 }
 
 inline const std::vector<aaesim::open_source::HorizontalPath> &GuidanceFromStaticData::GetHorizontalTrajectory() const {
-   return m_horizontal_trajectory;
+   return m_horizontal_path->GetUnmodifiedPath();
+}
+
+inline const std::shared_ptr<const aaesim::open_source::ExtendedHorizontalPath> &
+GuidanceFromStaticData::GetExtendedHorizontalPath() const {
+   return m_horizontal_path;
 }
 
 inline const GuidanceFromStaticData::VerticalData &GuidanceFromStaticData::GetVerticalData() const {
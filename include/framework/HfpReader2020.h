@@ -39,6 +39,8 @@ class HfpReader2020 final : public aaesim::open_source::DataReader {
 
    HfpReader2020(std::shared_ptr<std::istream> input_stream, int header_lines);
 
+   HfpReader2020(std::shared_ptr<const aaesim::open_source::CsvFile> csv_file, int header_lines);
+
    virtual ~HfpReader2020();
 
    Units::Length GetX();
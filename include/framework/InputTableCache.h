@@ -0,0 +1,134 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <typeindex>
+
+#include "public/CsvFile.h"
+
+namespace fmacm {
+
+/**
+ * Parsed input tables (HFP, VFP, ENV, speed commands) shared by the aircraft of a scenario.
+ *
+ * Entries are keyed by the table type and the content of the file, not its name: a file is parsed once however
+ * many aircraft or Monte Carlo iterations reference it, copies of a file share one entry, and an edited file is
+ * parsed again. Entries are immutable. The cache may be used from several threads; a table requested while
+ * another thread parses it waits for that parse.
+ *
+ * The content of each file is remembered by its canonical path, size and modification time, so a file that has not
+ * changed since it was last requested is found without being read or hashed again.
+ */
+class InputTableCache final {
+  public:
+   template <typename Table>
+   using Parser = std::function<Table(const std::shared_ptr<const aaesim::open_source::CsvFile> &)>;
+
+   InputTableCache() = default;
+
+   ~InputTableCache() = default;
+
+   /**
+    * The table that parse builds from file_name. Null if the file cannot be opened. An exception thrown by parse
+    * is passed to every caller waiting for that table, and the next request parses again.
+    */
+   template <typename Table>
+   std::shared_ptr<const Table> Get(const std::string &file_name, const Parser<Table> &parse);
+
+   std::size_t GetSize() const;
+
+   void Clear();
+
+  private:
+   using Key = std::tuple<std::type_index, std::size_t, std::uint64_t>;
+   using Entry = std::shared_future<std::shared_ptr<const void> >;
+   using ContentKey = std::pair<std::size_t, std::uint64_t>;
+   using FileStamp = std::tuple<std::string, std::uintmax_t, std::filesystem::file_time_type>;
+
+   static std::optional<FileStamp> GetFileStamp(const std::string &file_name);
+
+   std::optional<Entry> FindEntry(const std::type_index &table_type, const FileStamp &file_stamp) const;
+
+   mutable std::mutex m_mutex;
+   std::map<Key, Entry> m_entries;
+   std::map<FileStamp, ContentKey> m_content_keys;
+};
+
+template <typename Table>
+std::shared_ptr<const Table> InputTableCache::Get(const std::string &file_name, const Parser<Table> &parse) {
+   const auto file_stamp = GetFileStamp(file_name);
+   if (file_stamp) {
+      const auto remembered_entry = FindEntry(std::type_index(typeid(Table)), *file_stamp);
+      if (remembered_entry) {
+         return std::static_pointer_cast<const Table>(remembered_entry->get());
+      }
+   }
+
+   const auto csv_file = aaesim::open_source::CsvFile::Open(file_name);
+   if (!csv_file) {
+      return nullptr;
+   }
+   const ContentKey content_key(csv_file->GetText().size(), csv_file->GetContentHash());
+   const Key key(std::type_index(typeid(Table)), content_key.first, content_key.second);
+
+   std::promise<std::shared_ptr<const void> > parsed_table;
+   Entry entry;
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (file_stamp) {
+         m_content_keys.insert_or_assign(*file_stamp, content_key);
+      }
+      const auto found = m_entries.find(key);
+      if (found != m_entries.end()) {
+         entry = found->second;
+      } else {
+         m_entries.emplace(key, parsed_table.get_future().share());
+      }
+   }
+   if (entry.valid()) {
+      return std::static_pointer_cast<const Table>(entry.get());
+   }
+
+   try {
+      auto table = std::make_shared<const Table>(parse(csv_file));
+      parsed_table.set_value(table);
+      return table;
+   } catch (...) {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_entries.erase(key);
+      }
+      parsed_table.set_exception(std::current_exception());
+      throw;
+   }
+}
+
+}  // namespace fmacm
@@ -0,0 +1,105 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include "loader/Loadable.h"
+
+#include "public/Logging.h"
+#include "public/PhiloxRandomGenerator.h"
+#include "scalar/Time.h"
+
+namespace fmacm {
+/**
+ * The optional monte_carlo block of a scenario. It sets how many times the scenario is flown, the seed that
+ * determines every iteration, and the distributions that the varied aircraft parameters are drawn from.
+ */
+class MonteCarloLoader final : public Loadable {
+  public:
+   MonteCarloLoader() = default;
+   ~MonteCarloLoader() = default;
+
+   bool load(DecodedStream *input) override;
+
+   bool IsLoaded() const { return m_loaded; }
+   int GetIterationCount() const { return m_iterations; }
+   int GetIterationThreads() const { return m_iteration_threads; }
+
+   /**
+    * Random stream for one iteration. It depends only on the master seed and the iteration number, so an
+    * iteration draws the same values no matter which thread runs it or in which order.
+    */
+   PhiloxRandomGenerator IterationRandomStream(int iteration) const;
+
+   /**
+    * Draw an aircraft's initial mass fraction, or return configured_mass_fraction when no distribution is given.
+    */
+   double SampleMassFraction(PhiloxRandomGenerator &random_generator, double configured_mass_fraction) const;
+
+   /**
+    * Draw the factor applied to an iteration's true winds, or return 1 when no distribution is given.
+    */
+   double SampleWindScaleFactor(PhiloxRandomGenerator &random_generator) const;
+
+   bool HasPilotDelay() const { return m_pilot_delay.IsLoaded(); }
+   Units::SecondsTime GetPilotDelayMean() const { return m_pilot_delay.GetMean(); }
+   Units::SecondsTime GetPilotDelayStandardDeviation() const { return m_pilot_delay.GetStandardDeviation(); }
+
+  private:
+   class NormalDistribution final : public Loadable {
+     public:
+      NormalDistribution() = default;
+      bool load(DecodedStream *input) override;
+      bool IsLoaded() const { return m_loaded; }
+
+      // truncated at STANDARD_DEVIATION_LIMIT and then limited to [minimum, maximum]
+      double Sample(PhiloxRandomGenerator &random_generator, double minimum, double maximum) const;
+
+     private:
+      bool m_loaded{false};
+      double m_mean{0};
+      double m_standard_deviation{0};
+   };
+
+   class PilotDelayDistribution final : public Loadable {
+     public:
+      PilotDelayDistribution() = default;
+      bool load(DecodedStream *input) override;
+      bool IsLoaded() const { return m_loaded; }
+      Units::SecondsTime GetMean() const { return m_mean; }
+      Units::SecondsTime GetStandardDeviation() const { return m_standard_deviation; }
+
+     private:
+      bool m_loaded{false};
+      Units::SecondsTime m_mean{0};
+      Units::SecondsTime m_standard_deviation{0};
+   };
+
+   static log4cplus::Logger m_logger;
+   static const double STANDARD_DEVIATION_LIMIT;
+
+   bool m_loaded{false};
+   int m_iterations{1};
+   int m_master_seed{1};
+   int m_iteration_threads{1};
+   NormalDistribution m_mass_fraction{};
+   NormalDistribution m_wind_scale_factor{};
+   PilotDelayDistribution m_pilot_delay{};
+};
+}  // namespace fmacm
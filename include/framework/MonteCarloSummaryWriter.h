@@ -0,0 +1,56 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "public/OutputHandler.h"
+#include "scalar/Time.h"
+
+namespace fmacm {
+/**
+ * One row per aircraft per Monte Carlo iteration, listing the values drawn for that iteration.
+ * The aircraft states of a Monte Carlo run are written to the usual state file in the same order, so state_count
+ * identifies the rows of that file that belong to each row here.
+ */
+class MonteCarloSummaryWriter final : public OutputHandler {
+  public:
+   struct AircraftSummary {
+      int iteration{0};
+      int aircraft_index{0};
+      double initial_mass_fraction{0};
+      double wind_scale_factor{1};
+      Units::SecondsTime pilot_delay_mean{0};
+      Units::SecondsTime pilot_delay_standard_deviation{0};
+      std::size_t state_count{0};
+      Units::SecondsTime final_time{0};
+   };
+
+   MonteCarloSummaryWriter() : OutputHandler("", "_MonteCarlo.csv"), m_data_to_write() {}
+   ~MonteCarloSummaryWriter() = default;
+   void Finish() override;
+   void Gather(const AircraftSummary &summary) { m_data_to_write.push_back(summary); }
+
+  private:
+   static const std::vector<std::string> COLUMN_NAMES;
+   std::vector<AircraftSummary> m_data_to_write;
+};
+}  // namespace fmacm
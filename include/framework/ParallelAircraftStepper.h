@@ -0,0 +1,73 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <barrier>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "framework/TestFrameworkAircraft.h"
+#include "public/SimulationTime.h"
+
+namespace fmacm {
+/**
+ * Advances every aircraft of a scenario by one simulation cycle using a fixed set of worker threads.
+ *
+ * Aircraft do not depend on each other within a cycle, so each worker updates a fixed, contiguous slice of the
+ * aircraft list. The calling thread works the first slice and Step() does not return until every slice is done,
+ * which is the barrier required before the scenario increments its time. Each aircraft's result is written into its
+ * own slot. The outcome is identical to updating the aircraft sequentially only if each aircraft draws its random
+ * values, such as pilot delays, from its own stream (FrameworkAircraftLoader::SetRandomStream) rather than from the
+ * shared generator of whichever thread updates it. TestFrameworkScenario gives every aircraft its own stream.
+ */
+class ParallelAircraftStepper final {
+  public:
+   ParallelAircraftStepper(const std::vector<std::shared_ptr<TestFrameworkAircraft>> &aircraft,
+                           unsigned int number_of_threads);
+
+   ~ParallelAircraftStepper();
+
+   ParallelAircraftStepper(const ParallelAircraftStepper &) = delete;
+   ParallelAircraftStepper &operator=(const ParallelAircraftStepper &) = delete;
+
+   /**
+    * Update all aircraft for the given time.
+    *
+    * @return one entry per aircraft, in scenario order, holding the value returned by TestFrameworkAircraft::Update
+    */
+   const std::vector<char> &Step(const aaesim::open_source::SimulationTime &time);
+
+  private:
+   void UpdateSlice(unsigned int slice_index);
+   void WorkerLoop(unsigned int slice_index, Units::SecondsTime simulation_time_step);
+
+   const std::vector<std::shared_ptr<TestFrameworkAircraft>> &m_aircraft;
+   const unsigned int m_number_of_slices;
+   std::vector<char> m_aircraft_finished;
+   std::vector<std::exception_ptr> m_slice_failures;
+   const aaesim::open_source::SimulationTime *m_current_time;
+   bool m_stop_requested;
+   std::barrier<> m_cycle_start;
+   std::barrier<> m_cycle_end;
+   std::vector<std::thread> m_workers;
+};
+}  // namespace fmacm
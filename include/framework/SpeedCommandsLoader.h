@@ -23,20 +23,26 @@
 
 #include <filesystem>
 
+#include "framework/InputTableCache.h"
 #include "framework/SpeedCommandsFromStaticData.h"
 
 namespace fmacm::loader {
 class SpeedCommandsLoader final : public Loadable {
   public:
-   SpeedCommandsLoader() : m_loaded(false), m_file_path() {}
+   SpeedCommandsLoader()
+      : m_loaded(false), m_file_path(), m_input_tables(std::make_shared<fmacm::InputTableCache>()) {}
    bool load(DecodedStream *input) override;
    SpeedCommandsFromStaticData Build(Units::Time pilot_delay_duration) const;
    bool IsLoaded() const { return m_loaded; }
+   void SetInputTableCache(std::shared_ptr<fmacm::InputTableCache> input_tables) {
+      m_input_tables = std::move(input_tables);
+   }
 
   private:
-   const std::vector<SpeedCommandsFromStaticData::SpeedRecord> ReadStaticSpeedCommands(
-         const std::string &filename) const;
+   static std::vector<SpeedCommandsFromStaticData::SpeedRecord> ReadStaticSpeedCommands(
+         const std::shared_ptr<const aaesim::open_source::CsvFile> &csv_file);
    bool m_loaded;
    std::string m_file_path;
+   std::shared_ptr<fmacm::InputTableCache> m_input_tables;
 };
 }  // namespace fmacm::loader
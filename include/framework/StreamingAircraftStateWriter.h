@@ -0,0 +1,73 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "framework/AircraftStateWriter.h"
+#include "public/OutputHandler.h"
+#include "public/AircraftState.h"
+
+namespace fmacm {
+/**
+ * Writes the same file as AircraftStateWriter, but while the simulation runs.
+ *
+ * Rows are gathered per aircraft and handed to that aircraft's part file in batches, so memory use does not grow with
+ * the length of the flight. Finish() assembles the part files, in aircraft order, behind the column names; the result
+ * is identical to the file AircraftStateWriter would have written. If Finish() is never reached, for example because
+ * the scenario threw, the destructor finishes with whatever rows have been appended.
+ */
+class StreamingAircraftStateWriter final : public OutputHandler {
+  public:
+   static const std::size_t DEFAULT_ROWS_PER_BATCH;
+
+   StreamingAircraftStateWriter(std::size_t number_of_aircraft,
+                                std::size_t rows_per_batch = DEFAULT_ROWS_PER_BATCH);
+
+   ~StreamingAircraftStateWriter();
+
+   /**
+    * Must be called before the first Append().
+    */
+   void SetScenarioName(const std::string &scenario_name) override;
+
+   void Append(std::size_t aircraft_index, const aaesim::open_source::AircraftState &state);
+
+   /**
+    * Pushes all pending rows through to the part files.
+    */
+   void Flush();
+
+   void Finish() override;
+
+  private:
+   struct AircraftSink {
+      std::string part_filename;
+      std::unique_ptr<mini::csv::ofstream> part_stream;
+      std::vector<AircraftStateWriter::DataToWrite> pending_rows;
+   };
+
+   void WritePendingRows(AircraftSink &sink);
+
+   const std::size_t m_rows_per_batch;
+   std::vector<AircraftSink> m_sinks;
+};
+}  // namespace fmacm
@@ -41,9 +41,22 @@ class TestFrameworkAircraft final : public aaesim::open_source::ScenarioEntity {
   public:
    bool Update(const aaesim::open_source::SimulationTime &time) override;
 
-   std::vector<aaesim::open_source::AircraftState> GetAircraftStates() const { return m_states; }
+   /**
+    * The retained states, oldest first. When a state history limit is set, this is only the most recent part of the
+    * flight; use GetStateCount() to tell how many states have been produced in total.
+    */
+   const std::vector<aaesim::open_source::AircraftState> &GetAircraftStates() const { return m_states; }
 
-   const int GetStartTime() const override { return m_states[0].GetTime().value(); };
+   const aaesim::open_source::AircraftState &GetLatestState() const { return m_states.back(); }
+
+   std::size_t GetStateCount() const { return m_discarded_state_count + m_states.size(); }
+
+   /**
+    * Keep at most the given number of recent states in memory; zero keeps the whole flight.
+    */
+   void SetStateHistoryLimit(std::size_t state_history_limit) { m_state_history_limit = state_history_limit; }
+
+   const int GetStartTime() const override { return m_start_time.value(); };
 
    bool IsFinished() const override {
       return m_guidance_calculator->GetEstimatedDistanceAlongPath() < Units::ZERO_LENGTH;
@@ -118,4 +131,7 @@ class TestFrameworkAircraft final : public aaesim::open_source::ScenarioEntity {
    std::shared_ptr<aaesim::open_source::FixedMassAircraftPerformance> m_bada_calculator;
    std::shared_ptr<aaesim::open_source::FlightDeckApplication> m_speed_application;
    std::vector<aaesim::open_source::AircraftState> m_states;
+   Units::SecondsTime m_start_time;
+   std::size_t m_state_history_limit;
+   std::size_t m_discarded_state_count;
 };
@@ -22,13 +22,20 @@
 #include "public/Scenario.h"
 #include "public/LoggingLoadable.h"
 
+#include <mutex>
 #include <string>
 #include <vector>
 #include <scalar/Angle.h>
 #include <scalar/Time.h>
 
 #include "framework/TestFrameworkAircraft.h"
+#include "framework/AircraftStateWriter.h"
 #include "framework/FrameworkAircraftLoader.h"
+#include "framework/InputTableCache.h"
+#include "framework/MonteCarloLoader.h"
+#include "framework/MonteCarloSummaryWriter.h"
+#include "framework/ParallelAircraftStepper.h"
+#include "framework/StreamingAircraftStateWriter.h"
 #include "public/SimulationTime.h"
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
@@ -48,15 +55,34 @@ class TestFrameworkScenario final : public aaesim::open_source::Scenario, public
 
   private:
    static const Units::SecondsTime SIMULATION_TIME_STEP;
+   static const std::size_t STREAMING_STATE_HISTORY_LIMIT;
    static log4cplus::Logger m_logger;
 
+   struct IterationResult {
+      std::vector<std::vector<aaesim::open_source::AircraftState>> aircraft_states;
+      std::vector<fmacm::MonteCarloSummaryWriter::AircraftSummary> aircraft_summaries;
+   };
+
    bool AdvanceAllAircraft(aaesim::open_source::SimulationTime &time);
-   void PostLoad(const std::string &bada_data_path, std::vector<fmacm::FrameworkAircraftLoader> &aircraft_loaders);
+   void StreamNewAircraftStates(fmacm::StreamingAircraftStateWriter &writer,
+                                std::vector<std::size_t> &streamed_state_counts) const;
+   void PostLoad(const std::string &bada_data_path);
+   void SimulateMonteCarloIterations(fmacm::AircraftStateWriter &state_writer);
+   IterationResult RunMonteCarloIteration(int iteration);
 
+   std::vector<fmacm::FrameworkAircraftLoader> m_aircraft_loaders;
+   std::shared_ptr<fmacm::InputTableCache> m_input_tables;
+   fmacm::MonteCarloLoader m_monte_carlo;
    std::vector<std::shared_ptr<TestFrameworkAircraft>> m_aircraft_in_scenario;
+   int m_aircraft_update_threads;
+   bool m_stream_aircraft_states;
+   fmacm::AircraftStateWriter::OutputFormat m_state_output_format;
+   int m_random_seed;
+   std::unique_ptr<fmacm::ParallelAircraftStepper> m_aircraft_stepper;
 
 #ifdef SAMPLE_ALGORITHM_LIBRARY
    std::unique_ptr<interval_management::open_source::FIMAlgorithmDataWriter> m_sample_algorithm_writer;
    std::unique_ptr<interval_management::open_source::PredictionFileKinematic> m_sample_algorithm_kinematic_writer;
+   std::mutex m_sample_algorithm_writer_mutex;
 #endif
 };
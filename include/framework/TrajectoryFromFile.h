@@ -30,6 +30,7 @@
 #include <scalar/Length.h>
 #include "public/AlongPathDistanceCalculator.h"
 #include "public/PositionCalculator.h"
+#include "public/ProfileInterpolator.h"
 
 class TrajectoryFromFile : Loadable {
 
@@ -122,6 +123,7 @@ class TrajectoryFromFile : Loadable {
    PositionCalculator m_decrementing_position_calculator;
 
    Units::MetersLength estimated_distance_to_go;
+   ProfileInterpolator m_profile_interpolator;
 
    std::string m_vertical_trajectory_file;
    std::string m_horizontal_trajectory_file;
@@ -19,13 +19,17 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
+#include <vector>
 
+#include "framework/InputTableCache.h"
 #include "framework/WindInterpolator.h"
 #include "public/WeatherTruth.h"
 #include "scalar/Speed.h"
 #include "public/NullAtmosphere.h"
 #include "public/SimulationTime.h"
+#include "public/TabulatedAtmosphere.h"
 
 #ifdef MITRE_BADA3_LIBRARY
 #include "bada/BadaAtmosphere37.h"
@@ -54,8 +58,18 @@ class WeatherTruthFromStaticData : public aaesim::open_source::WeatherTruth {
    static WeatherTruthFromStaticData CreateZeroTruthWind();
    WeatherTruthFromStaticData();
 
-   Units::KelvinTemperature Initialize(const std::string &env_csv_file, const Units::Length &altitude,
-                                       DataIndexParameter primary_index);
+   /**
+    * Load the ENV file and calibrate the atmosphere to its temperature at the given altitude.
+    *
+    * With tabulated_atmosphere, the calibrated atmosphere is wrapped in a TabulatedAtmosphere so that
+    * the per-step density and temperature lookups interpolate precomputed tables.
+    *
+    * The parsed ENV rows come from and are kept in input_tables, which the aircraft of a scenario share.
+    */
+   Units::KelvinTemperature Initialize(
+         const std::string &env_csv_file, const Units::Length &altitude, DataIndexParameter primary_index,
+         bool interpolate_between_rows = false, bool tabulated_atmosphere = false,
+         const std::shared_ptr<InputTableCache> &input_tables = std::make_shared<InputTableCache>());
 
    void Update(const aaesim::open_source::SimulationTime &simulation_time, const Units::Length &current_distance_to_go,
                const Units::Length &altitude_msl);
@@ -63,6 +77,15 @@ class WeatherTruthFromStaticData : public aaesim::open_source::WeatherTruth {
    void LoadConditionsAt(const Units::Angle latitude, const Units::Angle longitude,
                          const Units::Length altitude) override;
 
+   // Rows are selected by time or distance to go in Update
+   bool IsPositionDependent() const override { return false; }
+
+   /**
+    * Multiply the wind and wind gradient of every row by factor. Temperatures are unchanged.
+    * The scaled values are used from the next call to Update.
+    */
+   void ScaleWind(double factor);
+
   private:
    struct EnvFileRow {
       EnvFileRow()
@@ -82,25 +105,50 @@ class WeatherTruthFromStaticData : public aaesim::open_source::WeatherTruth {
       double temperature_kelvin;
    };
 
+   /**
+    * Environment data stored column-wise and sorted by the primary index (seconds or meters).
+    * Lookups walk a cursor from the previous position, so the monotonic queries made
+    * during a simulation cost O(1) amortized.
+    */
+   struct WeatherTable {
+      std::vector<double> index_values;
+      std::vector<double> wind_x_enu_mps;
+      std::vector<double> wind_y_enu_mps;
+      std::vector<double> wind_dx_dh_hz;
+      std::vector<double> wind_dy_dh_hz;
+      std::vector<double> temperature_kelvin;
+      std::size_t cursor{0};
+
+      void Assign(std::vector<std::pair<double, EnvFileRow> > &&rows);
+      void ScaleWind(double factor);
+      std::size_t Seek(double index_value);
+      fmacm::WindInterpolator::WeatherDataPoint DataPointAt(double index_value, bool interpolate);
+   };
+
    void InitializeWithZeros();
-   void LoadEnvFile(const std::string &env_csv_file);
-   std::map<Units::Time, fmacm::WindInterpolator::WeatherDataPoint> m_weather_data_points_by_time;
-   std::map<Units::Length, fmacm::WindInterpolator::WeatherDataPoint> m_weather_data_points_by_dtg;
+   static std::vector<EnvFileRow> ReadEnvFile(const std::shared_ptr<const aaesim::open_source::CsvFile> &csv_file);
+   void LoadEnvFile(const std::string &env_csv_file, InputTableCache &input_tables);
+   WeatherTable m_weather_table;
    fmacm::WindInterpolator::WeatherDataPoint m_weather_data_point;
    std::shared_ptr<fmacm::WindInterpolator> m_wind_interpolator;
    DataIndexParameter m_data_index;
+   bool m_interpolate_between_rows;
+   bool m_wind_stacks_loaded;
+   int m_wind_stack_middle_thousand;
+   Units::Speed m_wind_stack_east;
+   Units::Speed m_wind_stack_north;
 };
 
 inline void WeatherTruthFromStaticData::InitializeWithZeros() {
    m_data_index = DataIndexParameter::SIMULATION_TIME;
+   m_interpolate_between_rows = false;
    const auto zero_offset_atmosphere = ATMOSPHERE_IMPL(Units::zero());
-   fmacm::WindInterpolator::WeatherDataPoint data_point;
-   data_point.temperature =
-         Units::AbsKelvinTemperature(zero_offset_atmosphere.GetTemperature(Units::ZERO_LENGTH).value());
-   m_weather_data_points_by_dtg[Units::ZERO_LENGTH] = data_point;
-   m_weather_data_points_by_time[Units::ZERO_TIME] = data_point;
-   m_weather_data_points_by_dtg[Units::Infinity()] = data_point;
-   m_weather_data_points_by_time[Units::Infinity()] = data_point;
+   EnvFileRow data_row;
+   data_row.temperature_kelvin = zero_offset_atmosphere.GetTemperature(Units::ZERO_LENGTH).value();
+   std::vector<std::pair<double, EnvFileRow> > rows;
+   rows.emplace_back(0, data_row);
+   rows.emplace_back(std::numeric_limits<double>::infinity(), data_row);
+   m_weather_table.Assign(std::move(rows));
 
    Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::Infinity(), Units::Infinity());
 }
@@ -19,7 +19,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 #include "loader/TokenStream.h"
 #include "loader/SinglePushBackStream.h"
 #include "loader/IncludeStream.h"
@@ -40,6 +42,21 @@ class DecodedStream : public SinglePushBackStream<IncludeStream<ArchiveStreamEch
 
    ~DecodedStream(void);
 
+   bool open_file(const std::string &file_name);
+
+   /*
+    * Read the tokens of the opened file from the cache at cache_file_name, or, when that is missing or out of
+    * date, resolve the whole file now and write the cache. Either way the tokens are then served from memory.
+    * Call after the stream is configured (local path, archive director) and before anything is read. The archive
+    * director only sees the files when they are resolved, not when they come from the cache.
+    * Returns true when the cache was used.
+    */
+   bool use_parse_cache(const std::string &cache_file_name);
+
+   Token get_next();
+
+   void push_back();
+
    /*
     * Primitive Declarations
     */
@@ -101,4 +118,13 @@ class DecodedStream : public SinglePushBackStream<IncludeStream<ArchiveStreamEch
    bool get_datum(Units::HertzFrequency &s);
 
    bool get_datum(Units::MetersPerSecondSquaredLengthGain &s);
+
+  private:
+   std::string root_file_name;
+
+   // resolved tokens being replayed, if use_parse_cache() was called
+   std::shared_ptr<const std::vector<std::string> > replay_tokens;
+   std::size_t replay_index;
+   Token replay_last;
+   bool replay_pushed;
 };
@@ -24,6 +24,8 @@
 #include "loader/FilePath.h"
 #include <assert.h>
 #include <memory>
+#include <string>
+#include <vector>
 
 template <class PARENT>
 class IncludeStream : public PARENT {
@@ -87,6 +89,11 @@ class IncludeStream : public PARENT {
 
    void set_Local_Path(const FilePath &fp) { local_path = fp; }
 
+   // the name of every included file opened from here on is appended to opened_files
+   void set_Opened_File_Log(std::shared_ptr<std::vector<std::string> > opened_files) {
+      opened_file_log = opened_files;
+   }
+
    //=====================================================================================
    // overloading indent management functions
    inline void tab_In() {
@@ -254,6 +261,10 @@ class IncludeStream : public PARENT {
          // Now we need to rewrite the include statement in the archive of the primary
          PARENT::rewrite_Last_in_Archive(file_name);
 
+         if (opened_file_log) {
+            opened_file_log->push_back(file_name);
+         }
+
          return true;
       }
 
@@ -267,6 +278,7 @@ class IncludeStream : public PARENT {
 
    IncludeStream<PARENT> *secondary;
    std::shared_ptr<RunFileArchiveDirector> archive_director;
+   std::shared_ptr<std::vector<std::string> > opened_file_log;
 
    FilePath local_path;
 };
@@ -0,0 +1,67 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Binary cache of the fully resolved token sequence of an input file, after includes have been followed and
+ * comments removed. Replaying it lets a DecodedStream skip character-by-character tokenizing when the same
+ * scenario is loaded again.
+ *
+ * A cache is only used while every file read to produce it still has the content hash recorded in it.
+ */
+class ParsedScenarioCache {
+  public:
+   struct SourceFile {
+      std::string path;
+      std::uint64_t content_hash;
+   };
+
+   struct Contents {
+      std::vector<SourceFile> source_files;
+      std::vector<std::string> tokens;
+   };
+
+   /**
+    * Cache file for scenario_file_name in cache_directory. Scenarios with the same name in different directories
+    * get different cache files.
+    */
+   static std::string CacheFileName(const std::string &cache_directory, const std::string &scenario_file_name);
+
+   /**
+    * False if the cache is missing, unreadable, in another format, or any of its source files has changed.
+    */
+   static bool Read(const std::string &cache_file_name, Contents &contents);
+
+   /**
+    * Written to a temporary file that is then renamed, so that a concurrent reader never sees a partial cache.
+    */
+   static bool Write(const std::string &cache_file_name, const Contents &contents);
+
+   static std::optional<std::uint64_t> HashFile(const std::string &file_name);
+
+  private:
+   static const char MAGIC[8];
+   static const std::uint32_t FORMAT_VERSION;
+};
@@ -77,4 +77,5 @@ class RunFileArchiveDirector {
   private:
    FilePath destination;
    std::map<std::string, std::string> mapper;
+   int next_link_index;
 };
@@ -35,6 +35,7 @@ class AbstractTrueWeatherOperator : public TrueWeatherOperator {
       throw std::runtime_error("AAES-1545: Do not call this method. Design error that needs to be fixed!");
    }
    std::shared_ptr<const aaesim::open_source::WeatherTruth> GetTrueWeather() const override { return m_true_weather; }
+   bool IsPositionDependent() const override { return m_true_weather->IsPositionDependent(); }
 
   protected:
    std::shared_ptr<aaesim::open_source::WeatherTruth> m_true_weather{};
@@ -22,6 +22,7 @@
 #include "public/Atmosphere.h"
 #include "public/AircraftState.h"
 #include "public/HorizontalPath.h"
+#include "public/HorizontalPathNodeIndex.h"
 #include <vector>
 #include <scalar/UnsignedAngle.h>
 #include <scalar/Length.h>
@@ -107,6 +108,20 @@ class AircraftCalculations {
          const std::vector<HorizontalPath>::size_type starting_trajectory_index, Units::Length &distance_along_path,
          Units::Angle &course, std::vector<HorizontalPath>::size_type &resolved_trajectory_index);
 
+   /**
+    * Same as the method above, but uses a precomputed node index of horizontal_trajectory. The nodes next to
+    * starting_trajectory_index are tried first; the index then limits the remaining search to nodes that are no
+    * farther away than the best local answer. Results are identical to the method without an index.
+    *
+    * @see HorizontalPathNodeIndex
+    * @param node_index built from horizontal_trajectory
+    */
+   static bool CalculateDistanceAlongPathFromPosition(
+         const Units::Length cross_track_tolerance, const Units::Length position_x, const Units::Length position_y,
+         const std::vector<HorizontalPath> &horizontal_trajectory, const HorizontalPathNodeIndex &node_index,
+         const std::vector<HorizontalPath>::size_type starting_trajectory_index, Units::Length &distance_along_path,
+         Units::Angle &course, std::vector<HorizontalPath>::size_type &resolved_trajectory_index);
+
    /**
     * @deprecated
     * @see CoreUtils::CalculateEuclideanDistance()
@@ -137,6 +152,11 @@ class AircraftCalculations {
       Units::Length m_distance_to_path_node;
    };
 
+   // number of nodes, starting just before the caller's index, searched before consulting the node index
+   inline static const std::vector<HorizontalPath>::size_type LOCAL_SEARCH_NODE_COUNT{4};
+
+   static Units::Length DistanceToNode(const Units::Length x, const Units::Length y, const HorizontalPath &node);
+
    static std::vector<PathDistance> ComputePathDistances(const Units::Length x, const Units::Length y,
                                                          const std::vector<HorizontalPath>::size_type &starting_index,
                                                          const std::vector<HorizontalPath> &hTraj);
@@ -144,5 +164,18 @@ class AircraftCalculations {
    static void CrossTrackError(const Units::Length position_enu_x, const Units::Length position_enu_y,
                                int current_trajectory_index, const std::vector<HorizontalPath> &horizontal_trajectory,
                                int &next_trajectory_index, Units::Length &cross_track_error);
+
+   static bool CalculateDistanceAlongPathFromPosition(
+         const Units::Length cross_track_tolerance, const Units::Length position_x, const Units::Length position_y,
+         const std::vector<HorizontalPath> &horizontal_trajectory, const HorizontalPathNodeIndex *node_index,
+         const std::vector<HorizontalPath>::size_type starting_trajectory_index, Units::Length &distance_along_path,
+         Units::Angle &course, std::vector<HorizontalPath>::size_type &resolved_trajectory_index);
+
+   static bool FindNextTrajectoryIndexNearStart(const Units::Length cross_track_tolerance,
+                                                const Units::Length position_x, const Units::Length position_y,
+                                                const std::vector<HorizontalPath> &horizontal_trajectory,
+                                                const HorizontalPathNodeIndex &node_index,
+                                                const std::vector<HorizontalPath>::size_type first_index,
+                                                int &next_trajectory_index);
 };
 }  // namespace aaesim::open_source
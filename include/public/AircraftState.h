@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "public/Logging.h"
@@ -37,6 +38,8 @@
 namespace aaesim {
 namespace open_source {
 
+class DeferredGeodeticPosition;
+
 class AircraftState final {
   public:
    static AircraftState FromAdsbReport(const ADSBSVReport &adsb_report);
@@ -76,6 +79,11 @@ class AircraftState final {
    Units::Frequency GetVerticalWindDerivativeEastComponent() const;
    Units::Frequency GetVerticalWindDerivativeNorthComponent() const;
 
+   /**
+    * Converts a deferred geodetic position now, on the calling thread, and keeps the result in this state.
+    */
+   void ResolveDeferredPosition();
+
    class Builder {
      private:
       int id_{-1};
@@ -94,9 +102,12 @@ class AircraftState final {
       Units::AtmospheresPressure sensed_pressure_{Units::zero()};
       Units::SignedAngle latitude_{Units::zero()}, longitude_{Units::zero()};
       Units::AngularSpeed latitude_rate_{Units::zero()}, longitude_rate_{Units::zero()};
+      std::shared_ptr<const aaesim::open_source::DeferredGeodeticPosition> deferred_position_{};
       Units::RadiansAngle psi_{Units::zero()};
       aaesim::open_source::DynamicsState dynamics_state_{};
 
+      void ResolveDeferredPosition();
+
      public:
       Builder(int unique_acid, int time_since_epoch_seconds);
       Builder(int unique_acid, Units::Time timestamp);
@@ -119,6 +130,10 @@ class AircraftState final {
       Builder *Longitude(Units::SignedAngle longitude);
       Builder *LatitudeRate(Units::AngularSpeed latitude_rate);
       Builder *LongitudeRate(Units::AngularSpeed longitude_rate);
+      /**
+       * Latitude, longitude and their rates, converted only when first read. Replaces the four values above.
+       */
+      Builder *DeferredPosition(std::shared_ptr<const aaesim::open_source::DeferredGeodeticPosition> position);
       Builder *DynamicsState(const aaesim::open_source::DynamicsState &dynamics_state);
       Builder *Psi(Units::Angle psi);
       Builder *SensedWindsPerpendicular(Units::Speed wind_perpendicular_component);
@@ -151,6 +166,9 @@ class AircraftState final {
       Units::SignedAngle GetLongitude() const { return longitude_; };
       Units::AngularSpeed GetLatitudeRate() const { return latitude_rate_; };
       Units::AngularSpeed GetLongitudeRate() const { return longitude_rate_; };
+      std::shared_ptr<const aaesim::open_source::DeferredGeodeticPosition> GetDeferredPosition() const {
+         return deferred_position_;
+      };
       aaesim::open_source::DynamicsState GetDynamicsState() const { return dynamics_state_; };
       Units::Angle GetPsi() const { return psi_; };
    };
@@ -175,6 +193,7 @@ class AircraftState final {
    Units::Pressure m_sensed_pressure{Units::zero()};
    Units::SignedAngle m_latitude{Units::zero()}, m_longitude{Units::zero()};
    Units::AngularSpeed m_latitude_rate{Units::zero()}, m_longitude_rate{Units::zero()};
+   std::shared_ptr<const aaesim::open_source::DeferredGeodeticPosition> m_deferred_position{};
    aaesim::open_source::DynamicsState m_dynamics_state{};
 };
 
@@ -184,10 +203,6 @@ inline Units::Length AircraftState::GetAltitudeMsl() const { return m_z; }
 inline Units::Speed AircraftState::GetSpeedEnuX() const { return m_xd; }
 inline Units::Speed AircraftState::GetSpeedEnuY() const { return m_yd; }
 inline Units::Speed AircraftState::GetVerticalSpeed() const { return m_zd; }
-inline Units::SignedAngle AircraftState::GetLatitude() const { return m_latitude; }
-inline Units::SignedAngle AircraftState::GetLongitude() const { return m_longitude; }
-inline Units::AngularSpeed AircraftState::GetLatitudeRate() const { return m_latitude_rate; }
-inline Units::AngularSpeed AircraftState::GetLongitudeRate() const { return m_longitude_rate; }
 inline aaesim::open_source::DynamicsState AircraftState::GetDynamicsState() const { return m_dynamics_state; }
 inline Units::SecondsTime AircraftState::GetTime() const { return m_time; }
 inline int AircraftState::GetUniqueId() const { return m_id; }
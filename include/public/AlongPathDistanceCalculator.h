@@ -38,6 +38,9 @@ class AlongPathDistanceCalculator : public HorizontalPathTracker {
    AlongPathDistanceCalculator(const std::vector<HorizontalPath> &horizontal_path,
                                TrajectoryIndexProgressionDirection expected_index_progression);
 
+   AlongPathDistanceCalculator(std::shared_ptr<const ExtendedHorizontalPath> horizontal_path,
+                               TrajectoryIndexProgressionDirection expected_index_progression);
+
    AlongPathDistanceCalculator(const std::vector<HorizontalPath> &horizontal_path,
                                TrajectoryIndexProgressionDirection expected_index_progression,
                                bool use_large_cross_track_tolerance);
@@ -65,7 +68,9 @@ class AlongPathDistanceCalculator : public HorizontalPathTracker {
                                                Units::Length &distance_along_path, Units::UnsignedAngle &course,
                                                Units::UnsignedAngle &pt_to_pt_course);
 
-   void UpdateHorizontalTrajectory(const std::vector<HorizontalPath> &horizontal_trajectory) override;
+   using HorizontalPathTracker::UpdateHorizontalTrajectory;
+
+   void UpdateHorizontalTrajectory(std::shared_ptr<const ExtendedHorizontalPath> horizontal_trajectory) override;
 
   private:
    static log4cplus::Logger m_logger;
@@ -130,6 +130,10 @@ class CoreUtils {
    }
 
   private:
+   // throws unless x_interpolation_value is within the bracket, allowing slight extrapolation of the last one
+   static void ValidateInterpolationBracket(int upper_index, double x_interpolation_value,
+                                            const std::vector<double> &x_values);
+
    inline static log4cplus::Logger m_logger{log4cplus::Logger::getInstance(LOG4CPLUS_TEXT("CoreUtils"))};
    inline static Units::NauticalMilesLength MAXIMUM_ALLOWABLE_SINGLE_LEG_LENGTH{Units::infinity()};
 
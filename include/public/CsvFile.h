@@ -0,0 +1,119 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+/*
+ * CsvFile.h
+ *
+ * Shared ingestion of the delimited text inputs (TV, ENV, HFP, vertical profile, speed command files).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aaesim {
+namespace open_source {
+
+/**
+ * Read-only text of an input file. A regular file is memory mapped; any other input is read into memory once.
+ * The text outlives every CsvCursor that reads it.
+ */
+class CsvFile final {
+  public:
+   /**
+    * Null if the file cannot be opened.
+    */
+   static std::shared_ptr<const CsvFile> Open(const std::string &file_name);
+
+   static std::shared_ptr<const CsvFile> Read(std::istream &input_stream);
+
+   ~CsvFile();
+
+   CsvFile(const CsvFile &) = delete;
+
+   CsvFile &operator=(const CsvFile &) = delete;
+
+   // without any UTF-8 byte order mark
+   std::string_view GetText() const { return m_text; }
+
+   // 64-bit FNV-1a of the text, for recognizing files with the same content
+   std::uint64_t GetContentHash() const;
+
+  private:
+   CsvFile() = default;
+
+   void SetText(const char *text, std::size_t size);
+
+   void *m_mapping{nullptr};
+   std::size_t m_mapping_size{0};
+   std::string m_buffer;
+   std::string_view m_text;
+};
+
+/**
+ * Splits the lines of a CsvFile into cells in place. Cells are views into the file, valid until the next call to
+ * Advance(), and the cell storage is reused from line to line, so reading a row allocates nothing.
+ *
+ * Lines are split the way the former getline based parser split them: an empty line has no cells and a trailing
+ * delimiter does not start another cell. A carriage return ending a line is not part of the last cell.
+ */
+class CsvCursor final {
+  public:
+   CsvCursor() = default;
+
+   explicit CsvCursor(std::shared_ptr<const CsvFile> file, char delimiter = ',');
+
+   // false at the end of the file, leaving no cells
+   bool Advance();
+
+   void SkipLines(int number_of_lines);
+
+   std::size_t Size() const { return m_cells.size(); }
+
+   std::string_view operator[](std::size_t column) const { return m_cells[column]; }
+
+   // 0 for a cell that is missing or does not start with a number, and +-HUGE_VAL when out of range, like atof()
+   double GetDouble(std::size_t column) const;
+
+   /**
+    * Column number of each cell of the current line, which is normally the header. A repeated name maps to its
+    * last column.
+    */
+   std::map<std::string, int, std::less<>> BuildColumnIndex() const;
+
+   static double ParseDouble(std::string_view cell);
+
+  private:
+   std::string_view NextLine();
+
+   std::shared_ptr<const CsvFile> m_file;
+   char m_delimiter{','};
+   std::size_t m_position{0};
+   std::vector<std::string_view> m_cells;
+};
+
+}  // namespace open_source
+}  // namespace aaesim
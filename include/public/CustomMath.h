@@ -25,6 +25,7 @@
 #include <scalar/Time.h>
 #include "public/DMatrix.h"
 #include "public/DVector.h"
+#include "public/Mat3.h"
 
 double atan3(double x,
              double y);  // arc tangent from 0 - 2pi
@@ -43,4 +44,4 @@ bool inverse(DMatrix &in, int n, DMatrix &inverse);
 
 void matrix_times_vector(DMatrix &matrix_in, DVector &vector_in, int n, DVector &vector_out);
 
-DMatrix &CreateRotationMatrix(double l, double m, double n, const Units::Angle theta);
+aaesim::open_source::Mat3 CreateRotationMatrix(double l, double m, double n, const Units::Angle theta);
@@ -31,7 +31,7 @@
 #include <map>
 #include <memory>
 #include <istream>
-#include "utility/CsvParser.h"
+#include "public/CsvFile.h"
 #include "public/Logging.h"
 #include <scalar/Time.h>
 
@@ -44,6 +44,7 @@ class DataReader {
    DataReader() = default;
    DataReader(std::string file_name, int header_lines, size_t expected_columns);
    DataReader(std::shared_ptr<std::istream> input_stream, int header_lines, size_t expected_columns);
+   DataReader(std::shared_ptr<const CsvFile> csv_file, int header_lines, size_t expected_columns);
    virtual ~DataReader();
    void OpenFile(std::string file_name, int header_lines);
    void OpenStream(std::shared_ptr<std::istream> input_stream, int header_lines);
@@ -60,10 +61,9 @@ class DataReader {
 
   private:
    static log4cplus::Logger m_logger;
-   std::shared_ptr<std::istream> m_input_stream;
    size_t m_expected_column_count;
-   CsvParser::CsvRow m_csv_row;
-   std::map<std::string, int> m_column_index;
+   CsvCursor m_csv_row;
+   std::map<std::string, int, std::less<>> m_column_index;
 };
 
 }  // namespace open_source
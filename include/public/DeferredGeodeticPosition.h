@@ -0,0 +1,62 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "public/EarthModel.h"
+#include "public/EllipsoidalPositionEstimator.h"
+
+namespace aaesim::open_source {
+/**
+ * Geodetic position and position rate of one aircraft state, converted from ENU only when first read.
+ *
+ * The resolver runs at most once, on the first call to any getter, and may be invoked from any thread.
+ */
+class DeferredGeodeticPosition final {
+  public:
+   using Resolver = std::function<void(EarthModel::GeodeticPosition &position, LatLonDerivative &position_rate)>;
+
+   /**
+    * A position that is already known, so the getters never convert.
+    */
+   static std::shared_ptr<const DeferredGeodeticPosition> Of(const EarthModel::GeodeticPosition &position,
+                                                             const LatLonDerivative &position_rate);
+
+   explicit DeferredGeodeticPosition(Resolver resolver) : m_resolver(std::move(resolver)) {}
+   ~DeferredGeodeticPosition() = default;
+
+   const EarthModel::GeodeticPosition &GetPosition() const;
+   const LatLonDerivative &GetPositionRate() const;
+   bool IsResolved() const { return m_is_resolved.load(std::memory_order_acquire); }
+
+  private:
+   void Resolve() const;
+
+   mutable std::once_flag m_resolve_once{};
+   mutable std::atomic<bool> m_is_resolved{false};
+   mutable Resolver m_resolver;
+   mutable EarthModel::GeodeticPosition m_position{};
+   mutable LatLonDerivative m_position_rate{};
+};
+}  // namespace aaesim::open_source
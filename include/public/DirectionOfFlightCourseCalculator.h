@@ -32,6 +32,8 @@ class DirectionOfFlightCourseCalculator : public HorizontalPathTracker {
    DirectionOfFlightCourseCalculator();
    DirectionOfFlightCourseCalculator(const std::vector<HorizontalPath> &horizontal_path,
                                      TrajectoryIndexProgressionDirection expected_index_progression);
+   DirectionOfFlightCourseCalculator(std::shared_ptr<const ExtendedHorizontalPath> horizontal_path,
+                                     TrajectoryIndexProgressionDirection expected_index_progression);
    virtual ~DirectionOfFlightCourseCalculator();
 
    /**
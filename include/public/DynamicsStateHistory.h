@@ -0,0 +1,87 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+
+#include "public/DynamicsState.h"
+#include "public/SimulationTime.h"
+
+namespace aaesim::open_source {
+/**
+ * Record of the dynamics states produced by ThreeDOFDynamics.
+ *
+ * The latest state is always kept. Earlier states are kept according to the policy: not at all, the most recent
+ * N states, or every state. Retained states are stored contiguously in time order, so they can be read through a
+ * span without copying.
+ */
+class DynamicsStateHistory final {
+  public:
+   enum class Policy { NONE, RING, FULL };
+
+   static Policy PolicyFromString(std::string s);
+
+   struct Entry {
+      SimulationTime time;
+      DynamicsState state;
+   };
+
+   DynamicsStateHistory() = default;
+   ~DynamicsStateHistory() = default;
+
+   void SetPolicy(Policy policy, std::size_t ring_length = 1);
+
+   Policy GetPolicy() const;
+
+   /**
+    * Record a state. A state that is not later than the latest recorded state is ignored.
+    */
+   void Record(const SimulationTime &time, const DynamicsState &state);
+
+   bool IsEmpty() const;
+
+   const DynamicsState &GetLatestState() const;
+
+   /**
+    * Retained states, oldest first. Invalidated by the next call to Record() or SetPolicy().
+    */
+   std::span<const Entry> GetRetainedStates() const;
+
+  private:
+   Policy m_policy{Policy::FULL};
+   std::size_t m_ring_length{1};
+   std::vector<Entry> m_entries{};
+   std::size_t m_first_entry{0};
+   Entry m_latest{};
+   bool m_has_latest{false};
+};
+
+inline DynamicsStateHistory::Policy DynamicsStateHistory::GetPolicy() const { return m_policy; }
+
+inline bool DynamicsStateHistory::IsEmpty() const { return !m_has_latest; }
+
+inline const DynamicsState &DynamicsStateHistory::GetLatestState() const { return m_latest.state; }
+
+inline std::span<const DynamicsStateHistory::Entry> DynamicsStateHistory::GetRetainedStates() const {
+   return std::span<const Entry>(m_entries).subspan(m_first_entry);
+}
+}  // namespace aaesim::open_source
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "scalar/Length.h"
 #include "scalar/SignedAngle.h"
@@ -85,6 +86,28 @@ class EarthModel {
       Units::Length x{}, y{}, z{};
    };
 
+   /**
+    * Structure-of-arrays view of geodetic positions for the batch conversions. Altitude is not carried because the
+    * conversions ignore it (see EllipsoidalEarthModel). Every span in one view must have the same size.
+    */
+   template <typename T>
+   struct GeodeticArrays {
+      std::span<T> latitude_radians, longitude_radians;
+      std::size_t size() const { return latitude_radians.size(); }
+      bool IsConsistent() const { return longitude_radians.size() == latitude_radians.size(); }
+   };
+
+   /**
+    * Structure-of-arrays view of ECEF or ENU positions for the batch conversions. Every span in one view must have
+    * the same size.
+    */
+   template <typename T>
+   struct CartesianArrays {
+      std::span<T> x_meters, y_meters, z_meters;
+      std::size_t size() const { return x_meters.size(); }
+      bool IsConsistent() const { return y_meters.size() == x_meters.size() && z_meters.size() == x_meters.size(); }
+   };
+
    virtual ~EarthModel();
 
    virtual void ConvertGeodeticToAbsolute(const EarthModel::GeodeticPosition &geo,
@@ -96,8 +119,29 @@ class EarthModel {
    virtual std::shared_ptr<LocalTangentPlane> MakeEnuConverter(const GeodeticPosition &pointOfTangencyGeo,
                                                                const LocalPositionEnu &pointOfTangencyEnu) const = 0;
 
+   /**
+    * Batch form of ConvertGeodeticToAbsolute(). The default implementation converts one position at a time;
+    * subclasses may override with a faster loop.
+    *
+    * @throws std::logic_error if the arrays are not all the same size
+    */
+   virtual void ConvertGeodeticToAbsolute(const GeodeticArrays<const double> &geo,
+                                          const CartesianArrays<double> &ecef) const;
+
+   /**
+    * Batch form of ConvertAbsoluteToGeodetic(). The default implementation converts one position at a time;
+    * subclasses may override with a faster loop.
+    *
+    * @throws std::logic_error if the arrays are not all the same size
+    */
+   virtual void ConvertAbsoluteToGeodetic(const CartesianArrays<const double> &ecef,
+                                          const GeodeticArrays<double> &geo) const;
+
   protected:
    EarthModel();
+
+   static void CheckBatchSizes(const GeodeticArrays<const double> &geo, const CartesianArrays<double> &ecef);
+   static void CheckBatchSizes(const CartesianArrays<const double> &ecef, const GeodeticArrays<double> &geo);
 };
 
 std::ostream &operator<<(std::ostream &out, const EarthModel::GeodeticPosition &geo);
@@ -44,6 +44,22 @@ class EllipsoidalEarthModel final : public EarthModel {
    std::shared_ptr<LocalTangentPlane> MakeEnuConverter(const GeodeticPosition &pointOfTangencyGeo,
                                                        const LocalPositionEnu &pointOfTangencyEnu) const override;
 
+   /**
+    * Batch ConvertGeodeticToAbsolute() in plain doubles. Results are identical to the single-position method.
+    */
+   void ConvertGeodeticToAbsolute(const GeodeticArrays<const double> &geo,
+                                  const CartesianArrays<double> &ecef) const override;
+
+   /**
+    * Batch ConvertAbsoluteToGeodetic() in plain doubles. The cube root in Ferrari's solution uses cbrt() where the
+    * single-position method uses pow(x, 0.333333333333), so latitudes may differ from that method by up to
+    * BATCH_LATITUDE_TOLERANCE_RADIANS (a few micrometers on the ground). Longitudes are identical.
+    */
+   void ConvertAbsoluteToGeodetic(const CartesianArrays<const double> &ecef,
+                                  const GeodeticArrays<double> &geo) const override;
+
+   inline static const double BATCH_LATITUDE_TOLERANCE_RADIANS{1e-12};
+
   private:
    inline static log4cplus::Logger m_logger{log4cplus::Logger::getInstance(LOG4CPLUS_TEXT("EllipsoidalEarthModel"))};
    const Units::Area m_semi_major_radius_squared;
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "public/EquationsOfMotionState.h"
 #include "public/EquationsOfMotionStateDeriv.h"
 #include "public/EarthModel.h"
@@ -31,9 +33,19 @@ struct LatLonDerivative {
    Units::AngularSpeed longitude_time_derivative;
 };
 
+class DeferredGeodeticPosition;
+
 struct EllipsoidalPositionEstimator {
    virtual void ComputePosition(const SimulationTime &simtime, const EquationsOfMotionState &eqm_state,
                                 const EquationsOfMotionStateDeriv &eqm_state_derivative,
                                 EarthModel::GeodeticPosition &position, LatLonDerivative &position_rate) = 0;
+
+   /**
+    * Same result as ComputePosition(), but the conversion is put off until the position is first read.
+    * Either method may be used for any step.
+    */
+   virtual std::shared_ptr<const DeferredGeodeticPosition> DeferPosition(
+         const SimulationTime &simtime, const EquationsOfMotionState &eqm_state,
+         const EquationsOfMotionStateDeriv &eqm_state_derivative) = 0;
 };
 }  // namespace aaesim::open_source
\ No newline at end of file
@@ -34,8 +34,6 @@ class Environment final {
    virtual ~Environment() = default;
 
   private:
-   static std::unique_ptr<Environment> m_instance;
-
    std::unique_ptr<EarthModel> m_earth_model;
 
    Environment();
@@ -0,0 +1,131 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include "utility/UtilityConstants.h"
+
+namespace aaesim::open_source {
+/**
+ * Right-hand side of the three degree-of-freedom equations of motion on plain SI doubles.
+ *
+ * This is the unit-free equivalent of the Units-typed equations in ThreeDOFDynamics. Inputs that ThreeDOFDynamics
+ * holds for a whole simulation step (weather, drag coefficients, control commands and gains) are packed into
+ * StepInputs once, so each evaluation only does the arithmetic, with the shared trigonometric terms computed once.
+ */
+class EquationsOfMotionKernel final {
+  public:
+   enum StateIndex { ENU_X, ENU_Y, ALTITUDE, TRUE_AIRSPEED, GAMMA, PSI, THRUST, PHI, SPEED_BRAKE, STATE_SIZE };
+
+   /** [m, m, m, m/s, rad, rad, N, rad, fraction deployed], indexed by StateIndex. Derivatives use the same layout. */
+   typedef std::array<double, STATE_SIZE> State;
+
+   struct AircraftConstants {
+      double mass_kg;
+      double wing_area_m2;
+   };
+
+   struct StepInputs {
+      double density_kg_m3;
+      double wind_east_mps;
+      double wind_north_mps;
+      double wind_gradient_east_hz;
+      double wind_gradient_north_hz;
+      double cd0;
+      double cd2;
+      double gear_drag;
+      double k_flight_path_angle_hz;
+      double k_thrust_hz;
+      double k_roll_hz;
+      double k_speed_brake;
+      double flight_path_angle_command_rad;
+      double thrust_command_newtons;
+      double roll_angle_command_rad;
+      double speed_brake_command;
+   };
+
+   struct KineticForces {
+      double lift_coefficient;
+      double drag_coefficient;
+      double lift_newtons;
+      double drag_newtons;
+   };
+
+   static KineticForces CalculateKineticForces(const AircraftConstants &aircraft, const StepInputs &inputs,
+                                               const State &state);
+
+   static State Derivative(const AircraftConstants &aircraft, const StepInputs &inputs, const State &state);
+};
+
+inline EquationsOfMotionKernel::KineticForces EquationsOfMotionKernel::CalculateKineticForces(
+      const AircraftConstants &aircraft, const StepInputs &inputs, const State &state) {
+   using aaesim::open_source::constants::GRAVITY_METERS_PER_SECOND;
+   const double dynamic_pressure_area =
+         0.5 * inputs.density_kg_m3 * state[TRUE_AIRSPEED] * state[TRUE_AIRSPEED] * aircraft.wing_area_m2;
+
+   KineticForces forces;
+   forces.lift_coefficient =
+         aircraft.mass_kg * GRAVITY_METERS_PER_SECOND / (dynamic_pressure_area * std::cos(state[PHI]));
+   forces.drag_coefficient =
+         inputs.cd0 + inputs.gear_drag + inputs.cd2 * forces.lift_coefficient * forces.lift_coefficient;
+   if (state[SPEED_BRAKE] != 0.0) {
+      forces.drag_coefficient *= 1.0 + 0.6 * state[SPEED_BRAKE];
+   }
+   forces.lift_newtons = forces.lift_coefficient * dynamic_pressure_area;
+   forces.drag_newtons = forces.drag_coefficient * dynamic_pressure_area;
+   return forces;
+}
+
+inline EquationsOfMotionKernel::State EquationsOfMotionKernel::Derivative(const AircraftConstants &aircraft,
+                                                                          const StepInputs &inputs,
+                                                                          const State &state) {
+   using aaesim::open_source::constants::GRAVITY_METERS_PER_SECOND;
+   const KineticForces forces = CalculateKineticForces(aircraft, inputs, state);
+
+   const double true_airspeed = state[TRUE_AIRSPEED];
+   const double gamma = state[GAMMA];
+   const double cos_gamma = std::cos(gamma);
+   const double sin_gamma = std::sin(gamma);
+   const double cos_psi = std::cos(state[PSI]);
+   const double sin_psi = std::sin(state[PSI]);
+   const double along_heading_wind_gradient =
+         inputs.wind_gradient_east_hz * cos_psi + inputs.wind_gradient_north_hz * sin_psi;
+   const double cross_heading_wind_gradient =
+         inputs.wind_gradient_east_hz * sin_psi - inputs.wind_gradient_north_hz * cos_psi;
+
+   State derivative;
+   derivative[ENU_X] = true_airspeed * cos_gamma * cos_psi + inputs.wind_east_mps;
+   derivative[ENU_Y] = true_airspeed * cos_gamma * sin_psi + inputs.wind_north_mps;
+   derivative[ALTITUDE] = -true_airspeed * sin_gamma;
+   derivative[TRUE_AIRSPEED] = (state[THRUST] - forces.drag_newtons) / aircraft.mass_kg +
+                               GRAVITY_METERS_PER_SECOND * sin_gamma +
+                               true_airspeed * along_heading_wind_gradient * sin_gamma * cos_gamma;
+   derivative[GAMMA] = inputs.k_flight_path_angle_hz * (inputs.flight_path_angle_command_rad - gamma) -
+                       along_heading_wind_gradient * sin_gamma * sin_gamma;
+   derivative[PSI] = -forces.lift_newtons * std::sin(state[PHI]) / (aircraft.mass_kg * true_airspeed * cos_gamma) -
+                     cross_heading_wind_gradient * sin_gamma / cos_gamma;
+   derivative[THRUST] = inputs.k_thrust_hz * (inputs.thrust_command_newtons - state[THRUST]);
+   derivative[PHI] = inputs.k_roll_hz * (inputs.roll_angle_command_rad - state[PHI]);
+   derivative[SPEED_BRAKE] = inputs.k_speed_brake * (inputs.speed_brake_command - state[SPEED_BRAKE]);
+   return derivative;
+}
+}  // namespace aaesim::open_source
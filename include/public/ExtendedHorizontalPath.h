@@ -0,0 +1,83 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <scalar/Length.h>
+
+#include "public/HorizontalPath.h"
+#include "public/HorizontalPathNodeIndex.h"
+
+namespace aaesim::open_source {
+
+/**
+ * An immutable horizontal path, the same path extended with a straight segment at each end, and the spatial index of
+ * the extended nodes. It is built once per path and shared by every HorizontalPathTracker that follows the path; each
+ * tracker keeps only its own index into it.
+ */
+class ExtendedHorizontalPath final {
+  public:
+   inline static const Units::Length EXTENSION_LENGTH{Units::NauticalMilesLength(1.0)};
+
+   static std::shared_ptr<const ExtendedHorizontalPath> Of(const std::vector<HorizontalPath> &horizontal_path);
+
+   /**
+    * @return the shared path of a tracker that has not been given one
+    */
+   static const std::shared_ptr<const ExtendedHorizontalPath> &Empty();
+
+   ExtendedHorizontalPath() = default;
+   explicit ExtendedHorizontalPath(const std::vector<HorizontalPath> &horizontal_path);
+   ~ExtendedHorizontalPath() = default;
+
+   /**
+    * @return the path as it was provided
+    */
+   const std::vector<HorizontalPath> &GetUnmodifiedPath() const;
+
+   /**
+    * @return the path with one extra straight segment before its first node and after its last node; cumulative
+    * lengths are shifted by EXTENSION_LENGTH
+    */
+   const std::vector<HorizontalPath> &GetExtendedPath() const;
+
+   const HorizontalPathNodeIndex &GetExtendedNodeIndex() const;
+
+  private:
+   static std::vector<HorizontalPath> ExtendHorizontalTrajectory(
+         const std::vector<HorizontalPath> &horizontal_trajectory);
+
+   std::vector<HorizontalPath> m_unmodified_path{};
+   std::vector<HorizontalPath> m_extended_path{};
+   HorizontalPathNodeIndex m_extended_node_index{};
+};
+
+inline const std::vector<HorizontalPath> &ExtendedHorizontalPath::GetUnmodifiedPath() const {
+   return m_unmodified_path;
+}
+
+inline const std::vector<HorizontalPath> &ExtendedHorizontalPath::GetExtendedPath() const { return m_extended_path; }
+
+inline const HorizontalPathNodeIndex &ExtendedHorizontalPath::GetExtendedNodeIndex() const {
+   return m_extended_node_index;
+}
+
+}  // namespace aaesim::open_source
@@ -0,0 +1,75 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+#pragma once
+
+#include <vector>
+#include <scalar/Length.h>
+
+#include "public/HorizontalPath.h"
+
+namespace aaesim::open_source {
+
+/**
+ * A uniform grid over the node positions of a horizontal path. Answers "which nodes might lie within a radius of this
+ * position" without visiting every node, so that repeated along-path distance queries on long routes stay cheap.
+ *
+ * The grid is conservative: every node within the radius is reported, plus possibly a few that are not. Callers
+ * must apply their own exact distance test to the reported nodes.
+ */
+class HorizontalPathNodeIndex final {
+  public:
+   HorizontalPathNodeIndex() = default;
+   explicit HorizontalPathNodeIndex(const std::vector<HorizontalPath> &horizontal_path);
+   ~HorizontalPathNodeIndex() = default;
+
+   /**
+    * @return true if no usable index exists (empty path or a path with non-finite node positions)
+    */
+   bool IsEmpty() const;
+
+   /**
+    * Find the nodes that may be within radius of a position.
+    *
+    * @param position_x of the query
+    * @param position_y of the query
+    * @param radius of the query
+    * @param minimum_node_index nodes with a smaller index are not reported
+    * @param node_indices, an output; cleared, then filled with candidate node indices
+    */
+   void FindNodesNear(const Units::Length position_x, const Units::Length position_y, const Units::Length radius,
+                      const std::vector<HorizontalPath>::size_type minimum_node_index,
+                      std::vector<std::vector<HorizontalPath>::size_type> &node_indices) const;
+
+  private:
+   double m_origin_x_meters{0};
+   double m_origin_y_meters{0};
+   double m_cell_size_meters{1};
+   long m_column_count{0};
+   long m_row_count{0};
+   // node indices grouped by cell; cell c owns m_cell_nodes[m_cell_offsets[c], m_cell_offsets[c + 1])
+   std::vector<std::vector<HorizontalPath>::size_type> m_cell_offsets{};
+   std::vector<std::vector<HorizontalPath>::size_type> m_cell_nodes{};
+
+   long CellColumn(double x_meters) const;
+   long CellRow(double y_meters) const;
+};
+
+inline bool HorizontalPathNodeIndex::IsEmpty() const { return m_cell_nodes.empty(); }
+
+}  // namespace aaesim::open_source
@@ -19,7 +19,9 @@
 
 #pragma once
 
+#include <public/ExtendedHorizontalPath.h>
 #include <public/HorizontalPath.h>
+#include <memory>
 #include <vector>
 #include <log4cplus/logger.h>
 
@@ -51,6 +53,8 @@ class HorizontalPathTracker {
    HorizontalPathTracker() = default;
    HorizontalPathTracker(const std::vector<HorizontalPath> &horizontal_trajectory,
                          TrajectoryIndexProgressionDirection expected_index_progression);
+   HorizontalPathTracker(std::shared_ptr<const ExtendedHorizontalPath> horizontal_trajectory,
+                         TrajectoryIndexProgressionDirection expected_index_progression);
    virtual ~HorizontalPathTracker() = default;
 
    TrajectoryIndexProgressionDirection GetExpectedProgressionDirection() const;
@@ -73,9 +77,19 @@ class HorizontalPathTracker {
     * has experienced a slight change and the tracking behavior should remain consistent. For large changes in the
     * horizontal trajectory, build a new object instead of calling this.
     */
-   virtual void UpdateHorizontalTrajectory(const std::vector<HorizontalPath> &horizontal_trajectory);
+   void UpdateHorizontalTrajectory(const std::vector<HorizontalPath> &horizontal_trajectory);
+
+   /**
+    * @brief Same as other method, but adopts a path that is already extended and possibly shared with other trackers.
+    */
+   virtual void UpdateHorizontalTrajectory(std::shared_ptr<const ExtendedHorizontalPath> horizontal_trajectory);
 
-   const std::vector<HorizontalPath> GetHorizontalPath() const;
+   const std::vector<HorizontalPath> &GetHorizontalPath() const;
+
+   /**
+    * @return the path this tracker follows, to share with other trackers of the same path
+    */
+   const std::shared_ptr<const ExtendedHorizontalPath> &GetExtendedHorizontalPath() const;
 
    void UpdateCurrentIndex(std::vector<HorizontalPath>::size_type new_index);
 
@@ -87,9 +101,9 @@ class HorizontalPathTracker {
    const HorizontalPath GetActivePathSegment() const;
 
   protected:
-   inline static const Units::Length EXTENSION_LENGTH{Units::NauticalMilesLength(1.0)};
+   inline static const Units::Length &EXTENSION_LENGTH{ExtendedHorizontalPath::EXTENSION_LENGTH};
    std::vector<HorizontalPath>::size_type m_current_index{0};
-   std::vector<HorizontalPath> m_extended_horizontal_trajectory{}, m_unmodified_horizontal_trajectory{};
+   std::shared_ptr<const ExtendedHorizontalPath> m_path{ExtendedHorizontalPath::Empty()};
    bool m_is_passed_end_of_route{false};
    TrajectoryIndexProgressionDirection m_index_progression_direction{TrajectoryIndexProgressionDirection::UNDEFINED};
 
@@ -98,15 +112,6 @@ class HorizontalPathTracker {
     */
    bool ValidateIndexProgression(std::vector<HorizontalPath>::size_type index_to_check);
 
-   /**
-    * @brief Extends a horizontal path vector in both directions so that the edges of the original path are more
-    * conveniently handled mathematically.
-    *
-    * @param horizontal_trajectory the original vector that will be extended
-    * @return a copy of the original vector, but extended with straight segments at both ends
-    */
-   std::vector<HorizontalPath> ExtendHorizontalTrajectory(const std::vector<HorizontalPath> &horizontal_trajectory);
-
    /**
     * @brief Checks the incoming location to determine if on a local horizontal path node.
     */
@@ -126,12 +131,16 @@ class HorizontalPathTracker {
 
 inline bool HorizontalPathTracker::IsPassedEndOfRoute() const { return m_is_passed_end_of_route; }
 
-inline const std::vector<HorizontalPath> HorizontalPathTracker::GetHorizontalPath() const {
-   return m_unmodified_horizontal_trajectory;
+inline const std::vector<HorizontalPath> &HorizontalPathTracker::GetHorizontalPath() const {
+   return m_path->GetUnmodifiedPath();
+}
+
+inline const std::shared_ptr<const ExtendedHorizontalPath> &HorizontalPathTracker::GetExtendedHorizontalPath() const {
+   return m_path;
 }
 
 inline const std::vector<HorizontalPath>::size_type HorizontalPathTracker::GetCurrentTrajectoryIndex() const {
-   return m_current_index - 1;  // subtract one because caller doesn't know about m_extended_horizontal_trajectory
+   return m_current_index - 1;  // subtract one because caller doesn't know about the extended path
 }
 
 inline TrajectoryIndexProgressionDirection HorizontalPathTracker::GetExpectedProgressionDirection() const {
@@ -143,7 +152,7 @@ inline void HorizontalPathTracker::UpdateCurrentIndex(std::vector<HorizontalPath
 }
 
 inline const HorizontalPath HorizontalPathTracker::GetActivePathSegment() const {
-   return m_extended_horizontal_trajectory[m_current_index];
+   return m_path->GetExtendedPath()[m_current_index];
 }
 
 }  // namespace aaesim::open_source
@@ -19,11 +19,22 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+
 #include "public/VerticalPredictor.h"
 
 namespace aaesim {
+namespace test {
+namespace open_source {
+class KinematicDescent4DPredictor_reused_predictor_matches_fresh_predictor_Test;
+}  // namespace open_source
+}  // namespace test
+
 namespace open_source {
 class KinematicDescent4DPredictor : public VerticalPredictor {
+   friend class aaesim::test::open_source::KinematicDescent4DPredictor_reused_predictor_matches_fresh_predictor_Test;
+
   public:
    enum KinematicDescentType { CONSTRAINED };
 
@@ -48,66 +59,146 @@ class KinematicDescent4DPredictor : public VerticalPredictor {
    const double GetDecelerationRateFPA() const;
 
   private:
+   /**
+    * The settings a prediction depends on. They are cheap to capture, so they are captured on every call.
+    *
+    * The atmospheres are compared by identity. Holding them keeps a freed atmosphere's address from being reused by
+    * a different one while the cached prediction refers to it.
+    */
+   struct PredictionSettings {
+      std::shared_ptr<const Atmosphere> forecast_atmosphere{};
+      Units::KelvinTemperature forecast_sea_level_temperature{};
+      std::shared_ptr<const Atmosphere> predictor_atmosphere{};
+      Units::KelvinTemperature predictor_sea_level_temperature{};
+      Units::Length altitude_at_end_of_route{};
+      Units::Speed ias_at_end_of_route{};
+      Units::Length cruise_altitude{};
+      Units::Length transition_altitude{};
+      Units::Speed transition_ias{};
+      double transition_mach{0};
+      Units::Time descent_start_time{};
+
+      bool operator==(const PredictionSettings &obj) const;
+   };
+
+   /**
+    * Everything a prediction depends on other than the aircraft's distance to go and altitude. The route and winds
+    * are copied only when their fingerprint or contents differ from the previous prediction's.
+    */
+   struct PredictionInputs {
+      PredictionSettings settings{};
+      std::uint64_t fingerprint{0};
+      std::vector<HorizontalPath> horizontal_path{};
+      std::vector<PrecalcWaypoint> precalc_waypoints{};
+      WindStack east_west_wind{};
+      WindStack north_south_wind{};
+   };
+
+   /**
+    * State of ConstrainedVerticalPath at the top of an iteration of its constant CAS loop. The extents cover
+    * every point generated before the checkpoint, including points that were later rolled back.
+    */
+   struct PredictionCheckpoint {
+      std::size_t path_size{0};
+      std::size_t last_waypoint_state_size{0};
+      std::vector<int> vertical_path_waypoint_index{};
+      double max_along_path_distance_m{0};
+      double max_altitude_m{0};
+   };
+
+   struct PredictionCache {
+      bool valid{false};
+      PredictionInputs inputs{};
+      Units::Length aircraft_distance_to_go{};
+      Units::Length start_altitude{};
+      VerticalPath untrimmed_path{};
+      std::vector<PredictionCheckpoint> checkpoints{};
+      std::size_t scanned_path_size{0};
+      double max_along_path_distance_m{0};
+      double max_altitude_m{0};
+   };
+
    void ConstrainedVerticalPath(std::vector<HorizontalPath> &horizontal_path,
                                 std::vector<PrecalcWaypoint> &precalc_waypoints, double deceleration,
                                 double const_gamma_cas_term, double const_gamma_cas_er, double const_gamma_mach,
                                 const WeatherPrediction &weather_prediction,
+                                const Units::Length &aircraft_distance_to_go, const PredictionCheckpoint *resume_from);
+
+   PredictionSettings CapturePredictionSettings(const WeatherPrediction &weather_prediction) const;
+
+   static std::uint64_t FingerprintPredictionInputs(const std::vector<HorizontalPath> &horizontal_path,
+                                                    const std::vector<PrecalcWaypoint> &precalc_waypoints,
+                                                    const WeatherPrediction &weather_prediction);
+
+   bool CachedInputsMatch(const PredictionSettings &settings, std::uint64_t fingerprint,
+                          const std::vector<HorizontalPath> &horizontal_path,
+                          const std::vector<PrecalcWaypoint> &precalc_waypoints,
+                          const WeatherPrediction &weather_prediction) const;
+
+   void CapturePredictionInputs(const PredictionSettings &settings, std::uint64_t fingerprint,
+                                const std::vector<HorizontalPath> &horizontal_path,
+                                const std::vector<PrecalcWaypoint> &precalc_waypoints,
+                                const WeatherPrediction &weather_prediction);
+
+   const PredictionCheckpoint *FindResumableCheckpoint(const Units::Length &aircraft_distance_to_go) const;
+
+   void RecordCheckpoint(std::size_t last_waypoint_state_size);
+
+   std::size_t EstimateVerticalPathSize(const std::vector<HorizontalPath> &horizontal_path) const;
+
+   void RollBackVerticalPath(std::size_t size);
+
+   void ScanGeneratedPath(std::size_t begin);
+
+   void ConstantCasVerticalPath(VerticalPath &vertical_path, double altitude_at_end,
+                                std::vector<HorizontalPath> &horizontal_path,
+                                std::vector<PrecalcWaypoint> &precalc_waypoints, double gamma,
+                                const WeatherPrediction &weather_prediction,
                                 const Units::Length &aircraft_distance_to_go);
 
-   VerticalPath ConstantCasVerticalPath(VerticalPath vertical_path, double altitude_at_end,
-                                        std::vector<HorizontalPath> &horizontal_path,
-                                        std::vector<PrecalcWaypoint> &precalc_waypoints, double gamma,
-                                        const WeatherPrediction &weather_prediction,
-                                        const Units::Length &aircraft_distance_to_go);
+   void ConstantMachVerticalPath(VerticalPath &vertical_path, double altitude_at_end,
+                                 std::vector<HorizontalPath> &horizontal_path,
+                                 std::vector<PrecalcWaypoint> &precalc_waypoints, double gamma,
+                                 const WeatherPrediction &weather_prediction,
+                                 const Units::Length &aircraft_distance_to_go);
 
-   VerticalPath ConstantMachVerticalPath(VerticalPath vertical_path, double altitude_at_end,
+   void ConstantGeometricFpaVerticalPath(VerticalPath &vertical_path, double altitude_at_end, double flight_path_angle,
                                          std::vector<HorizontalPath> &horizontal_path,
-                                         std::vector<PrecalcWaypoint> &precalc_waypoints, double gamma,
+                                         std::vector<PrecalcWaypoint> &precalc_waypoints,
                                          const WeatherPrediction &weather_prediction,
                                          const Units::Length &aircraft_distance_to_go);
 
-   VerticalPath ConstantGeometricFpaVerticalPath(VerticalPath vertical_path, double altitude_at_end,
-                                                 double flight_path_angle, std::vector<HorizontalPath> &horizontal_path,
-                                                 std::vector<PrecalcWaypoint> &precalc_waypoints,
-                                                 const WeatherPrediction &weather_prediction,
-                                                 const Units::Length &aircraft_distance_to_go);
+   void ConstantFpaDecelerationVerticalPath(VerticalPath &vertical_path, double altitude_at_end, double deceleration,
+                                            double velocity_cas_end, double flight_path_angle,
+                                            std::vector<HorizontalPath> &horizontal_path,
+                                            std::vector<PrecalcWaypoint> &precalc_waypoints,
+                                            const WeatherPrediction &weather_prediction,
+                                            const Units::Length &aircraft_distance_to_go);
 
-   VerticalPath ConstantFpaDecelerationVerticalPath(VerticalPath vertical_path, double altitude_at_end,
-                                                    double deceleration, double velocity_cas_end,
-                                                    double flight_path_angle,
-                                                    std::vector<HorizontalPath> &horizontal_path,
-                                                    std::vector<PrecalcWaypoint> &precalc_waypoints,
-                                                    const WeatherPrediction &weather_prediction,
-                                                    const Units::Length &aircraft_distance_to_go);
-
-   VerticalPath LevelVerticalPath(VerticalPath vertical_path, double x_end,
-                                  std::vector<HorizontalPath> &horizontal_path,
-                                  const WeatherPrediction &weather_prediction,
-                                  const Units::Length &aircraft_distance_to_go);
-
-   VerticalPath ConstantDecelerationVerticalPath(VerticalPath vertical_path, Units::Length distance_to_go,
-                                                 Units::Length altitude_high, double deceleration,
-                                                 double velocity_cas_end, std::vector<HorizontalPath> &horizontal_path,
-                                                 const WeatherPrediction &weather_prediction,
-                                                 const Units::Length &aircraft_distance_to_go);
+   void LevelVerticalPath(VerticalPath &vertical_path, double x_end, std::vector<HorizontalPath> &horizontal_path,
+                          const WeatherPrediction &weather_prediction, const Units::Length &aircraft_distance_to_go);
 
-   VerticalPath LevelDecelerationVerticalPath(VerticalPath vertical_path, double deceleration, double velocity_cas_end,
-                                              std::vector<HorizontalPath> &horizontal_path,
-                                              const WeatherPrediction &weather_prediction,
-                                              const Units::Length &aircraft_distance_to_go);
+   void ConstantDecelerationVerticalPath(VerticalPath &vertical_path, Units::Length distance_to_go,
+                                         Units::Length altitude_high, double deceleration, double velocity_cas_end,
+                                         std::vector<HorizontalPath> &horizontal_path,
+                                         const WeatherPrediction &weather_prediction,
+                                         const Units::Length &aircraft_distance_to_go);
+
+   void LevelDecelerationVerticalPath(VerticalPath &vertical_path, double deceleration, double velocity_cas_end,
+                                      std::vector<HorizontalPath> &horizontal_path,
+                                      const WeatherPrediction &weather_prediction,
+                                      const Units::Length &aircraft_distance_to_go);
 
-   VerticalPath LevelDecelerationVerticalPath(VerticalPath vertical_path, Units::Length distance_to_go,
-                                              double deceleration, double velocity_cas_end,
-                                              std::vector<HorizontalPath> &horizontal_path,
-                                              const WeatherPrediction &weather_prediction,
-                                              const Units::Length &aircraft_distance_to_go);
+   void LevelDecelerationVerticalPath(VerticalPath &vertical_path, Units::Length distance_to_go, double deceleration,
+                                      double velocity_cas_end, std::vector<HorizontalPath> &horizontal_path,
+                                      const WeatherPrediction &weather_prediction,
+                                      const Units::Length &aircraft_distance_to_go);
 
-   VerticalPath ConstantFpaToCurrentPositionVerticalPath(VerticalPath vertical_path,
-                                                         std::vector<HorizontalPath> &horizontal_path,
-                                                         std::vector<PrecalcWaypoint> &precalc_waypoints,
-                                                         double const_gamma_mach,
-                                                         const WeatherPrediction &weather_prediction,
-                                                         const Units::Length &aircraft_distance_to_go);
+   void ConstantFpaToCurrentPositionVerticalPath(VerticalPath &vertical_path,
+                                                 std::vector<HorizontalPath> &horizontal_path,
+                                                 std::vector<PrecalcWaypoint> &precalc_waypoints,
+                                                 double const_gamma_mach, const WeatherPrediction &weather_prediction,
+                                                 const Units::Length &aircraft_distance_to_go);
 
    void ComputeWindCoefficients(Units::Length altitude, Units::Angle course,
                                 const WeatherPrediction &weather_prediction, Units::Speed &parallel_wind_velocity,
@@ -130,10 +221,13 @@ class KinematicDescent4DPredictor : public VerticalPredictor {
 
    std::vector<int> m_vertical_path_waypoint_index;
    static const Units::Length m_vertical_tolerance_distance;
+   static const Units::Time m_maximum_reserved_descent_duration;
 
    bool m_prediction_too_low;
    bool m_prediction_too_high;
 
+   PredictionCache m_prediction_cache;
+
    static log4cplus::Logger m_logger;
 };
 }  // namespace open_source
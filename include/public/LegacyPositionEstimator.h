@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include "public/EllipsoidalPositionEstimator.h"
+#include "public/DeferredGeodeticPosition.h"
 #include "public/TangentPlaneSequence.h"
 
 namespace aaesim::open_source {
@@ -32,10 +32,21 @@ class LegacyPositionEstimator final : public EllipsoidalPositionEstimator {
    void ComputePosition(const SimulationTime &simtime, const EquationsOfMotionState &eqm_state,
                         const EquationsOfMotionStateDeriv &eqm_state_derivative, EarthModel::GeodeticPosition &position,
                         LatLonDerivative &position_rate) override;
+   std::shared_ptr<const DeferredGeodeticPosition> DeferPosition(
+         const SimulationTime &simtime, const EquationsOfMotionState &eqm_state,
+         const EquationsOfMotionStateDeriv &eqm_state_derivative) override;
 
   private:
-   EarthModel::GeodeticPosition ComputeLatLon(const EquationsOfMotionState &eqm_state) const;
+   static EarthModel::LocalPositionEnu ToLocalPosition(const EquationsOfMotionState &eqm_state);
+   EarthModel::GeodeticPosition ComputeLatLon(const EquationsOfMotionState &eqm_state);
+   EarthModel::GeodeticPosition GetLastPosition();
    std::shared_ptr<TangentPlaneSequence> m_tangent_plane_sequence;
    EarthModel::GeodeticPosition m_last_resolved_position{};
+
+   // Set while the last step was deferred; m_last_resolved_position is then out of date
+   bool m_last_position_is_deferred{false};
+   EarthModel::LocalPositionEnu m_last_local_position{};
+   std::weak_ptr<const DeferredGeodeticPosition> m_last_deferred_position{};
+   std::vector<LocalTangentPlane>::size_type m_closest_tangent_plane_hint{0};
 };
 }  // namespace aaesim::open_source
\ No newline at end of file
@@ -27,7 +27,7 @@
 #pragma once
 
 #include "public/EarthModel.h"
-#include "public/DMatrix.h"
+#include "public/Mat3.h"
 #include "public/Logging.h"
 
 class LocalTangentPlane {
@@ -77,6 +77,39 @@ class LocalTangentPlane {
    /* enu2lla */
    void ConvertLocalToGeodetic(const EarthModel::LocalPositionEnu &enu, EarthModel::GeodeticPosition &geo) const;
 
+   /**
+    * Batch enu2ecef over structure-of-arrays positions. Uses the same arithmetic as the single-position method.
+    *
+    * @throws std::logic_error if the arrays are not all the same size
+    */
+   void ConvertLocalToAbsolute(const EarthModel::CartesianArrays<const double> &enu,
+                               const EarthModel::CartesianArrays<double> &ecef) const;
+
+   /**
+    * Batch ecef2enu over structure-of-arrays positions. Uses the same arithmetic as the single-position method.
+    *
+    * @throws std::logic_error if the arrays are not all the same size
+    */
+   void ConvertAbsoluteToLocal(const EarthModel::CartesianArrays<const double> &ecef,
+                               const EarthModel::CartesianArrays<double> &enu) const;
+
+   /**
+    * Batch lla2enu. Altitude is not an input (see EllipsoidalEarthModel).
+    *
+    * @throws std::logic_error if the arrays are not all the same size
+    */
+   void ConvertGeodeticToLocal(const EarthModel::GeodeticArrays<const double> &geo,
+                               const EarthModel::CartesianArrays<double> &enu) const;
+
+   /**
+    * Batch enu2lla. Tolerance against the single-position method is that of the earth model's batch
+    * ConvertAbsoluteToGeodetic().
+    *
+    * @throws std::logic_error if the arrays are not all the same size
+    */
+   void ConvertLocalToGeodetic(const EarthModel::CartesianArrays<const double> &enu,
+                               const EarthModel::GeodeticArrays<double> &geo) const;
+
    const EarthModel::LocalPositionEnu &getPointOfTangencyEnu() const;
 
    const EarthModel::AbsolutePositionEcef &getPointOfTangencyEcef() const;
@@ -89,8 +122,7 @@ class LocalTangentPlane {
    EarthModel::AbsolutePositionEcef pointOfTangencyEcef;
    EarthModel::LocalPositionEnu pointOfTangencyEnu;
    /** Rotation matrix for (x,y,z)-->(e,n,u) */
-   DMatrix m_ecef_to_enu;
+   aaesim::open_source::Mat3 m_ecef_to_enu;
    /** Rotation matrix for (e,n,u)-->(x,y,z), the inverse */
-   DMatrix m_enu_to_ecef;
-   const static double identity3x3[3][3];  // = { { 1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+   aaesim::open_source::Mat3 m_enu_to_ecef;
 };
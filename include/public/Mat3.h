@@ -0,0 +1,85 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+#pragma once
+
+#include <array>
+
+namespace aaesim::open_source {
+
+/**
+ * Fixed-size 3-vector for ECEF/ENU rotation work. Lives on the stack; use DVector only where the size is dynamic.
+ */
+typedef std::array<double, 3> Vec3;
+
+/**
+ * Fixed-size, row-major 3x3 matrix for ECEF/ENU rotation work. Lives on the stack and is usable in constant
+ * expressions; use DMatrix only where the size is dynamic.
+ *
+ * Element access is m[row][column], as for a zero-based DMatrix. Products accumulate in the same order as
+ * DMatrix::operator*, so replacing one with the other does not change results.
+ */
+class Mat3 final {
+  public:
+   constexpr Mat3() = default;
+
+   constexpr Mat3(const std::array<std::array<double, 3>, 3> &rows) : m_rows(rows) {}
+
+   static constexpr Mat3 Identity() { return Mat3({{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}}); }
+
+   constexpr std::array<double, 3> &operator[](std::size_t row) { return m_rows[row]; }
+
+   constexpr const std::array<double, 3> &operator[](std::size_t row) const { return m_rows[row]; }
+
+   constexpr Mat3 operator*(const Mat3 &that) const {
+      Mat3 result;
+      for (std::size_t i = 0; i < 3; ++i) {
+         for (std::size_t j = 0; j < 3; ++j) {
+            double x = 0;
+            for (std::size_t k = 0; k < 3; ++k) {
+               x += m_rows[i][k] * that.m_rows[k][j];
+            }
+            result.m_rows[i][j] = x;
+         }
+      }
+      return result;
+   }
+
+   constexpr Vec3 operator*(const Vec3 &v) const {
+      return {m_rows[0][0] * v[0] + m_rows[0][1] * v[1] + m_rows[0][2] * v[2],
+              m_rows[1][0] * v[0] + m_rows[1][1] * v[1] + m_rows[1][2] * v[2],
+              m_rows[2][0] * v[0] + m_rows[2][1] * v[1] + m_rows[2][2] * v[2]};
+   }
+
+   constexpr Mat3 Transpose() const {
+      Mat3 result;
+      for (std::size_t i = 0; i < 3; ++i) {
+         for (std::size_t j = 0; j < 3; ++j) {
+            result.m_rows[i][j] = m_rows[j][i];
+         }
+      }
+      return result;
+   }
+
+   constexpr bool operator==(const Mat3 &that) const { return m_rows == that.m_rows; }
+
+  private:
+   std::array<std::array<double, 3>, 3> m_rows{};
+};
+
+}  // namespace aaesim::open_source
@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include "public/EllipsoidalPositionEstimator.h"
+#include "public/DeferredGeodeticPosition.h"
 
 namespace aaesim::open_source {
 class NullPositionEstimator final : public EllipsoidalPositionEstimator {
@@ -33,5 +33,13 @@ class NullPositionEstimator final : public EllipsoidalPositionEstimator {
       position_rate.latitude_time_derivative = Units::zero();
       position_rate.longitude_time_derivative = Units::zero();
    };
+   std::shared_ptr<const DeferredGeodeticPosition> DeferPosition(
+         const SimulationTime &simtime, const EquationsOfMotionState &eqm_state,
+         const EquationsOfMotionStateDeriv &eqm_state_derivative) override {
+      EarthModel::GeodeticPosition position;
+      LatLonDerivative position_rate;
+      ComputePosition(simtime, eqm_state, eqm_state_derivative, position, position_rate);
+      return DeferredGeodeticPosition::Of(position, position_rate);
+   }
 };
 }  // namespace aaesim::open_source
\ No newline at end of file
@@ -0,0 +1,107 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+/**
+ * Counter-based random number generator (Philox4x32-10, Salmon et al. 2011) with the sampling interface of
+ * RandomGenerator.
+ *
+ * A sample is a pure function of the key, the stream and the position in the stream, so a generator is cheap to
+ * copy and Split() produces independent streams without any shared state. Use one generator per thread, Monte
+ * Carlo iteration, or consumer; unlike RandomGenerator, nothing here is logged per sample.
+ */
+class PhiloxRandomGenerator final {
+  public:
+   explicit PhiloxRandomGenerator(std::uint64_t seed = 0, std::uint64_t stream = 0);
+
+   ~PhiloxRandomGenerator() = default;
+
+   /**
+    * An independent generator identified by stream_id. The result depends only on this generator's seed, stream
+    * and stream_id, not on how many samples have been drawn here.
+    */
+   PhiloxRandomGenerator Split(std::uint64_t stream_id) const;
+
+   /**
+    * Drop any buffered sample and skip number_of_blocks counter blocks (two uniform samples each) in constant
+    * time.
+    */
+   void Discard(std::uint64_t number_of_blocks);
+
+   // in (0, 1)
+   double UniformSample();
+
+   double GaussianSample();
+
+   double TruncatedGaussianSample(double max_standard_deviation);
+
+   double RayleighSample();
+
+   double LaplaceSample();
+
+   /**
+    * Batch forms. Each fills samples with the same values as that many calls to the single sample method.
+    */
+   void FillUniform(std::span<double> samples);
+   void FillGaussian(std::span<double> samples);
+   void FillTruncatedGaussian(std::span<double> samples, double max_standard_deviation);
+
+   template <typename T>
+   T GaussianSample(const T mean, const T sigma) {
+      return mean + sigma * GaussianSample();
+   }
+
+   template <typename T>
+   T TruncatedGaussianSample(const T mean, const T sigma, const double max_standard_deviation) {
+      // check for zero standard deviation
+      if (sigma * 0 == sigma) {
+         return mean;
+      }
+      return mean + sigma * TruncatedGaussianSample(max_standard_deviation);
+   }
+
+   template <typename T>
+   T RayleighSample(const T mean, const T sigma) {
+      return mean + sigma * RayleighSample();
+   }
+
+   template <typename T>
+   T LaplaceSample(const T lambda) {
+      return lambda * LaplaceSample();
+   }
+
+  private:
+   typedef std::array<std::uint32_t, 4> Block;
+
+   static Block Philox(Block counter, std::uint64_t key);
+   static double ToUnitInterval(std::uint32_t high, std::uint32_t low);
+
+   void Refill();
+
+   std::uint64_t m_key;
+   std::uint64_t m_stream;
+   std::uint64_t m_block_counter{0};
+   std::array<double, 2> m_buffer{};
+   std::size_t m_buffer_index{2};
+};
@@ -36,6 +36,8 @@ class PositionCalculator : public DirectionOfFlightCourseCalculator {
    PositionCalculator();
    PositionCalculator(const std::vector<HorizontalPath> &horizontal_path,
                       TrajectoryIndexProgressionDirection expected_index_progression);
+   PositionCalculator(std::shared_ptr<const ExtendedHorizontalPath> horizontal_path,
+                      TrajectoryIndexProgressionDirection expected_index_progression);
    virtual ~PositionCalculator();
 
    /**
@@ -0,0 +1,79 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+/**
+ * Interpolates several columns of a profile that is tabulated against an ascending x column, such as the vertical
+ * profiles that are tabulated against distance to go.
+ *
+ * The bracketing row is remembered between calls. An aircraft flying the profile only moves toward smaller x, so
+ * finding the next bracket is usually a step or two down from the last one instead of a search of the whole column.
+ * A query that jumps, or a profile that has been replaced, falls back to a binary search. The bracket agrees with
+ * CoreUtils::FindNearestIndex() everywhere except at exactly the last x. There FindNearestIndex() returns size(),
+ * which CoreUtils::LinearlyInterpolate() rejects with std::out_of_range, while this uses the last segment and so
+ * returns the last row.
+ */
+class ProfileInterpolator final {
+  public:
+   ProfileInterpolator() = default;
+
+   /**
+    * Interpolate every y column at x in one pass.
+    *
+    * Below the first row the first row is returned. At the last row the last row is returned, and above it the last
+    * segment is extrapolated.
+    *
+    * @param x_values ascending, with at least one row
+    * @param y_columns each with as many rows as x_values
+    */
+   template <typename... Columns>
+   std::array<double, sizeof...(Columns)> Interpolate(double x, const std::vector<double> &x_values,
+                                                      const Columns &...y_columns);
+
+   /**
+    * Upper index of the bracket found by the last call, never more than the last index
+    */
+   int GetUpperIndex() const { return m_upper_index; }
+
+  private:
+   int FindUpperIndex(double x, const std::vector<double> &x_values);
+
+   inline static const int MAXIMUM_STEPS_BEFORE_SEARCH{8};
+
+   int m_upper_index{0};
+};
+
+template <typename... Columns>
+std::array<double, sizeof...(Columns)> ProfileInterpolator::Interpolate(double x, const std::vector<double> &x_values,
+                                                                       const Columns &...y_columns) {
+   const int upper_index = FindUpperIndex(x, x_values);
+   if (upper_index == 0) {
+      return {y_columns[0]...};
+   }
+
+   // same arithmetic as CoreUtils::LinearlyInterpolate(), so the results are identical
+   const double x_lower = x_values[upper_index - 1];
+   const double x_span = x_values[upper_index] - x_lower;
+   const double x_offset = x - x_lower;
+   return {((y_columns[upper_index] - y_columns[upper_index - 1]) / x_span * x_offset + y_columns[upper_index - 1])...};
+}
@@ -23,6 +23,9 @@
 
 class RandomGenerator final {
   public:
+   /**
+    * Every default-constructed generator produces the same sequence; call SetSeed to choose another.
+    */
    RandomGenerator();
 
    RandomGenerator(const double seed);
@@ -96,6 +99,7 @@ class RandomGenerator final {
    static const double m_AM;
    static const double m_IQ;
    static const double m_IR;
+   static const double m_default_seed;
 
    double m_seed;
 };
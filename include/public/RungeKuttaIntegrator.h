@@ -0,0 +1,160 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace aaesim::open_source {
+
+enum class IntegrationMethod { FORWARD_EULER, RUNGE_KUTTA_4, DORMAND_PRINCE };
+
+inline IntegrationMethod IntegrationMethodFromString(std::string s) {
+   std::transform(s.cbegin(), s.cend(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+   if (s.empty() || s == "euler") return IntegrationMethod::FORWARD_EULER;
+   if (s == "rk4") return IntegrationMethod::RUNGE_KUTTA_4;
+   if (s == "dormand_prince") return IntegrationMethod::DORMAND_PRINCE;
+   std::string msg = "Invalid IntegrationMethod string: '" + s + "'. Must be 'euler', 'rk4' or 'dormand_prince'.";
+   throw std::runtime_error(msg);
+}
+
+/**
+ * Explicit Runge-Kutta steppers for an autonomous system y' = f(y) of N states.
+ *
+ * Each method returns the effective slope over the step, so that y(h) = y + h * slope. Callers that hold
+ * their inputs (weather, guidance, control gains) constant for a macro step can therefore keep treating
+ * the result as the state derivative, exactly as for forward Euler.
+ */
+template <std::size_t N>
+class RungeKuttaIntegrator final {
+  public:
+   typedef std::array<double, N> Vector;
+
+   struct Tolerance {
+      Vector absolute;
+      double relative;
+   };
+
+   template <typename Derivative>
+   static Vector Slope(IntegrationMethod method, const Vector &y, double h, Derivative &&f,
+                       const Tolerance &tolerance) {
+      switch (method) {
+         case IntegrationMethod::RUNGE_KUTTA_4:
+            return RungeKutta4Slope(y, h, f);
+         case IntegrationMethod::DORMAND_PRINCE:
+            return DormandPrinceSlope(y, h, f, tolerance);
+         case IntegrationMethod::FORWARD_EULER:
+         default:
+            return f(y);
+      }
+   }
+
+   template <typename Derivative>
+   static Vector RungeKutta4Slope(const Vector &y, double h, Derivative &&f) {
+      const Vector k1 = f(y);
+      const Vector k2 = f(Offset(y, h / 2, {k1}, {1.0}));
+      const Vector k3 = f(Offset(y, h / 2, {k2}, {1.0}));
+      const Vector k4 = f(Offset(y, h, {k3}, {1.0}));
+      return Combine({k1, k2, k3, k4}, {1.0 / 6, 2.0 / 6, 2.0 / 6, 1.0 / 6});
+   }
+
+   /**
+    * Adaptive Dormand-Prince 5(4) over [0, h]. Sub-steps are sized from the embedded fourth-order error
+    * estimate; the fifth-order solution is propagated.
+    */
+   template <typename Derivative>
+   static Vector DormandPrinceSlope(const Vector &y0, double h, Derivative &&f, const Tolerance &tolerance) {
+      Vector y = y0;
+      Vector slope{};
+      double elapsed = 0;
+      double step = h;
+      const double minimum_step = h * MINIMUM_STEP_FRACTION;
+      Vector k1 = f(y);
+      while (elapsed < h) {
+         const bool last_step = step >= h - elapsed;
+         if (last_step) step = h - elapsed;
+         const Vector k2 = f(Offset(y, step, {k1}, {1.0 / 5}));
+         const Vector k3 = f(Offset(y, step, {k1, k2}, {3.0 / 40, 9.0 / 40}));
+         const Vector k4 = f(Offset(y, step, {k1, k2, k3}, {44.0 / 45, -56.0 / 15, 32.0 / 9}));
+         const Vector k5 = f(Offset(y, step, {k1, k2, k3, k4},
+                                    {19372.0 / 6561, -25360.0 / 2187, 64448.0 / 6561, -212.0 / 729}));
+         const Vector k6 = f(Offset(y, step, {k1, k2, k3, k4, k5},
+                                    {9017.0 / 3168, -355.0 / 33, 46732.0 / 5247, 49.0 / 176, -5103.0 / 18656}));
+         const Vector step_slope = Combine({k1, k2, k3, k4, k5, k6}, {35.0 / 384, 0, 500.0 / 1113, 125.0 / 192,
+                                                                         -2187.0 / 6784, 11.0 / 84});
+         const Vector y_next = Offset(y, step, {step_slope}, {1.0});
+         const Vector k7 = f(y_next);
+         const Vector error_slope = Combine({k1, k2, k3, k4, k5, k6, k7},
+                                               {71.0 / 57600, 0, -71.0 / 16695, 71.0 / 1920, -17253.0 / 339200,
+                                                22.0 / 525, -1.0 / 40});
+
+         double error = 0;
+         for (std::size_t i = 0; i < N; ++i) {
+            const double scale =
+                  tolerance.absolute[i] + tolerance.relative * std::max(std::abs(y[i]), std::abs(y_next[i]));
+            error = std::max(error, std::abs(step * error_slope[i]) / scale);
+         }
+
+         if (error <= 1 || step <= minimum_step) {
+            for (std::size_t i = 0; i < N; ++i) {
+               slope[i] += step / h * step_slope[i];
+            }
+            elapsed = last_step ? h : elapsed + step;
+            y = y_next;
+            k1 = k7;  // first same as last
+         }
+         const double factor = error == 0 ? MAXIMUM_STEP_GROWTH : 0.9 * std::pow(error, -0.2);
+         step = std::max(step * std::clamp(factor, MINIMUM_STEP_GROWTH, MAXIMUM_STEP_GROWTH), minimum_step);
+      }
+      return slope;
+   }
+
+  private:
+   static constexpr double MINIMUM_STEP_FRACTION = 1e-6;
+   static constexpr double MINIMUM_STEP_GROWTH = 0.2;
+   static constexpr double MAXIMUM_STEP_GROWTH = 5.0;
+
+   template <std::size_t M>
+   static Vector Combine(const Vector (&slopes)[M], const double (&weights)[M]) {
+      Vector result{};
+      for (std::size_t j = 0; j < M; ++j) {
+         if (weights[j] == 0) continue;
+         for (std::size_t i = 0; i < N; ++i) {
+            result[i] += weights[j] * slopes[j][i];
+         }
+      }
+      return result;
+   }
+
+   template <std::size_t M>
+   static Vector Offset(const Vector &y, double h, const Vector (&slopes)[M], const double (&weights)[M]) {
+      Vector result = y;
+      for (std::size_t j = 0; j < M; ++j) {
+         for (std::size_t i = 0; i < N; ++i) {
+            result[i] += h * weights[j] * slopes[j][i];
+         }
+      }
+      return result;
+   }
+};
+}  // namespace aaesim::open_source
@@ -29,7 +29,8 @@ class ScenarioUtils {
   public:
    ~ScenarioUtils() = default;
 
-   static RandomGenerator RANDOM_NUMBER_GENERATOR;
+   // held per thread so that scenarios running concurrently do not interleave draws from one stream
+   static thread_local RandomGenerator RANDOM_NUMBER_GENERATOR;
    static const int AIRCRAFT_ID_NOT_IN_MAP;
    static void ClearAircraftIdMap() { m_aircraft_string_int_map.clear(); }
    static std::string GetAircraftIdForUniqueId(const int unique_id) {
@@ -28,7 +28,7 @@ class SimulationTime final {
   public:
    static inline const Units::SecondsTime SIMULATION_TIME_STEP = Units::SecondsTime(1.0);
 
-   // visible for testing
+   // visible for testing; the time step is held per thread so concurrent scenarios cannot change each other's step
    static void SetSimulationTimeStep(Units::Time in) { m_simulation_time_step = in; }
 
    static const Units::SecondsTime GetSimulationTimeStep() { return m_simulation_time_step; }
@@ -81,6 +81,6 @@ class SimulationTime final {
 
    int m_cycle{0};
    Units::SecondsTime m_current_time{Units::zero()};
-   inline static Units::SecondsTime m_simulation_time_step{SIMULATION_TIME_STEP};
+   inline static thread_local Units::SecondsTime m_simulation_time_step{SIMULATION_TIME_STEP};
 };
 }  // namespace aaesim::open_source
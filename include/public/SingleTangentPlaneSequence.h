@@ -27,7 +27,8 @@ class SingleTangentPlaneSequence final : public TangentPlaneSequence {
    SingleTangentPlaneSequence(const std::list<Waypoint> &waypoint_list);
 
   private:
-   static std::list<Waypoint> m_master_waypoint_sequence;
+   // one master sequence per thread so that concurrently running scenarios do not share routes
+   static thread_local std::list<Waypoint> m_master_waypoint_sequence;
    static log4cplus::Logger m_logger;
    void Initialize(const std::list<Waypoint> &waypoint_list) override;
 };
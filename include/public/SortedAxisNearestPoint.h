@@ -0,0 +1,149 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace aaesim::open_source {
+
+/**
+ * Exact nearest-point search over a fixed set of points in DIMENSION-space.
+ *
+ * The points are stored contiguously, sorted along the axis on which they are most spread out. A query sweeps
+ * outward from its own coordinate on that axis and stops in each direction once the separation along that axis
+ * alone exceeds the best squared distance found so far. A hint, typically the answer to the previous query of a
+ * moving object, seeds the best distance so that the sweep usually ends after a point or two.
+ *
+ * The answer is identical to a linear scan that keeps the first minimum of dx * dx + dy * dy (+ dz * dz), including
+ * for ties and non-finite queries.
+ */
+template <std::size_t DIMENSION>
+class SortedAxisNearestPoint final {
+  public:
+   typedef std::array<double, DIMENSION> Point;
+
+   SortedAxisNearestPoint() = default;
+
+   explicit SortedAxisNearestPoint(const std::vector<Point> &points) {
+      m_is_sweep_usable = !points.empty();
+      Point lower{}, upper{};
+      if (!points.empty()) lower = upper = points.front();
+      for (const auto &point : points) {
+         for (std::size_t d = 0; d < DIMENSION; ++d) {
+            m_is_sweep_usable = m_is_sweep_usable && std::isfinite(point[d]);
+            lower[d] = std::min(lower[d], point[d]);
+            upper[d] = std::max(upper[d], point[d]);
+         }
+      }
+      for (std::size_t d = 1; d < DIMENSION; ++d) {
+         if (upper[d] - lower[d] > upper[m_axis] - lower[m_axis]) m_axis = d;
+      }
+
+      std::vector<std::size_t> order(points.size());
+      std::iota(order.begin(), order.end(), 0);
+      if (m_is_sweep_usable) {
+         std::stable_sort(order.begin(), order.end(), [this, &points](std::size_t lhs, std::size_t rhs) {
+            return points[lhs][m_axis] < points[rhs][m_axis];
+         });
+      }
+      m_sorted_points.reserve(points.size());
+      m_sorted_axis_values.reserve(points.size());
+      m_original_index.reserve(points.size());
+      m_sorted_position.resize(points.size());
+      for (std::size_t k = 0; k < order.size(); ++k) {
+         m_sorted_points.push_back(points[order[k]]);
+         m_sorted_axis_values.push_back(points[order[k]][m_axis]);
+         m_original_index.push_back(order[k]);
+         m_sorted_position[order[k]] = k;
+      }
+   }
+
+   bool IsEmpty() const { return m_sorted_points.empty(); }
+
+   std::size_t Size() const { return m_sorted_points.size(); }
+
+   /**
+    * @param query point
+    * @param hint index of a point believed to be near query; any value is safe
+    * @return index, in construction order, of the nearest point. Undefined if IsEmpty().
+    */
+   std::size_t FindNearest(const Point &query, std::size_t hint) const {
+      bool is_query_finite = true;
+      for (std::size_t d = 0; d < DIMENSION; ++d) is_query_finite = is_query_finite && std::isfinite(query[d]);
+      if (!m_is_sweep_usable || !is_query_finite) {
+         return FindNearestByLinearScan(query);
+      }
+
+      std::size_t best_index = hint < m_sorted_points.size() ? hint : 0;
+      double best_distance = SquaredDistance(query, m_sorted_points[m_sorted_position[best_index]]);
+      const auto consider = [this, &query, &best_index, &best_distance](std::size_t k) {
+         const double distance = SquaredDistance(query, m_sorted_points[k]);
+         if (distance < best_distance || (distance == best_distance && m_original_index[k] < best_index)) {
+            best_distance = distance;
+            best_index = m_original_index[k];
+         }
+      };
+
+      const auto start = static_cast<std::size_t>(
+            std::lower_bound(m_sorted_axis_values.begin(), m_sorted_axis_values.end(), query[m_axis]) -
+            m_sorted_axis_values.begin());
+      for (std::size_t k = start; k < m_sorted_points.size(); ++k) {
+         const double separation = query[m_axis] - m_sorted_axis_values[k];
+         if (separation * separation > best_distance) break;
+         consider(k);
+      }
+      for (std::size_t k = start; k > 0; --k) {
+         const double separation = query[m_axis] - m_sorted_axis_values[k - 1];
+         if (separation * separation > best_distance) break;
+         consider(k - 1);
+      }
+      return best_index;
+   }
+
+  private:
+   std::size_t m_axis{0};
+   bool m_is_sweep_usable{false};
+   std::vector<Point> m_sorted_points{};
+   std::vector<double> m_sorted_axis_values{};
+   std::vector<std::size_t> m_original_index{};
+   std::vector<std::size_t> m_sorted_position{};
+
+   static double SquaredDistance(const Point &query, const Point &point) {
+      double sum = 0;
+      for (std::size_t d = 0; d < DIMENSION; ++d) {
+         const double delta = query[d] - point[d];
+         sum += delta * delta;
+      }
+      return sum;
+   }
+
+   std::size_t FindNearestByLinearScan(const Point &query) const {
+      std::vector<double> distances(m_sorted_points.size());
+      for (std::size_t k = 0; k < m_sorted_points.size(); ++k) {
+         distances[m_original_index[k]] = SquaredDistance(query, m_sorted_points[k]);
+      }
+      return static_cast<std::size_t>(std::min_element(distances.begin(), distances.end()) - distances.begin());
+   }
+};
+
+}  // namespace aaesim::open_source
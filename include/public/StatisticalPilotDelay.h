@@ -21,13 +21,16 @@
 
 #include "public/PilotDelay.h"
 
+#include <array>
 #include <map>
+#include <optional>
 
 #include "public/Logging.h"
 #include "scalar/Length.h"
 #include "scalar/Time.h"
 #include "scalar/Speed.h"
 #include "public/Atmosphere.h"
+#include "public/PhiloxRandomGenerator.h"
 
 namespace aaesim::open_source {
 class StatisticalPilotDelay final : public PilotDelay {
@@ -54,11 +57,18 @@ class StatisticalPilotDelay final : public PilotDelay {
 
    std::pair<Units::Time, Units::Time> GetPilotDelayParameters() const;
 
+   /**
+    * Draw delays from random_stream, owned by this instance, instead of the thread's shared
+    * ScenarioUtils::RANDOM_NUMBER_GENERATOR.
+    */
+   void SetRandomStream(const PhiloxRandomGenerator &random_stream);
+
   private:
    Units::Time ComputeTimeToSpeedChange(Units::Length current_altitude, Units::Length altitude_at_end_of_route);
    void SetAtmosphere(std::shared_ptr<Atmosphere> atmosphere);
    void SetInitialIAS(Units::Length current_altitude, Units::Speed fallback_IAS);
    void SetPilotDelayParameters(const Units::Time mean, const Units::Time standard_deviation);
+   Units::Time SampleDelay(Units::Time mean, Units::Time standard_deviation);
 
    // for speed conversion
    std::shared_ptr<Atmosphere> m_atmosphere{};
@@ -77,6 +87,12 @@ class StatisticalPilotDelay final : public PilotDelay {
    double m_delay_square_sum{0};
    std::map<double, int> m_delay_frequency{};
 
+   // standard truncated Gaussian samples are drawn from the stream a batch at a time
+   static const std::size_t SAMPLE_BATCH_SIZE{16};
+   std::optional<PhiloxRandomGenerator> m_random_stream{};
+   std::array<double, SAMPLE_BATCH_SIZE> m_sample_batch{};
+   std::size_t m_sample_batch_index{SAMPLE_BATCH_SIZE};
+
    inline static const double STANDARD_DEVIATION_LIMIT{3};
    static log4cplus::Logger m_logger;
 };
@@ -85,6 +101,11 @@ inline void StatisticalPilotDelay::SetAtmosphere(std::shared_ptr<Atmosphere> atm
 
 inline void StatisticalPilotDelay::SetUsePilotDelay(const bool delay_enabled) { m_pilot_delay_is_on = delay_enabled; }
 
+inline void StatisticalPilotDelay::SetRandomStream(const PhiloxRandomGenerator &random_stream) {
+   m_random_stream = random_stream;
+   m_sample_batch_index = SAMPLE_BATCH_SIZE;
+}
+
 inline bool StatisticalPilotDelay::IsPilotDelayOn() const { return m_pilot_delay_is_on; }
 
 inline std::pair<Units::Time, Units::Time> StatisticalPilotDelay::GetPilotDelayParameters() const {
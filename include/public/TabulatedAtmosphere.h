@@ -0,0 +1,121 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+/**
+ * TabulatedAtmosphere decorates an analytic Atmosphere with lookup tables.
+ *
+ * Temperature, pressure and density are sampled from the analytic model on a uniform altitude grid
+ * when the decorator is built (and again whenever the temperature offset changes). Queries inside the
+ * table interpolate linearly between samples; queries outside it are delegated to the analytic model.
+ *
+ * The grid is split at the tropopause so that the kink in the temperature lapse rate always falls on a
+ * sample. Temperature is then exact, and pressure and density are smooth within each interval, so the
+ * relative interpolation error is bounded by (step / scale height)^2 / 8: about 3e-7 for the default
+ * 10 m step.
+ *
+ * Everything that is not a function of altitude alone (CAS2TAS, TAS2CAS, SpeedOfSound, ESFconstantCAS,
+ * etc.) is delegated to the analytic model, which is evaluated with the tabulated pressure and density.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "public/Atmosphere.h"
+
+class TabulatedAtmosphere final : public Atmosphere {
+  public:
+   static const Units::MetersLength DEFAULT_ALTITUDE_STEP;
+   static const Units::MetersLength DEFAULT_MINIMUM_ALTITUDE;
+   static const Units::MetersLength DEFAULT_MAXIMUM_ALTITUDE;
+
+   TabulatedAtmosphere(std::unique_ptr<Atmosphere> analytic_atmosphere,
+                       Units::Length altitude_step = DEFAULT_ALTITUDE_STEP,
+                       Units::Length minimum_altitude = DEFAULT_MINIMUM_ALTITUDE,
+                       Units::Length maximum_altitude = DEFAULT_MAXIMUM_ALTITUDE);
+
+   TabulatedAtmosphere(const TabulatedAtmosphere &obj);
+
+   virtual ~TabulatedAtmosphere() = default;
+
+   Atmosphere *Clone() const override;
+
+   void SetTemperatureOffset(const Units::Temperature temperature_offset) override;
+
+   void CalibrateTemperatureAtAltitude(const Units::KelvinTemperature temperature,
+                                       const Units::Length altitude) override;
+
+   Units::KelvinTemperature GetTemperature(const Units::Length altitude_msl) const override;
+
+   void AirDensity(const Units::Length h, Units::Density &rho, Units::Pressure &P) const override;
+
+   Units::Speed CAS2TAS(const Units::Speed vcas, const Units::Pressure p, const Units::Density rho) const override;
+
+   Units::Speed TAS2CAS(const Units::Speed vtas, const Units::Pressure p, const Units::Density rho) const override;
+
+   Units::Length GetMachIASTransition(const Units::Speed ias, const double mach) const override;
+
+   Units::Speed SpeedOfSound(Units::KelvinTemperature temperature) const override;
+
+   Units::KelvinTemperature GetSeaLevelTemperature() const override;
+
+   Units::MetersLength GetTropopauseHeight() const override;
+
+   Units::Pressure GetTropopausePressure() const override;
+
+   double ESFconstantCAS(const Units::Speed true_airspeed, const Units::Length altitude_msl,
+                         const Units::KelvinTemperature temperature) const override;
+
+   const Atmosphere &GetAnalyticAtmosphere() const;
+
+   using Atmosphere::CAS2TAS;
+   using Atmosphere::SpeedOfSound;
+   using Atmosphere::TAS2CAS;
+
+  private:
+   struct Sample {
+      double temperature_kelvin;
+      double pressure_pascals;
+      double density_kilograms_per_cubic_meter;
+   };
+
+   /** One uniformly spaced segment of the table, covering [minimum_meters, maximum_meters]. */
+   struct Segment {
+      double minimum_meters{0};
+      double maximum_meters{0};
+      double step_meters{0};
+      std::vector<Sample> samples{};
+
+      bool Contains(double altitude_meters) const;
+      Sample Interpolate(double altitude_meters) const;
+   };
+
+   void BuildTables();
+   Segment BuildSegment(double lower_meters, double upper_meters) const;
+   const Segment *FindSegment(double altitude_meters) const;
+
+   std::unique_ptr<Atmosphere> m_analytic_atmosphere;
+   double m_altitude_step_meters;
+   double m_minimum_altitude_meters;
+   double m_maximum_altitude_meters;
+   Segment m_troposphere;
+   Segment m_tropopause;
+};
+
+inline const Atmosphere &TabulatedAtmosphere::GetAnalyticAtmosphere() const { return *m_analytic_atmosphere; }
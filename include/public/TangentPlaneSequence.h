@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "public/LocalTangentPlane.h"
+#include "public/SortedAxisNearestPoint.h"
 #include "public/Waypoint.h"
 
 /**
@@ -76,6 +77,36 @@ class TangentPlaneSequence {
    void ConvertGeodeticToLocal(EarthModel::GeodeticPosition geoPosition,
                                EarthModel::LocalPositionEnu &localPosition) const;
 
+   /**
+    * Same as ConvertLocalToGeodetic() above, for callers that convert a moving position repeatedly.
+    *
+    * @param closest_plane_hint in: the plane used by the caller's previous conversion (any value is safe);
+    *        out: the plane used by this conversion
+    */
+   void ConvertLocalToGeodetic(EarthModel::LocalPositionEnu local_position, EarthModel::GeodeticPosition &geo_position,
+                               std::vector<LocalTangentPlane>::size_type &closest_plane_hint) const;
+
+   /**
+    * Same as ConvertGeodeticToLocal() above, for callers that convert a moving position repeatedly.
+    *
+    * @param closest_plane_hint in: the plane used by the caller's previous conversion (any value is safe);
+    *        out: the plane used by this conversion
+    */
+   void ConvertGeodeticToLocal(EarthModel::GeodeticPosition geo_position, EarthModel::LocalPositionEnu &local_position,
+                               std::vector<LocalTangentPlane>::size_type &closest_plane_hint) const;
+
+   /**
+    * Converts every position in local_positions, in order, into geo_positions (resized to match).
+    */
+   void ConvertLocalToGeodetic(const std::vector<EarthModel::LocalPositionEnu> &local_positions,
+                               std::vector<EarthModel::GeodeticPosition> &geo_positions) const;
+
+   /**
+    * Converts every position in geo_positions, in order, into local_positions (resized to match).
+    */
+   void ConvertGeodeticToLocal(const std::vector<EarthModel::GeodeticPosition> &geo_positions,
+                               std::vector<EarthModel::LocalPositionEnu> &local_positions) const;
+
    /**
     * Returns the ENU coordinates of each of the waypoints
     * supplied during construction.
@@ -98,6 +129,12 @@ class TangentPlaneSequence {
 
    void Copy(const TangentPlaneSequence &in);
 
+   // points of tangency of tangent_planes_from_initialization_, in meters, for the closest-plane searches
+   aaesim::open_source::SortedAxisNearestPoint<2> closest_plane_by_enu_{};
+   aaesim::open_source::SortedAxisNearestPoint<3> closest_plane_by_ecef_{};
+
+   void BuildClosestPlaneSearches();
+
   protected:
    virtual void Initialize(const std::list<Waypoint> &waypoint_list);
 
@@ -25,17 +25,20 @@
 #include <scalar/Length.h>
 #include <scalar/Speed.h>
 
-#include <map>
+#include <span>
 #include <string>
 
 #include "public/AircraftControl.h"
 #include "public/AircraftState.h"
 #include "public/DynamicsState.h"
+#include "public/DynamicsStateHistory.h"
 #include "public/EllipsoidalPositionEstimator.h"
+#include "public/EquationsOfMotionKernel.h"
 #include "public/EquationsOfMotionState.h"
 #include "public/EquationsOfMotionStateDeriv.h"
 #include "public/FixedMassAircraftPerformance.h"
 #include "public/Guidance.h"
+#include "public/RungeKuttaIntegrator.h"
 #include "public/SimulationTime.h"
 #include "public/TrueWeatherOperator.h"
 
@@ -65,9 +68,31 @@ class ThreeDOFDynamics final {
 
    const EquationsOfMotionStateDeriv GetEquationsOfMotionStateDerivative() const;
 
-   std::map<const aaesim::open_source::SimulationTime, const DynamicsState> GetDynamicsStateHistory() const;
+   /**
+    * Dynamics states retained under the current history policy, oldest first. The view is invalidated by the
+    * next Update().
+    */
+   std::span<const DynamicsStateHistory::Entry> GetDynamicsStateHistory() const;
+
+   void SetDynamicsStateHistoryPolicy(DynamicsStateHistory::Policy policy, std::size_t ring_length = 1);
+
+   /**
+    * Select how the equations of motion are advanced over each simulation time step. Weather, guidance and
+    * control commands are evaluated once per step and held for every stage of the chosen method.
+    */
+   void SetIntegrationMethod(IntegrationMethod integration_method);
+
+   IntegrationMethod GetIntegrationMethod() const;
 
   private:
+   typedef RungeKuttaIntegrator<EquationsOfMotionKernel::STATE_SIZE> StateIntegrator;
+
+   static EquationsOfMotionKernel::State ToStateVector(const EquationsOfMotionState &state);
+
+   static EquationsOfMotionStateDeriv FromDerivativeVector(
+         const EquationsOfMotionKernel::State &vector,
+         aaesim::open_source::bada_utils::FlapConfiguration flap_configuration);
+
    inline static log4cplus::Logger m_logger{log4cplus::Logger::getInstance(LOG4CPLUS_TEXT("ThreeDOFDynamics"))};
 
    DynamicsState Integrate(const Guidance &guidance, const std::shared_ptr<AircraftControl> &aircraft_control);
@@ -75,13 +100,16 @@ class ThreeDOFDynamics final {
    // Calculate the trim angle correction necessary and provides an updated state
    Units::SignedRadiansAngle CalculateTrimmedPsiForWind(Units::SignedAngle ground_track_enu);
 
-   EquationsOfMotionStateDeriv StatePropagation(Units::Frequency dVwx_dh, Units::Frequency dVwy_dh,
-                                                Units::Frequency k_gamma, Units::Frequency k_t, Units::Frequency k_phi,
-                                                double k_speedBrake, ControlCommands commands);
+   // Pack the weather, drag coefficients, commands and gains that are held for one simulation step
+   EquationsOfMotionKernel::StepInputs BuildStepInputs(const ControlCommands &commands,
+                                                       const ControlGains &gains) const;
 
    EquationsOfMotionStateDeriv StatePropagationOnRunway(ControlCommands commands, const Guidance &guidance);
 
-   void CalculateKineticForces(Units::Force &lift, Units::Force &drag);
+   void CalculateKineticForces(const EquationsOfMotionState &state, Units::Force &lift, Units::Force &drag);
+
+   void LogKineticForces(const EquationsOfMotionKernel::StepInputs &inputs, const EquationsOfMotionKernel::State &state,
+                         const EquationsOfMotionKernel::KineticForces &forces) const;
 
    void UpdateTrueWeatherConditions();
 
@@ -89,8 +117,9 @@ class ThreeDOFDynamics final {
                                       const EquationsOfMotionStateDeriv &equations_of_motion_state_derivative) const;
 
    std::shared_ptr<const aaesim::open_source::FixedMassAircraftPerformance> m_bada_calculator{};
+   EquationsOfMotionKernel::AircraftConstants m_aircraft_constants{};
    std::shared_ptr<aaesim::open_source::EllipsoidalPositionEstimator> m_position_estimator;
-   std::map<const aaesim::open_source::SimulationTime, const DynamicsState> m_dynamics_history{};
+   DynamicsStateHistory m_dynamics_history{};
    EquationsOfMotionState m_equations_of_motion_state{};
    EquationsOfMotionStateDeriv m_equations_of_motion_state_derivative{};
    EarthModel::GeodeticPosition m_last_resolved_position{};
@@ -99,6 +128,7 @@ class ThreeDOFDynamics final {
    double m_max_thrust_percent{1.0};
    double m_min_thrust_percent{1.0};
    std::shared_ptr<aaesim::open_source::TrueWeatherOperator> m_true_weather_operator;
+   IntegrationMethod m_integration_method{IntegrationMethod::FORWARD_EULER};
 };
 
 inline const std::pair<Units::Speed, Units::Speed> ThreeDOFDynamics::GetWindComponents() const {
@@ -106,8 +136,8 @@ inline const std::pair<Units::Speed, Units::Speed> ThreeDOFDynamics::GetWindComp
 }
 
 inline const DynamicsState ThreeDOFDynamics::GetDynamicsState() const {
-   if (m_dynamics_history.empty()) return DynamicsState{};
-   return std::prev(m_dynamics_history.cend())->second;
+   if (m_dynamics_history.IsEmpty()) return DynamicsState{};
+   return m_dynamics_history.GetLatestState();
 }
 
 inline const EquationsOfMotionState ThreeDOFDynamics::GetEquationsOfMotionState() const {
@@ -118,9 +148,19 @@ inline const EquationsOfMotionStateDeriv ThreeDOFDynamics::GetEquationsOfMotionS
    return m_equations_of_motion_state_derivative;
 }
 
-inline std::map<const aaesim::open_source::SimulationTime, const DynamicsState>
-      ThreeDOFDynamics::GetDynamicsStateHistory() const {
-   return m_dynamics_history;
+inline std::span<const DynamicsStateHistory::Entry> ThreeDOFDynamics::GetDynamicsStateHistory() const {
+   return m_dynamics_history.GetRetainedStates();
+}
+
+inline void ThreeDOFDynamics::SetDynamicsStateHistoryPolicy(DynamicsStateHistory::Policy policy,
+                                                            std::size_t ring_length) {
+   m_dynamics_history.SetPolicy(policy, ring_length);
 }
 
+inline void ThreeDOFDynamics::SetIntegrationMethod(IntegrationMethod integration_method) {
+   m_integration_method = integration_method;
+}
+
+inline IntegrationMethod ThreeDOFDynamics::GetIntegrationMethod() const { return m_integration_method; }
+
 }  // namespace aaesim::open_source
\ No newline at end of file
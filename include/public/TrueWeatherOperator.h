@@ -39,5 +39,10 @@ struct TrueWeatherOperator {
    virtual Units::Pressure GetPressure() const = 0;
    virtual std::shared_ptr<const Atmosphere> GetAtmosphere() const = 0;
    virtual std::shared_ptr<const aaesim::open_source::WeatherTruth> GetTrueWeather() const = 0;
+
+   /**
+    * False when CalculateEnvironmentalWind() ignores the geodetic position, so callers need not compute it.
+    */
+   virtual bool IsPositionDependent() const { return true; }
 };
 }  // namespace aaesim::open_source
\ No newline at end of file
@@ -57,6 +57,25 @@ class VerticalPath final {
 
    void operator+=(const VerticalPath &in);
 
+   std::size_t Size() const;
+
+   /**
+    * Reserve room for size records in every column, so that appending up to that many records does not
+    * reallocate any of them.
+    */
+   void Reserve(std::size_t size);
+
+   /**
+    * Discard every record. The columns keep their capacity for the next path.
+    */
+   void Clear();
+
+   /**
+    * Discard every record at or after index size, keeping the first size records. Capacity is kept, so a
+    * Size() taken earlier acts as a snapshot that this rolls back to without reallocating.
+    */
+   void Truncate(std::size_t size);
+
    bool operator==(const VerticalPath &obj) const;
 
    std::vector<double> along_path_distance_m;
@@ -75,3 +94,5 @@ class VerticalPath final {
    std::vector<PredictionAlgorithmType> algorithm_type;
    std::vector<aaesim::open_source::bada_utils::FlapConfiguration> flap_setting;
 };
+
+inline std::size_t VerticalPath::Size() const { return along_path_distance_m.size(); }
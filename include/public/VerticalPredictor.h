@@ -31,6 +31,7 @@
 #include "public/HorizontalPath.h"
 #include "public/PrecalcConstraint.h"
 #include "public/PrecalcWaypoint.h"
+#include "public/ProfileInterpolator.h"
 #include "public/VerticalPath.h"
 #include "public/WeatherPrediction.h"
 #include "scalar/Length.h"
@@ -114,6 +115,7 @@ class VerticalPredictor {
    const Units::DegreesAngle DESCENT_ANGLE_MAX;
    const Units::DegreesAngle DESCENT_ANGLE_WARNING;
    int m_current_trajectory_index;
+   ProfileInterpolator m_profile_interpolator;
    Units::Length m_cruise_altitude_msl;
    Units::Time m_descent_start_time;
    Units::Speed m_transition_ias;
@@ -61,6 +61,11 @@ class WeatherEstimate {
 
    virtual void LoadConditionsAt(const Units::Angle latitude, const Units::Angle longitude,
                                  const Units::Length altitude);
+
+   /**
+    * False when LoadConditionsAt() ignores latitude and longitude.
+    */
+   virtual bool IsPositionDependent() const { return true; }
    Units::Density GetDensity() const;
    Units::Pressure GetPressure() const;
    Units::KelvinTemperature GetTemperature() const;
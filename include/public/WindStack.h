@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <scalar/Length.h>
 #include <scalar/Speed.h>
@@ -26,8 +28,16 @@
 
 namespace aaesim {
 namespace open_source {
+/**
+ * Rows are addressed by absolute index in [min, max]; rows in [0, min) read as infinite.
+ * Stacks of up to INLINE_ROW_CAPACITY rows (the 5-row stencil used for wind gradients) are
+ * held in fixed inline storage, so rebuilding or copying them never allocates. Larger
+ * stacks fall back to vectors whose capacity is reused across SetBounds calls.
+ */
 class WindStack {
   public:
+   static constexpr int INLINE_ROW_CAPACITY = 5;
+
    WindStack();
 
    WindStack(const WindStack &in);
@@ -65,6 +75,15 @@ class WindStack {
    static bool AltitudeComparator(std::pair<Units::Length, Units::Speed> item1,
                                   std::pair<Units::Length, Units::Speed> item2);
    void Copy(const WindStack &in);
+   int GetRowCount() const;
+   bool UsesInlineStorage() const;
+   int RowOffset(const int index) const;
+   Units::Length &AltitudeRow(const int row);
+   const Units::Length &AltitudeRow(const int row) const;
+   Units::Speed &SpeedRow(const int row);
+   const Units::Speed &SpeedRow(const int row) const;
+   std::array<Units::Length, INLINE_ROW_CAPACITY> m_inline_altitude;
+   std::array<Units::Speed, INLINE_ROW_CAPACITY> m_inline_speed;
    std::vector<Units::Length> m_altitude;
    std::vector<Units::Speed> m_speed;
    int m_minimum_data_index, m_maximum_data_index;
@@ -74,6 +93,26 @@ inline int WindStack::GetMinRow() const { return m_minimum_data_index; }
 
 inline int WindStack::GetMaxRow() const { return m_maximum_data_index; }
 
+inline int WindStack::GetRowCount() const { return std::max(m_maximum_data_index - m_minimum_data_index + 1, 0); }
+
+inline bool WindStack::UsesInlineStorage() const { return GetRowCount() <= INLINE_ROW_CAPACITY; }
+
+inline Units::Length &WindStack::AltitudeRow(const int row) {
+   return UsesInlineStorage() ? m_inline_altitude[row] : m_altitude[row];
+}
+
+inline const Units::Length &WindStack::AltitudeRow(const int row) const {
+   return UsesInlineStorage() ? m_inline_altitude[row] : m_altitude[row];
+}
+
+inline Units::Speed &WindStack::SpeedRow(const int row) {
+   return UsesInlineStorage() ? m_inline_speed[row] : m_speed[row];
+}
+
+inline const Units::Speed &WindStack::SpeedRow(const int row) const {
+   return UsesInlineStorage() ? m_inline_speed[row] : m_speed[row];
+}
+
 inline bool WindStack::AltitudeComparator(std::pair<Units::Length, Units::Speed> item1,
                                           std::pair<Units::Length, Units::Speed> item2) {
    return item1.first < item2.first;
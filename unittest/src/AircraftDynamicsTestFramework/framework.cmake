@@ -6,6 +6,9 @@ set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fPIC")
 set(FMACM_TEST_SOURCE
    ${UNITTEST_DIR}/src/AircraftDynamicsTestFramework/framework_tests.cpp
    ${UNITTEST_DIR}/src/AircraftDynamicsTestFramework/true_weather_tests.cpp
+   ${UNITTEST_DIR}/src/AircraftDynamicsTestFramework/state_writer_tests.cpp
+   ${UNITTEST_DIR}/src/AircraftDynamicsTestFramework/monte_carlo_tests.cpp
+   ${UNITTEST_DIR}/src/AircraftDynamicsTestFramework/input_table_cache_tests.cpp
 )
 add_executable(fmacm_test 
    ${FMACM_TEST_SOURCE}
@@ -18,3 +18,205 @@
 // ****************************************************************************
 
 #include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "framework/AircraftStateWriter.h"
+#include "framework/ApplicationLoader.h"
+#include "framework/FrameworkAircraftLoader.h"
+#include "framework/ParallelAircraftStepper.h"
+#include "loader/DecodedStream.h"
+#include "public/ScenarioUtils.h"
+#include "public/SingleTangentPlaneSequence.h"
+
+#ifdef MITRE_BADA3_LIBRARY
+#include "bada/Bada3Factory.h"
+#endif
+
+namespace fmacm {
+namespace test {
+
+static const int STEPPED_AIRCRAFT_COUNT = 5;
+
+// Builds the Run_Files aircraft several times, each entering the scenario at a different time and mass. Like a
+// scenario, each aircraft gets its own split of one random stream.
+static std::vector<std::shared_ptr<TestFrameworkAircraft>> BuildSteppedAircraft(bool use_pilot_delay) {
+   SingleTangentPlaneSequence::ClearStaticMembers();
+   const PhiloxRandomGenerator random_stream(12345);
+   std::vector<std::shared_ptr<TestFrameworkAircraft>> aircraft;
+   for (int i = 0; i < STEPPED_AIRCRAFT_COUNT; ++i) {
+      const std::string filename = testing::TempDir() + "parallel_aircraft_stepper_test.txt";
+      std::ofstream file(filename);
+      file << "initial_time_seconds " << 15 * i << "\n"
+           << "ac_type B737\n"
+              "speed_management_type pitch\n"
+              "env_csv_file \"../Run_Files/FimAcTv-P~W_JET_ENV.csv\"\n"
+              "env_data_index time\n"
+              "fms_guidance_data_files\n{\n"
+              " hfp_csv_file \"../Run_Files/FimAcTv-P~W_JET_HFP.csv\"\n"
+              " vfp_csv_file \"../Run_Files/FimAcTv-P~W_JET_VFP.csv\"\n"
+              "}\n"
+              "flight_deck_application\n{\n"
+              " pilot_delay_configuration\n {\n"
+              "  use_pilot_delay "
+           << (use_pilot_delay ? "true" : "false")
+           << "\n"
+              "  pilot_delay_seconds 10\n"
+              "  pilot_delay_standard_deviation_seconds 5\n"
+              " }\n"
+              " im_speed_commands_from_file\n {\n"
+              "  imspd_csv_file \"../Run_Files/FimAcTv-P~W_JET_Im_Spd.csv\"\n"
+              " }\n"
+              "}\n";
+      file.close();
+
+      DecodedStream stream;
+      stream.open_file(filename);
+      stream.set_echo(false);
+      FrameworkAircraftLoader loader;
+      loader.load(&stream);
+      std::remove(filename.c_str());
+      loader.SetMassFraction(0.2 + 0.15 * i);
+      loader.SetRandomStream(random_stream.Split(i));
+      aircraft.push_back(loader.BuildAircraft());
+   }
+   return aircraft;
+}
+
+// Steps the aircraft until all are finished and returns the states of each.
+static std::vector<std::vector<aaesim::open_source::AircraftState>> StepAircraft(unsigned int number_of_threads,
+                                                                                bool use_pilot_delay) {
+   const std::vector<std::shared_ptr<TestFrameworkAircraft>> aircraft = BuildSteppedAircraft(use_pilot_delay);
+   {
+      ParallelAircraftStepper aircraft_stepper(aircraft, number_of_threads);
+      aaesim::open_source::SimulationTime time;
+      bool all_finished = false;
+      for (int cycle = 0; !all_finished && cycle < 100000; ++cycle) {
+         const std::vector<char> &aircraft_finished = aircraft_stepper.Step(time);
+         all_finished = std::all_of(aircraft_finished.cbegin(), aircraft_finished.cend(),
+                                    [](char finished) { return finished; });
+         time.Increment();
+      }
+      EXPECT_TRUE(all_finished);
+   }
+
+   std::vector<std::vector<aaesim::open_source::AircraftState>> states;
+   std::transform(aircraft.cbegin(), aircraft.cend(), std::back_inserter(states),
+                  [](const std::shared_ptr<TestFrameworkAircraft> &a) { return a->GetAircraftStates(); });
+   return states;
+}
+
+// every value written to the _AcStates file
+static std::array<double, AircraftStateWriter::COLUMN_COUNT> StateColumns(
+      const aaesim::open_source::AircraftState &state) {
+   return AircraftStateWriter::ColumnValues(AircraftStateWriter::ExtractDataToWrite(state));
+}
+
+// Flies the stepped aircraft on one and on three threads and expects identical states.
+static void ExpectStatesDoNotDependOnThreadCount(bool use_pilot_delay) {
+   const auto sequential_states = StepAircraft(1, use_pilot_delay);
+   const auto parallel_states = StepAircraft(3, use_pilot_delay);
+
+   ASSERT_EQ(STEPPED_AIRCRAFT_COUNT, sequential_states.size());
+   ASSERT_EQ(STEPPED_AIRCRAFT_COUNT, parallel_states.size());
+   for (std::size_t i = 0; i < sequential_states.size(); ++i) {
+      ASSERT_FALSE(sequential_states[i].empty());
+      ASSERT_EQ(sequential_states[i].size(), parallel_states[i].size());
+      for (std::size_t n = 0; n < sequential_states[i].size(); ++n) {
+         EXPECT_EQ(StateColumns(sequential_states[i][n]), StateColumns(parallel_states[i][n]));
+      }
+   }
+}
+
+// Skips the calling test unless the aircraft can be flown.
+static void RequireAircraftPerformance() {
+#ifdef MITRE_BADA3_LIBRARY
+   const char *bada_data_path = std::getenv("FMACM_BADA_DATA_PATH");
+   if (bada_data_path == nullptr) {
+      GTEST_SKIP() << "set FMACM_BADA_DATA_PATH to fly the aircraft with BADA";
+   }
+   aaesim::bada::Bada3Factory::SetBadaDataPath(bada_data_path, Atmosphere::AtmosphereType::BADA37);
+#else
+   GTEST_SKIP() << "flying the aircraft needs the BADA aircraft performance library";
+#endif
+}
+
+TEST(ParallelAircraftStepper, states_do_not_depend_on_thread_count) {
+   RequireAircraftPerformance();
+   if (IsSkipped()) {
+      return;
+   }
+   ExpectStatesDoNotDependOnThreadCount(false);
+}
+
+TEST(ParallelAircraftStepper, states_with_pilot_delay_do_not_depend_on_thread_count) {
+   RequireAircraftPerformance();
+   if (IsSkipped()) {
+      return;
+   }
+   ExpectStatesDoNotDependOnThreadCount(true);
+}
+
+// Loads the Run_Files speed commands with a pilot delay of 20 +/- 5 seconds.
+static ApplicationLoader LoadDelayedSpeedCommands() {
+   const std::string filename = testing::TempDir() + "application_loader_test.txt";
+   std::ofstream file(filename);
+   file << "pilot_delay_configuration\n{\n"
+           " use_pilot_delay true\n"
+           " pilot_delay_seconds 20\n"
+           " pilot_delay_standard_deviation_seconds 5\n"
+           "}\n"
+           "im_speed_commands_from_file\n{\n"
+           " imspd_csv_file \"../Run_Files/FimAcTv-P~W_JET_Im_Spd.csv\"\n"
+           "}\n";
+   file.close();
+
+   DecodedStream stream;
+   stream.open_file(filename);
+   stream.set_echo(false);
+   ApplicationLoader loader;
+   loader.load(&stream);
+   std::remove(filename.c_str());
+   return loader;
+}
+
+// The Run_Files speed commands start at 60 seconds, so the time of the first valid guidance shows the delay.
+static Units::SecondsTime FirstCommandTime(ApplicationLoader loader, const PhiloxRandomGenerator &random_stream) {
+   loader.SetRandomStream(random_stream);
+   aaesim::open_source::WeatherPrediction weather_prediction;
+   const auto application = loader.CreateApplication(weather_prediction);
+   aaesim::open_source::SimulationTime time;
+   while (time.GetCurrentSimulationTime() < Units::SecondsTime(200) &&
+          !application->Update(time, aaesim::open_source::Guidance(), aaesim::open_source::DynamicsState(),
+                               aaesim::open_source::AircraftState())
+                 .IsValid()) {
+      time.Increment();
+   }
+   return time.GetCurrentSimulationTime();
+}
+
+TEST(ApplicationLoader, pilot_delay_depends_on_the_random_stream_alone) {
+   const ApplicationLoader loader = LoadDelayedSpeedCommands();
+   const PhiloxRandomGenerator random_stream(12345);
+   const Units::SecondsTime first_command_time = FirstCommandTime(loader, random_stream.Split(0));
+   EXPECT_GT(first_command_time, Units::SecondsTime(60));
+
+   // neither the state of the thread's shared generator nor the thread matters
+   aaesim::open_source::ScenarioUtils::RANDOM_NUMBER_GENERATOR.SetSeed(987);
+   EXPECT_EQ(first_command_time, FirstCommandTime(loader, random_stream.Split(0)));
+   Units::SecondsTime other_thread_time;
+   std::thread other_thread([&]() { other_thread_time = FirstCommandTime(loader, random_stream.Split(0)); });
+   other_thread.join();
+   EXPECT_EQ(first_command_time, other_thread_time);
+}
+
+}  // namespace test
+}  // namespace fmacm
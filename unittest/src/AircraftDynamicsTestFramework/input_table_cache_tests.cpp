@@ -0,0 +1,155 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "framework/InputTableCache.h"
+#include "framework/WeatherTruthFromStaticData.h"
+
+namespace fmacm {
+namespace test {
+
+namespace {
+void WriteFile(const std::string &file_name, const std::string &text) {
+   std::ofstream os(file_name, std::ios::trunc);
+   os << text;
+}
+
+int CountLines(const std::shared_ptr<const aaesim::open_source::CsvFile> &csv_file) {
+   int lines = 0;
+   aaesim::open_source::CsvCursor csv_row(csv_file);
+   while (csv_row.Advance()) ++lines;
+   return lines;
+}
+}  // namespace
+
+TEST(InputTableCache, parses_each_content_once) {
+   const std::string first_file = testing::TempDir() + "input_table_cache_first.csv";
+   const std::string second_file = testing::TempDir() + "input_table_cache_second.csv";
+   WriteFile(first_file, "a\n1\n2\n");
+   WriteFile(second_file, "a\n1\n2\n");
+
+   int parse_count = 0;
+   const InputTableCache::Parser<int> parse = [&parse_count](const auto &csv_file) {
+      ++parse_count;
+      return CountLines(csv_file);
+   };
+
+   InputTableCache input_tables;
+   const auto first = input_tables.Get<int>(first_file, parse);
+   ASSERT_NE(nullptr, first);
+   EXPECT_EQ(3, *first);
+   EXPECT_EQ(first, input_tables.Get<int>(first_file, parse));
+   EXPECT_EQ(first, input_tables.Get<int>(second_file, parse));  // same content, different name
+   EXPECT_EQ(1, parse_count);
+
+   WriteFile(second_file, "a\n1\n");
+   EXPECT_EQ(2, *input_tables.Get<int>(second_file, parse));
+   EXPECT_EQ(2, parse_count);
+   EXPECT_EQ(2, input_tables.GetSize());
+
+   // a different table type from the same file is a different entry
+   const InputTableCache::Parser<std::vector<int> > parse_vector = [](const auto &csv_file) {
+      return std::vector<int>(CountLines(csv_file));
+   };
+   EXPECT_EQ(3, input_tables.Get<std::vector<int> >(first_file, parse_vector)->size());
+   EXPECT_EQ(3, input_tables.GetSize());
+
+   std::remove(first_file.c_str());
+   std::remove(second_file.c_str());
+   EXPECT_EQ(nullptr, input_tables.Get<int>(first_file, parse));
+}
+
+TEST(InputTableCache, edit_with_same_size_is_parsed_again) {
+   const std::string file_name = testing::TempDir() + "input_table_cache_edit.csv";
+   WriteFile(file_name, "a\n1\n");
+
+   int parse_count = 0;
+   const InputTableCache::Parser<std::string> parse = [&parse_count](const auto &csv_file) {
+      ++parse_count;
+      return std::string(csv_file->GetText());
+   };
+
+   InputTableCache input_tables;
+   EXPECT_EQ("a\n1\n", *input_tables.Get<std::string>(file_name, parse));
+   EXPECT_EQ("a\n1\n", *input_tables.Get<std::string>(file_name, parse));
+   EXPECT_EQ(1, parse_count);
+
+   // the remembered content is keyed on the modification time, so an edit that keeps the size is still seen
+   const auto last_write_time = std::filesystem::last_write_time(file_name);
+   WriteFile(file_name, "a\n2\n");
+   std::filesystem::last_write_time(file_name, last_write_time + std::chrono::seconds(1));
+   EXPECT_EQ("a\n2\n", *input_tables.Get<std::string>(file_name, parse));
+   EXPECT_EQ(2, parse_count);
+
+   input_tables.Clear();
+   EXPECT_EQ("a\n2\n", *input_tables.Get<std::string>(file_name, parse));
+   EXPECT_EQ(3, parse_count);
+   std::remove(file_name.c_str());
+}
+
+TEST(InputTableCache, failed_parse_is_retried) {
+   const std::string file_name = testing::TempDir() + "input_table_cache_failure.csv";
+   WriteFile(file_name, "a\n");
+
+   bool fail = true;
+   const InputTableCache::Parser<int> parse = [&fail](const auto &csv_file) {
+      if (fail) throw std::runtime_error("bad table");
+      return CountLines(csv_file);
+   };
+
+   InputTableCache input_tables;
+   EXPECT_THROW(input_tables.Get<int>(file_name, parse), std::runtime_error);
+   EXPECT_EQ(0, input_tables.GetSize());
+   fail = false;
+   EXPECT_EQ(1, *input_tables.Get<int>(file_name, parse));
+   std::remove(file_name.c_str());
+}
+
+TEST(InputTableCache, shares_env_rows_between_weather_truths) {
+   const auto input_tables = std::make_shared<InputTableCache>();
+   WeatherTruthFromStaticData by_time, by_distance;
+   by_time.Initialize("resources/test_env_file.csv", Units::zero(),
+                      WeatherTruthFromStaticData::DataIndexParameter::SIMULATION_TIME, false, false, input_tables);
+   by_distance.Initialize("resources/test_env_file.csv", Units::zero(),
+                          WeatherTruthFromStaticData::DataIndexParameter::DISTANCE_TO_GO, false, false, input_tables);
+   EXPECT_EQ(1, input_tables->GetSize());
+
+   // scaling one copy leaves the shared rows, and so the other copy, unchanged
+   by_time.ScaleWind(2);
+   by_time.Update(aaesim::open_source::SimulationTime::Of(Units::SecondsTime(1.0)), Units::zero(), Units::zero());
+   by_distance.Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::MetersLength(900.0),
+                      Units::zero());
+   EXPECT_NEAR(by_time.GetTemperature().value(), 226, 1e-10);
+   EXPECT_NEAR(by_distance.GetTemperature().value(), 226, 1e-10);
+   const int row = by_distance.east_west().GetMinRow();
+   EXPECT_NEAR(Units::MetersPerSecondSpeed(by_time.east_west().GetSpeed(by_time.east_west().GetMinRow())).value(), 8,
+               1e-10);
+   EXPECT_NEAR(Units::MetersPerSecondSpeed(by_distance.east_west().GetSpeed(row)).value(), 4, 1e-10);
+}
+
+}  // namespace test
+}  // namespace fmacm
@@ -0,0 +1,189 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "framework/MonteCarloLoader.h"
+#include "framework/MonteCarloSummaryWriter.h"
+#include "framework/TestFrameworkScenario.h"
+#include "loader/DecodedStream.h"
+
+namespace fmacm {
+namespace test {
+
+static MonteCarloLoader LoadMonteCarlo(const std::string &contents) {
+   const std::string filename = "monte_carlo_loader_test.txt";
+   std::ofstream file(filename);
+   file << contents;
+   file.close();
+
+   DecodedStream stream;
+   stream.open_file(filename);
+   stream.set_echo(false);
+   MonteCarloLoader monte_carlo;
+   monte_carlo.load(&stream);
+   std::remove(filename.c_str());
+   return monte_carlo;
+}
+
+static const int SCENARIO_ITERATIONS = 3;
+
+// Flies the Run_Files aircraft through a small Monte Carlo study and returns the scenario name of its output files.
+static std::string RunMonteCarloScenario(const std::string &bada_data_path, int iteration_threads) {
+   const std::string scenario_name = testing::TempDir() + "monte_carlo_scenario_" + std::to_string(iteration_threads);
+   const std::string filename = scenario_name + ".txt";
+   std::ofstream file(filename);
+   file << "bada_data_path \"" << bada_data_path << "\"\n"
+           "aircraft\n{\n"
+           " ac_type B737\n"
+           " speed_management_type pitch\n"
+           " env_csv_file \"../Run_Files/FimAcTv-P~W_JET_ENV.csv\"\n"
+           " env_data_index time\n"
+           " fms_guidance_data_files\n {\n"
+           "  hfp_csv_file \"../Run_Files/FimAcTv-P~W_JET_HFP.csv\"\n"
+           "  vfp_csv_file \"../Run_Files/FimAcTv-P~W_JET_VFP.csv\"\n"
+           " }\n"
+           " flight_deck_application\n {\n"
+           "  im_speed_commands_from_file\n  {\n"
+           "   imspd_csv_file \"../Run_Files/FimAcTv-P~W_JET_Im_Spd.csv\"\n"
+           "  }\n"
+           " }\n"
+           "}\n"
+           "monte_carlo\n{\n"
+           " iterations "
+        << SCENARIO_ITERATIONS << "\n master_seed 12345\n iteration_threads " << iteration_threads
+        << "\n initial_mass_fraction\n {\n  mean 0.5\n  standard_deviation 0.15\n }\n"
+           " wind_scale_factor\n {\n  mean 1.0\n  standard_deviation 0.2\n }\n"
+           "}\n";
+   file.close();
+
+   DecodedStream stream;
+   stream.open_file(filename);
+   stream.set_echo(false);
+   TestFrameworkScenario scenario;
+   scenario.SetScenarioName(scenario_name);
+   scenario.load(&stream);
+   scenario.SimulateAllIterations();
+   std::remove(filename.c_str());
+   return scenario_name;
+}
+
+static std::string ReadAndRemoveFile(const std::string &filename) {
+   std::ifstream file(filename);
+   std::stringstream contents;
+   contents << file.rdbuf();
+   file.close();
+   std::remove(filename.c_str());
+   return contents.str();
+}
+
+TEST(MonteCarloLoader, iteration_streams_are_repeatable_and_distinct) {
+   const MonteCarloLoader monte_carlo = LoadMonteCarlo("iterations 1000\nmaster_seed 42\n");
+   const MonteCarloLoader same_master = LoadMonteCarlo("iterations 10\nmaster_seed 42\n");
+   const MonteCarloLoader other_master = LoadMonteCarlo("iterations 10\nmaster_seed 43\n");
+   ASSERT_EQ(monte_carlo.GetIterationCount(), 1000);
+
+   std::set<double> first_samples;
+   for (int i = 0; i < monte_carlo.GetIterationCount(); ++i) {
+      PhiloxRandomGenerator stream = monte_carlo.IterationRandomStream(i);
+      PhiloxRandomGenerator same_stream = same_master.IterationRandomStream(i);
+      const double first_sample = stream.UniformSample();
+      EXPECT_EQ(first_sample, same_stream.UniformSample());
+      first_samples.insert(first_sample);
+   }
+   EXPECT_EQ(first_samples.size(), 1000);
+   EXPECT_NE(monte_carlo.IterationRandomStream(0).UniformSample(),
+             other_master.IterationRandomStream(0).UniformSample());
+}
+
+TEST(MonteCarloLoader, samples_are_bounded) {
+   const MonteCarloLoader monte_carlo = LoadMonteCarlo(
+         "iterations 2\n"
+         "initial_mass_fraction\n{\n mean 0.9\n standard_deviation 0.2\n}\n"
+         "wind_scale_factor\n{\n mean 0.1\n standard_deviation 0.5\n}\n");
+   PhiloxRandomGenerator random_generator = monte_carlo.IterationRandomStream(0);
+   int mass_fractions_at_upper_bound = 0;
+   for (int i = 0; i < 500; ++i) {
+      const double mass_fraction = monte_carlo.SampleMassFraction(random_generator, 0.5);
+      EXPECT_GE(mass_fraction, 0);
+      EXPECT_LE(mass_fraction, 1);
+      EXPECT_GE(monte_carlo.SampleWindScaleFactor(random_generator), 0);
+      mass_fractions_at_upper_bound += mass_fraction == 1 ? 1 : 0;
+   }
+   EXPECT_GT(mass_fractions_at_upper_bound, 0);
+}
+
+TEST(MonteCarloLoader, unset_distributions_keep_configured_values) {
+   const MonteCarloLoader monte_carlo = LoadMonteCarlo("iterations 2\n");
+   PhiloxRandomGenerator random_generator = monte_carlo.IterationRandomStream(0);
+   EXPECT_EQ(monte_carlo.SampleMassFraction(random_generator, 0.3), 0.3);
+   EXPECT_EQ(monte_carlo.SampleWindScaleFactor(random_generator), 1);
+   EXPECT_FALSE(monte_carlo.HasPilotDelay());
+}
+
+TEST(MonteCarloSummaryWriter, throws_when_file_cannot_be_opened) {
+   MonteCarloSummaryWriter summary_writer;
+   summary_writer.SetScenarioName("no_such_directory/monte_carlo_summary_test");
+   summary_writer.Gather(MonteCarloSummaryWriter::AircraftSummary{});
+   EXPECT_THROW(summary_writer.Finish(), std::runtime_error);
+}
+
+TEST(TestFrameworkScenario, monte_carlo_outputs_do_not_depend_on_iteration_threads) {
+   const char *bada_data_path = std::getenv("FMACM_BADA_DATA_PATH");
+#ifdef MITRE_BADA3_LIBRARY
+   if (bada_data_path == nullptr) {
+      GTEST_SKIP() << "set FMACM_BADA_DATA_PATH to fly the scenario with BADA";
+   }
+#else
+   GTEST_SKIP() << "flying the scenario needs the BADA aircraft performance library";
+#endif
+   const std::string one_thread = RunMonteCarloScenario(bada_data_path ? bada_data_path : "./", 1);
+   const std::string three_threads = RunMonteCarloScenario(bada_data_path ? bada_data_path : "./", 3);
+
+   const std::string states = ReadAndRemoveFile(one_thread + "_AcStates.csv");
+   EXPECT_EQ(states, ReadAndRemoveFile(three_threads + "_AcStates.csv"));
+
+   // every iteration is in the one file, in iteration order
+   std::istringstream state_lines(states);
+   std::string line;
+   ASSERT_TRUE(std::getline(state_lines, line));
+   EXPECT_EQ(line.rfind("Iteration,Time[sec],", 0), 0);
+   std::vector<int> iterations;
+   while (std::getline(state_lines, line)) {
+      const int iteration = std::stoi(line);
+      if (iterations.empty() || iterations.back() != iteration) {
+         iterations.push_back(iteration);
+      }
+   }
+   EXPECT_EQ(iterations, std::vector<int>({0, 1, 2}));
+
+   const std::string summary = ReadAndRemoveFile(one_thread + "_MonteCarlo.csv");
+   EXPECT_FALSE(summary.empty());
+   EXPECT_EQ(summary, ReadAndRemoveFile(three_threads + "_MonteCarlo.csv"));
+}
+
+}  // namespace test
+}  // namespace fmacm
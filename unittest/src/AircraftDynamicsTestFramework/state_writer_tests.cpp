@@ -0,0 +1,189 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "framework/AircraftStateWriter.h"
+#include "framework/BinaryAircraftStateFormat.h"
+#include "framework/BinaryAircraftStateReader.h"
+#include "framework/BinaryAircraftStateWriter.h"
+#include "framework/StreamingAircraftStateWriter.h"
+
+namespace fmacm {
+namespace test {
+
+static std::vector<aaesim::open_source::AircraftState> BuildFlight(int aircraft_id, int number_of_states) {
+   std::vector<aaesim::open_source::AircraftState> states;
+   for (int i = 0; i < number_of_states; ++i) {
+      aaesim::open_source::AircraftState::Builder builder(aircraft_id, Units::SecondsTime(i));
+      builder.Position(Units::FeetLength(1000.0 * aircraft_id + 3.14159 * i), Units::FeetLength(-2.71828 * i))
+            ->AltitudeMsl(Units::FeetLength(35000 - 10.5 * i))
+            ->Latitude(Units::DegreesAngle(35.1234567 + 1e-5 * i))
+            ->Longitude(Units::DegreesAngle(-106.7654321 - 1e-5 * i));
+      states.push_back(builder.Build());
+   }
+   return states;
+}
+
+static std::string ReadFile(const std::string &filename) {
+   std::ifstream file(filename);
+   std::stringstream contents;
+   contents << file.rdbuf();
+   return contents.str();
+}
+
+TEST(StreamingAircraftStateWriter, matches_batch_writer) {
+   const std::vector<std::vector<aaesim::open_source::AircraftState>> flights = {BuildFlight(0, 700),
+                                                                                 BuildFlight(1, 300)};
+
+   AircraftStateWriter batch_writer;
+   batch_writer.SetScenarioName("batch_writer_test");
+   std::for_each(flights.cbegin(), flights.cend(),
+                 [&batch_writer](const auto &flight) { batch_writer.Gather(flight); });
+   batch_writer.Finish();
+
+   // rows arrive interleaved by time, as they do from a running scenario
+   StreamingAircraftStateWriter streaming_writer(flights.size(), 64);
+   streaming_writer.SetScenarioName("streaming_writer_test");
+   for (std::size_t row = 0; row < flights[0].size(); ++row) {
+      for (std::size_t aircraft = 0; aircraft < flights.size(); ++aircraft) {
+         if (row < flights[aircraft].size()) {
+            streaming_writer.Append(aircraft, flights[aircraft][row]);
+         }
+      }
+   }
+   streaming_writer.Finish();
+
+   const std::string expected = ReadFile(batch_writer.GetOutputFilename());
+   EXPECT_FALSE(expected.empty());
+   EXPECT_EQ(expected, ReadFile(streaming_writer.GetOutputFilename()));
+   EXPECT_FALSE(std::ifstream(streaming_writer.GetOutputFilename() + ".0.part").good());
+   std::remove(batch_writer.GetOutputFilename().c_str());
+   std::remove(streaming_writer.GetOutputFilename().c_str());
+}
+
+TEST(StreamingAircraftStateWriter, finishes_when_destroyed) {
+   const auto flight = BuildFlight(0, 10);
+   std::string output_filename;
+   {
+      StreamingAircraftStateWriter streaming_writer(1);
+      streaming_writer.SetScenarioName("streaming_writer_unwind_test");
+      output_filename = streaming_writer.GetOutputFilename();
+      std::for_each(flight.cbegin(), flight.cend(),
+                    [&streaming_writer](const auto &state) { streaming_writer.Append(0, state); });
+   }
+   const std::string contents = ReadFile(output_filename);
+   EXPECT_EQ(std::count(contents.cbegin(), contents.cend(), '\n'), 11);
+   std::remove(output_filename.c_str());
+}
+
+TEST(BinaryAircraftStateWriter, round_trip_is_exact) {
+   const auto flight = BuildFlight(3, 250);
+
+   auto binary_writer = AircraftStateWriter::Create(AircraftStateWriter::OutputFormatFromString("Binary"));
+   binary_writer->SetScenarioName("binary_writer_test");
+   binary_writer->Gather(flight);
+   binary_writer->Finish();
+   EXPECT_EQ(binary_writer->GetOutputFilename(), "binary_writer_test_AcStates.bin");
+
+   BinaryAircraftStateReader reader(binary_writer->GetOutputFilename());
+   EXPECT_EQ(reader.GetColumnNames(), AircraftStateWriter::GetColumnNames());
+   ASSERT_EQ(reader.GetRowCount(), flight.size());
+   for (std::size_t row = 0; row < flight.size(); ++row) {
+      const auto expected = AircraftStateWriter::ColumnValues(AircraftStateWriter::ExtractDataToWrite(flight[row]));
+      for (std::size_t column = 0; column < AircraftStateWriter::COLUMN_COUNT; ++column) {
+         // compare bit patterns; unset dynamics values are NaN
+         EXPECT_EQ(std::bit_cast<std::uint64_t>(reader.GetColumn(column)[row]),
+                   std::bit_cast<std::uint64_t>(expected[column]));
+      }
+   }
+
+   std::stringstream csv;
+   reader.WriteCsv(csv);
+   std::string header;
+   std::getline(csv, header);
+   EXPECT_EQ(header.rfind("Time[sec],V(ias)[m/s],", 0), 0);
+   std::remove(binary_writer->GetOutputFilename().c_str());
+}
+
+TEST(AircraftStateWriter, iterations_share_one_file) {
+   for (const auto output_format : {AircraftStateWriter::CSV, AircraftStateWriter::BINARY}) {
+      auto state_writer = AircraftStateWriter::Create(output_format);
+      state_writer->SetScenarioName("iteration_writer_test");
+      state_writer->Gather(BuildFlight(0, 3), 0);
+      state_writer->Gather(BuildFlight(1, 2), 0);
+      state_writer->Gather(BuildFlight(0, 4), 1);
+      state_writer->Finish();
+
+      std::stringstream csv;
+      if (output_format == AircraftStateWriter::BINARY) {
+         BinaryAircraftStateReader reader(state_writer->GetOutputFilename());
+         ASSERT_EQ(reader.GetColumnNames().size(), AircraftStateWriter::COLUMN_COUNT + 1);
+         EXPECT_EQ(reader.GetColumnNames().front(), AircraftStateWriter::ITERATION_COLUMN_NAME);
+         EXPECT_EQ(reader.GetColumn(0), std::vector<double>({0, 0, 0, 0, 0, 1, 1, 1, 1}));
+         reader.WriteCsv(csv);
+      } else {
+         csv << ReadFile(state_writer->GetOutputFilename());
+      }
+      std::remove(state_writer->GetOutputFilename().c_str());
+
+      std::string line;
+      std::getline(csv, line);
+      EXPECT_EQ(line.rfind("Iteration,Time[sec],V(ias)[m/s],", 0), 0);
+      std::vector<std::string> iterations;
+      while (std::getline(csv, line)) {
+         iterations.push_back(line.substr(0, line.find(',')));
+      }
+      EXPECT_EQ(iterations, std::vector<std::string>({"0", "0", "0", "0", "0", "1", "1", "1", "1"}));
+   }
+}
+
+TEST(BinaryAircraftStateWriter, throws_when_file_cannot_be_opened) {
+   auto binary_writer = AircraftStateWriter::Create(AircraftStateWriter::OutputFormatFromString("Binary"));
+   binary_writer->SetScenarioName("no_such_directory/binary_writer_test");
+   binary_writer->Gather(BuildFlight(3, 10));
+   EXPECT_THROW(binary_writer->Finish(), std::runtime_error);
+}
+
+TEST(BinaryAircraftStateReader, rejects_row_count_larger_than_file) {
+   auto binary_writer = AircraftStateWriter::Create(AircraftStateWriter::OutputFormatFromString("Binary"));
+   binary_writer->SetScenarioName("binary_reader_corrupt_test");
+   binary_writer->Gather(BuildFlight(3, 10));
+   binary_writer->Finish();
+
+   // a row count chosen so that data_offset + C * R * 8 wraps around to a small number
+   std::string contents = ReadFile(binary_writer->GetOutputFilename());
+   const std::uint64_t corrupt_row_count = std::uint64_t{1} << 61;
+   binary_aircraft_state_format::EncodeLittleEndian(corrupt_row_count, &contents[16]);
+   std::ofstream(binary_writer->GetOutputFilename(), std::ios::binary | std::ios::trunc) << contents;
+
+   EXPECT_THROW(BinaryAircraftStateReader reader(binary_writer->GetOutputFilename()), std::runtime_error);
+   std::remove(binary_writer->GetOutputFilename().c_str());
+}
+
+TEST(BinaryAircraftStateWriter, rejects_unknown_format) {
+   EXPECT_THROW(AircraftStateWriter::OutputFormatFromString("parquet"), std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace fmacm
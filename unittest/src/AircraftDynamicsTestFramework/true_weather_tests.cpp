@@ -55,6 +55,54 @@ TEST(WeatherTruthFromStaticData, updated_interpolate_using_dtg) {
    EXPECT_NEAR(actual_temp.value(), expected_temp.value(), 1e-10);
 }
 
+TEST(WeatherTruthFromStaticData, interpolates_between_rows) {
+   WeatherTruthFromStaticData test_weather = WeatherTruthFromStaticData();
+   test_weather.Initialize("resources/test_env_file.csv", Units::zero(),
+                           WeatherTruthFromStaticData::DataIndexParameter::DISTANCE_TO_GO, true);
+   test_weather.Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::MetersLength(850.0),
+                       Units::zero());
+   EXPECT_NEAR(test_weather.GetTemperature().value(), 226.5, 1e-10);
+
+   test_weather.Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::MetersLength(675.0),
+                       Units::zero());
+   EXPECT_NEAR(test_weather.GetTemperature().value(), 228.5, 1e-10);
+
+   // queries outside the table use the nearest row
+   test_weather.Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::MetersLength(100.0),
+                       Units::zero());
+   EXPECT_NEAR(test_weather.GetTemperature().value(), 230, 1e-10);
+}
+
+TEST(WeatherTruthFromStaticData, dtg_lookup_follows_decreasing_distance) {
+   WeatherTruthFromStaticData test_weather = WeatherTruthFromStaticData();
+   test_weather.Initialize("resources/test_env_file.csv", Units::zero(),
+                           WeatherTruthFromStaticData::DataIndexParameter::DISTANCE_TO_GO);
+   const std::vector<std::pair<double, double> > dtg_and_expected_temperature = {
+         {2000, 225}, {1000, 225}, {950, 225}, {900, 226}, {675, 228}, {650, 229}, {620, 229}, {0, 230}};
+   for (const auto &[dtg, expected_temperature] : dtg_and_expected_temperature) {
+      test_weather.Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::MetersLength(dtg),
+                          Units::zero());
+      EXPECT_NEAR(test_weather.GetTemperature().value(), expected_temperature, 1e-10) << "dtg " << dtg;
+   }
+
+   // the cursor must also recover from a query that moves against the expected direction
+   test_weather.Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::MetersLength(850),
+                       Units::zero());
+   EXPECT_NEAR(test_weather.GetTemperature().value(), 226, 1e-10);
+}
+
+TEST(WeatherTruthFromStaticData, scales_wind) {
+   WeatherTruthFromStaticData test_weather = WeatherTruthFromStaticData();
+   test_weather.Initialize("resources/test_env_file.csv", Units::zero(),
+                           WeatherTruthFromStaticData::DataIndexParameter::SIMULATION_TIME);
+   test_weather.ScaleWind(1.5);
+   test_weather.Update(aaesim::open_source::SimulationTime::Of(Units::SecondsTime(1.0)), Units::zero(), Units::zero());
+   const int row = test_weather.east_west().GetMinRow();
+   EXPECT_NEAR(Units::MetersPerSecondSpeed(test_weather.east_west().GetSpeed(row)).value(), 6, 1e-10);
+   EXPECT_NEAR(Units::MetersPerSecondSpeed(test_weather.north_south().GetSpeed(row)).value(), -6, 1e-10);
+   EXPECT_NEAR(test_weather.GetTemperature().value(), 226, 1e-10);
+}
+
 TEST(WeatherTruthFromStaticData, create_zero) {
    WeatherTruthFromStaticData test_weather = WeatherTruthFromStaticData::CreateZeroTruthWind();
    test_weather.Update(aaesim::open_source::SimulationTime::Of(Units::ZERO_TIME), Units::zero(), Units::zero());
@@ -80,6 +80,47 @@ TEST(LocalTangentPlane, ecef2enu_forward_backward) {
                ECEF_POSITION_TEST_TOLERANCE.value());
 }
 
+TEST(LocalTangentPlane, batch_conversions_match_single_position_conversions) {
+   auto waypoint_list = std::list{tangency_position_as_waypoint};
+   const auto converter = std::make_unique<TangentPlaneSequence>(waypoint_list);
+   const auto &tangent_plane = converter->GetTangentPlanesFromInitialization().front();
+
+   std::vector<double> latitudes, longitudes;
+   for (double lat = -89.5; lat < 90; lat += 7.25) {
+      for (double lon = -179.5; lon < 180; lon += 11.5) {
+         latitudes.push_back(Units::RadiansAngle(Units::DegreesAngle(lat)).value());
+         longitudes.push_back(Units::RadiansAngle(Units::DegreesAngle(lon)).value());
+      }
+   }
+   const auto count = latitudes.size();
+   std::vector<double> east(count), north(count), up(count), batch_latitudes(count), batch_longitudes(count);
+   tangent_plane->ConvertGeodeticToLocal(EarthModel::GeodeticArrays<const double>{latitudes, longitudes},
+                                         EarthModel::CartesianArrays<double>{east, north, up});
+   tangent_plane->ConvertLocalToGeodetic(EarthModel::CartesianArrays<const double>{east, north, up},
+                                         EarthModel::GeodeticArrays<double>{batch_latitudes, batch_longitudes});
+
+   for (auto i = 0; i < count; ++i) {
+      const auto geodetic_position = EarthModel::GeodeticPosition::Of(Units::SignedRadiansAngle(latitudes[i]),
+                                                                      Units::SignedRadiansAngle(longitudes[i]));
+      EarthModel::LocalPositionEnu enu;
+      tangent_plane->ConvertGeodeticToLocal(geodetic_position, enu);
+      EXPECT_NEAR(Units::MetersLength(enu.x).value(), east[i], 1e-6);
+      EXPECT_NEAR(Units::MetersLength(enu.y).value(), north[i], 1e-6);
+      EXPECT_NEAR(Units::MetersLength(enu.z).value(), up[i], 1e-6);
+
+      EarthModel::GeodeticPosition round_trip;
+      tangent_plane->ConvertLocalToGeodetic(enu, round_trip);
+      EXPECT_NEAR(Units::RadiansAngle(round_trip.latitude).value(), batch_latitudes[i],
+                  EllipsoidalEarthModel::BATCH_LATITUDE_TOLERANCE_RADIANS);
+      EXPECT_NEAR(Units::RadiansAngle(round_trip.longitude).value(), batch_longitudes[i], 1e-15);
+   }
+
+   std::vector<double> too_short(count - 1);
+   EXPECT_THROW(tangent_plane->ConvertLocalToGeodetic(EarthModel::CartesianArrays<const double>{east, north, up},
+                                                      EarthModel::GeodeticArrays<double>{too_short, batch_longitudes}),
+                std::logic_error);
+}
+
 TEST(LocalTangentPlane, lla2enu_forward_reverse) {
    auto waypoint_list = std::list{tangency_position_as_waypoint};
    const auto earth_model = std::make_unique<EllipsoidalEarthModel>();
@@ -0,0 +1,190 @@
+// ****************************************************************************
+// NOTICE
+//
+// This work was produced for the U.S. Government under Contract 693KA8-22-C-00001
+// and is subject to Federal Aviation Administration Acquisition Management System
+// Clause 3.5-13, Rights In Data-General, Alt. III and Alt. IV (Oct. 1996).
+//
+// The contents of this document reflect the views of the author and The MITRE
+// Corporation and do not necessarily reflect the views of the Federal Aviation
+// Administration (FAA) or the Department of Transportation (DOT). Neither the FAA
+// nor the DOT makes any warranty or guarantee, expressed or implied, concerning
+// the content or accuracy of these views.
+//
+// For further information, please contact The MITRE Corporation, Contracts Management
+// Office, 7515 Colshire Drive, McLean, VA 22102-7539, (703) 983-6000.
+//
+// 2023 The MITRE Corporation. All Rights Reserved.
+// ****************************************************************************
+
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "loader/DecodedStream.h"
+#include "loader/ParsedScenarioCache.h"
+#include "loader/RunFileArchiveDirector.h"
+
+namespace {
+class ParsedScenarioCacheTest : public ::testing::Test {
+  protected:
+   void SetUp() override {
+      directory = std::filesystem::temp_directory_path() /
+                  ("fmacm_parse_cache_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+      std::filesystem::remove_all(directory);
+      std::filesystem::create_directories(directory);
+      scenario_file = (directory / "scenario.txt").string();
+      included_file = (directory / "included.txt").string();
+      cache_file = ParsedScenarioCache::CacheFileName((directory / "cache").string(), scenario_file);
+      WriteFile(scenario_file, "; a comment\nname first\n#include " + included_file + "\nvalue 12\n");
+      WriteFile(included_file, "speed 250 ; knots\naltitude 10000\n");
+   }
+
+   void TearDown() override { std::filesystem::remove_all(directory); }
+
+   static void WriteFile(const std::string &file_name, const std::string &text) {
+      std::ofstream os(file_name, std::ios::trunc);
+      os << text;
+   }
+
+   // reads every token of the scenario, through the cache when use_cache is set
+   std::vector<std::string> ReadTokens(bool use_cache, bool *cache_used = nullptr) const {
+      DecodedStream stream;
+      EXPECT_TRUE(stream.open_file(scenario_file));
+      stream.set_echo(false);
+      stream.set_Local_Path(directory.string());
+      stream.set_Archive_Director(std::make_shared<RunFileArchiveDirector>());
+      if (use_cache) {
+         const bool used = stream.use_parse_cache(cache_file);
+         if (cache_used) *cache_used = used;
+      }
+      std::vector<std::string> tokens;
+      std::string token;
+      while (stream.get_datum(token)) {
+         tokens.push_back(token);
+      }
+      return tokens;
+   }
+
+   std::filesystem::path directory;
+   std::string scenario_file;
+   std::string included_file;
+   std::string cache_file;
+};
+}  // namespace
+
+TEST_F(ParsedScenarioCacheTest, replays_resolved_tokens) {
+   const std::vector<std::string> expected = {"name", "first", "speed", "250", "altitude", "10000", "value", "12"};
+   EXPECT_EQ(expected, ReadTokens(false));
+
+   bool cache_used = true;
+   EXPECT_EQ(expected, ReadTokens(true, &cache_used));
+   EXPECT_FALSE(cache_used);
+   EXPECT_TRUE(std::filesystem::exists(cache_file));
+
+   EXPECT_EQ(expected, ReadTokens(true, &cache_used));
+   EXPECT_TRUE(cache_used);
+}
+
+TEST_F(ParsedScenarioCacheTest, push_back_while_replaying) {
+   ReadTokens(true);
+   DecodedStream stream;
+   ASSERT_TRUE(stream.open_file(scenario_file));
+   stream.set_echo(false);
+   stream.set_Local_Path(directory.string());
+   stream.set_Archive_Director(std::make_shared<RunFileArchiveDirector>());
+   ASSERT_TRUE(stream.use_parse_cache(cache_file));
+
+   int name_length = 0;
+   std::string token;
+   EXPECT_TRUE(stream.get_datum(token));
+   EXPECT_FALSE(stream.get_datum(name_length));  // "first" is not a number
+   stream.push_back();
+   EXPECT_TRUE(stream.get_datum(token));
+   EXPECT_EQ("first", token);
+}
+
+TEST_F(ParsedScenarioCacheTest, changed_include_invalidates_cache) {
+   ReadTokens(true);
+   WriteFile(included_file, "speed 280\n");
+
+   bool cache_used = true;
+   const std::vector<std::string> expected = {"name", "first", "speed", "280", "value", "12"};
+   EXPECT_EQ(expected, ReadTokens(true, &cache_used));
+   EXPECT_FALSE(cache_used);
+
+   EXPECT_EQ(expected, ReadTokens(true, &cache_used));
+   EXPECT_TRUE(cache_used);
+}
+
+TEST_F(ParsedScenarioCacheTest, concurrent_writers_leave_one_readable_entry) {
+   std::vector<std::thread> writers;
+   for (int i = 0; i < 8; ++i) {
+      writers.emplace_back([this]() { ReadTokens(true); });
+   }
+   for (auto &writer : writers) {
+      writer.join();
+   }
+
+   const auto cache_directory = std::filesystem::path(cache_file).parent_path();
+   std::vector<std::filesystem::path> cache_directory_entries;
+   for (const auto &entry : std::filesystem::directory_iterator(cache_directory)) {
+      cache_directory_entries.push_back(entry.path());
+   }
+   ASSERT_EQ(cache_directory_entries.size(), 1);
+   EXPECT_EQ(cache_directory_entries.front(), std::filesystem::path(cache_file));
+
+   bool cache_used = false;
+   const std::vector<std::string> expected = {"name", "first", "speed", "250", "altitude", "10000", "value", "12"};
+   EXPECT_EQ(expected, ReadTokens(true, &cache_used));
+   EXPECT_TRUE(cache_used);
+}
+
+TEST_F(ParsedScenarioCacheTest, concurrent_processes_leave_one_readable_entry) {
+   // every child's writing thread has the same id as its siblings', so only the process id keeps temporaries apart
+   constexpr int CHILD_COUNT = 8;
+   constexpr int WRITES_PER_CHILD = 50;
+   std::vector<pid_t> children;
+   for (int i = 0; i < CHILD_COUNT; ++i) {
+      const pid_t child = fork();
+      ASSERT_NE(child, -1);
+      if (child == 0) {
+         ParsedScenarioCache::Contents contents;
+         contents.tokens.assign(1000 * (i + 1), "child" + std::to_string(i));
+         bool all_written = true;
+         for (int write = 0; write < WRITES_PER_CHILD; ++write) {
+            all_written = ParsedScenarioCache::Write(cache_file, contents) && all_written;
+         }
+         _exit(all_written ? 0 : 1);
+      }
+      children.push_back(child);
+   }
+   for (const pid_t child : children) {
+      int status = 0;
+      ASSERT_EQ(waitpid(child, &status, 0), child);
+      EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+   }
+
+   const auto cache_directory = std::filesystem::path(cache_file).parent_path();
+   std::vector<std::filesystem::path> cache_directory_entries;
+   for (const auto &entry : std::filesystem::directory_iterator(cache_directory)) {
+      cache_directory_entries.push_back(entry.path());
+   }
+   ASSERT_EQ(cache_directory_entries.size(), 1);
+   EXPECT_EQ(cache_directory_entries.front(), std::filesystem::path(cache_file));
+
+   // the surviving entry is exactly what one of the children wrote
+   ParsedScenarioCache::Contents contents;
+   ASSERT_TRUE(ParsedScenarioCache::Read(cache_file, contents));
+   ASSERT_FALSE(contents.tokens.empty());
+   const std::string &writer = contents.tokens.front();
+   EXPECT_EQ(contents.tokens.size(), 1000 * (std::stoi(writer.substr(5)) + 1));
+   EXPECT_EQ(std::count(contents.tokens.cbegin(), contents.tokens.cend(), writer), contents.tokens.size());
+}
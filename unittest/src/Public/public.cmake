@@ -13,6 +13,7 @@ set(PUBLIC_LIBRARY_TEST_SOURCE
         ${UNITTEST_DIR}/src/Public/tangent_plane_tests.cpp
         ${UNITTEST_DIR}/src/Public/wind_blending_tests.cpp
         ${UNITTEST_DIR}/src/Public/earth_model_tests.cpp
+        ${UNITTEST_DIR}/src/Public/loader_tests.cpp
 )
 
 add_executable(public_test 
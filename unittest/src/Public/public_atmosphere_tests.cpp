@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 
+#include "public/TabulatedAtmosphere.h"
 #include "public/USStandardAtmosphere1976.h"
 
 using namespace std;
@@ -109,5 +110,42 @@ TEST(USStandardAtmosphere1976, mach_ias_transition_isa) {
    }
 }
 
+TEST(TabulatedAtmosphere, matches_analytic_model) {
+   const USStandardAtmosphere1976 analytic;
+   const TabulatedAtmosphere tabulated(std::make_unique<USStandardAtmosphere1976>());
+   const std::unique_ptr<Atmosphere> cloned(tabulated.Clone());
+
+   const double relative_tolerance = 1e-6;
+   // deliberately not a multiple of the table step, and crossing the tropopause
+   for (double altitude_meters = -1000; altitude_meters <= 25000; altitude_meters += 1.37) {
+      const Units::MetersLength altitude(altitude_meters);
+      Units::KilogramsMeterDensity expected_rho, actual_rho, cloned_rho;
+      Units::PascalsPressure expected_p, actual_p, cloned_p;
+      analytic.AirDensity(altitude, expected_rho, expected_p);
+      tabulated.AirDensity(altitude, actual_rho, actual_p);
+      cloned->AirDensity(altitude, cloned_rho, cloned_p);
+
+      EXPECT_NEAR(analytic.GetTemperature(altitude).value(), tabulated.GetTemperature(altitude).value(), 1e-9);
+      EXPECT_NEAR(1.0, actual_rho / expected_rho, relative_tolerance) << altitude_meters;
+      EXPECT_NEAR(1.0, actual_p / expected_p, relative_tolerance) << altitude_meters;
+      EXPECT_EQ(actual_rho.value(), cloned_rho.value());
+      EXPECT_EQ(actual_p.value(), cloned_p.value());
+
+      const Units::KnotsSpeed expected_tas = analytic.Atmosphere::CAS2TAS(Units::KnotsSpeed(250), altitude);
+      const Units::KnotsSpeed actual_tas = tabulated.CAS2TAS(Units::KnotsSpeed(250), altitude);
+      EXPECT_NEAR(expected_tas.value(), actual_tas.value(), 1e-3);
+   }
+
+   // samples fall exactly on the tropopause, and queries beyond the table use the analytic model
+   for (const double altitude_meters : {11000.0, 22000.0}) {
+      Units::KilogramsMeterDensity expected_rho, actual_rho;
+      Units::PascalsPressure expected_p, actual_p;
+      analytic.AirDensity(Units::MetersLength(altitude_meters), expected_rho, expected_p);
+      tabulated.AirDensity(Units::MetersLength(altitude_meters), actual_rho, actual_p);
+      EXPECT_DOUBLE_EQ(expected_rho.value(), actual_rho.value());
+      EXPECT_DOUBLE_EQ(expected_p.value(), actual_p.value());
+   }
+}
+
 }  // namespace test
 }  // namespace aaesim
@@ -18,24 +18,43 @@
 // ****************************************************************************
 
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 #include "public/CustomMath.h"
 #include "public/AircraftCalculations.h"
 #include "public/AircraftIntent.h"
 #include "public/AlongPathDistanceCalculator.h"
 #include "public/CoreUtils.h"
+#include "public/CsvFile.h"
+#include "public/DeferredGeodeticPosition.h"
 #include "public/DirectionOfFlightCourseCalculator.h"
+#include "public/DynamicsStateHistory.h"
+#include "public/EquationsOfMotionKernel.h"
+#include "public/ExtendedHorizontalPath.h"
 #include "public/FlightEnvelopeSpeedLimiter.h"
 #include "public/Guidance.h"
 #include "public/HorizontalPathTracker.h"
 #include "public/VectorDifferenceWindEvaluator.h"
+#include "public/PhiloxRandomGenerator.h"
 #include "public/PositionCalculator.h"
+#include "public/ProfileInterpolator.h"
+#include "public/RungeKuttaIntegrator.h"
 #include "public/ScenarioUtils.h"
 #include "public/SimulationTime.h"
+#include "public/TvReader.h"
+#include "public/USStandardAtmosphere1976.h"
+#include "public/VerticalPath.h"
 #include "public/WindZero.h"
 #include "public/Wgs84PrecalcWaypoint.h"
 #include "public/EuclideanWaypointMonitor.h"
 #include "public/InvalidIndexException.h"
+#include "public/KinematicDescent4DPredictor.h"
+#include "public/Mat3.h"
 #include "utility/CustomUnits.h"
 #include "utils/public/OldCustomMathUtils.h"
 #include "utils/public/PublicUtils.h"
@@ -163,6 +182,76 @@ TEST(CoreUtils, IM_Index) {
    EXPECT_DOUBLE_EQ(returned_index, 4);
 }
 
+TEST(ProfileInterpolator, matches_core_utils_while_descending) {
+   std::vector<double> distance, altitude, speed;
+   for (int i = 0; i < 200; ++i) {
+      distance.push_back(i * 97.0 + (i % 3) * 11.0);
+      altitude.push_back(i * 30.5 + 100.0);
+      speed.push_back(120.0 + (i % 7) * 1.25);
+   }
+
+   ProfileInterpolator interpolator;
+   for (double x = distance.back(); x > -50.0; x -= 43.7) {
+      const auto [actual_altitude, actual_speed] = interpolator.Interpolate(x, distance, altitude, speed);
+      const int upper_index = CoreUtils::FindNearestIndex(x, distance);
+      ASSERT_EQ(std::min(upper_index, static_cast<int>(distance.size()) - 1), interpolator.GetUpperIndex());
+      if (upper_index == 0) {
+         EXPECT_EQ(altitude.front(), actual_altitude);
+         EXPECT_EQ(speed.front(), actual_speed);
+      } else if (upper_index < distance.size()) {
+         EXPECT_EQ(CoreUtils::LinearlyInterpolate(upper_index, x, distance, altitude), actual_altitude);
+         EXPECT_EQ(CoreUtils::LinearlyInterpolate(upper_index, x, distance, speed), actual_speed);
+      }
+   }
+}
+
+TEST(ProfileInterpolator, finds_bracket_after_jumps) {
+   const std::vector<double> distance{0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0, 110.0};
+   const std::vector<double> altitude{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0};
+
+   ProfileInterpolator interpolator;
+   for (const double x : {105.0, 5.0, 95.0, 55.0, 55.0, 120.0, -1.0, 10.0}) {
+      const auto [actual_altitude] = interpolator.Interpolate(x, distance, altitude);
+      EXPECT_DOUBLE_EQ(x < 0.0 ? 0.0 : x / 10.0, actual_altitude) << "x = " << x;
+      EXPECT_EQ(std::min(CoreUtils::FindNearestIndex(x, distance), 11), interpolator.GetUpperIndex());
+   }
+
+   // a shorter profile replaces the one the cursor was left on
+   const std::vector<double> short_distance{0.0, 10.0};
+   const std::vector<double> short_altitude{5.0, 6.0};
+   const auto [actual_altitude] = interpolator.Interpolate(5.0, short_distance, short_altitude);
+   EXPECT_DOUBLE_EQ(5.5, actual_altitude);
+}
+
+TEST(ProfileInterpolator, returns_last_row_at_last_x) {
+   const std::vector<double> distance{0.0, 10.0, 20.0};
+   const std::vector<double> altitude{100.0, 200.0, 400.0};
+
+   // CoreUtils has no bracket for exactly the last x
+   EXPECT_EQ(3, CoreUtils::FindNearestIndex(distance.back(), distance));
+   EXPECT_THROW(CoreUtils::LinearlyInterpolate(3, distance.back(), distance, altitude), std::out_of_range);
+
+   ProfileInterpolator interpolator;
+   const auto [actual_altitude] = interpolator.Interpolate(distance.back(), distance, altitude);
+   EXPECT_EQ(2, interpolator.GetUpperIndex());
+   EXPECT_EQ(altitude.back(), actual_altitude);
+
+   // and from a cursor left lower in the profile
+   interpolator.Interpolate(5.0, distance, altitude);
+   const auto [altitude_after_jump] = interpolator.Interpolate(distance.back(), distance, altitude);
+   EXPECT_EQ(2, interpolator.GetUpperIndex());
+   EXPECT_EQ(altitude.back(), altitude_after_jump);
+}
+
+TEST(CoreUtils, interpolate_speed) {
+   const std::vector<double> x_vals{0.0, 10.0, 20.0};
+   const std::vector<Units::Speed> y_vals{Units::MetersPerSecondSpeed(100.0), Units::MetersPerSecondSpeed(110.0),
+                                          Units::MetersPerSecondSpeed(130.0)};
+   const Units::MetersPerSecondSpeed actual(
+         CoreUtils::LinearlyInterpolate(2, Units::MetersLength(15.0), x_vals, y_vals));
+   EXPECT_DOUBLE_EQ(120.0, actual.value());
+}
+
 TEST(CoreUtils, calculateEuclideanDistance) {
    // Calculate from a 3-4-5 triangle
    const Units::FeetLength expected = Units::FeetLength(5.0);
@@ -265,6 +354,22 @@ TEST(SimulationTime, basicTests) {
    SimulationTime::SetSimulationTimeStep(Units::SecondsTime(1.0));  // be kind & reset for future tests
 }
 
+TEST(SimulationTime, time_step_is_per_thread) {
+   // concurrently running scenarios must not see each other's time step
+   SimulationTime::SetSimulationTimeStep(Units::SecondsTime(0.5));
+
+   double other_thread_step = 0;
+   std::thread other_thread([&other_thread_step]() {
+      other_thread_step = SimulationTime::GetSimulationTimeStep().value();
+      SimulationTime::SetSimulationTimeStep(Units::SecondsTime(0.2));
+   });
+   other_thread.join();
+
+   EXPECT_DOUBLE_EQ(other_thread_step, SimulationTime::SIMULATION_TIME_STEP.value());
+   EXPECT_DOUBLE_EQ(SimulationTime::GetSimulationTimeStep().value(), 0.5);
+   SimulationTime::SetSimulationTimeStep(Units::SecondsTime(1.0));  // be kind & reset for future tests
+}
+
 TEST(HorizontalPathTracker, consistency_check_straight_line_reverse) {
    /*
     * Test the behavior of HorizontalPathTracker. The point
@@ -530,6 +635,250 @@ TEST(CustomMath, quantize) {
    EXPECT_DOUBLE_EQ(result, 20);
 }
 
+TEST(RungeKuttaIntegrator, exponential_decay) {
+   // y' = -y over one step of h = 1; the exact solution is exp(-1)
+   typedef RungeKuttaIntegrator<1> Integrator;
+   const auto decay = [](const Integrator::Vector &y) { return Integrator::Vector{-y[0]}; };
+   const Integrator::Tolerance tolerance{{1e-10}, 1e-10};
+   const Integrator::Vector y0{1.0};
+   const double expected = std::exp(-1.0);
+
+   const double euler = y0[0] + Integrator::Slope(IntegrationMethod::FORWARD_EULER, y0, 1.0, decay, tolerance)[0];
+   const double rk4 = y0[0] + Integrator::Slope(IntegrationMethod::RUNGE_KUTTA_4, y0, 1.0, decay, tolerance)[0];
+   const double dopri = y0[0] + Integrator::Slope(IntegrationMethod::DORMAND_PRINCE, y0, 1.0, decay, tolerance)[0];
+
+   EXPECT_DOUBLE_EQ(euler, 0.0);
+   EXPECT_DOUBLE_EQ(rk4, 0.375);
+   EXPECT_NEAR(dopri, expected, 1e-8);
+}
+
+TEST(RungeKuttaIntegrator, adaptive_step_follows_oscillation) {
+   // y'' = -y over a full period, written as a first-order system
+   typedef RungeKuttaIntegrator<2> Integrator;
+   const auto oscillator = [](const Integrator::Vector &y) { return Integrator::Vector{y[1], -y[0]}; };
+   const Integrator::Tolerance tolerance{{1e-9, 1e-9}, 1e-9};
+   const Integrator::Vector y0{1.0, 0.0};
+   const double period = 2 * M_PI;
+
+   const auto slope = Integrator::Slope(IntegrationMethod::DORMAND_PRINCE, y0, period, oscillator, tolerance);
+   EXPECT_NEAR(y0[0] + period * slope[0], 1.0, 1e-7);
+   EXPECT_NEAR(y0[1] + period * slope[1], 0.0, 1e-7);
+}
+
+TEST(RungeKuttaIntegrator, method_from_string) {
+   EXPECT_EQ(IntegrationMethodFromString(""), IntegrationMethod::FORWARD_EULER);
+   EXPECT_EQ(IntegrationMethodFromString("Euler"), IntegrationMethod::FORWARD_EULER);
+   EXPECT_EQ(IntegrationMethodFromString("RK4"), IntegrationMethod::RUNGE_KUTTA_4);
+   EXPECT_EQ(IntegrationMethodFromString("dormand_prince"), IntegrationMethod::DORMAND_PRINCE);
+   EXPECT_THROW(IntegrationMethodFromString("midpoint"), std::runtime_error);
+}
+
+TEST(DynamicsStateHistory, ring_keeps_latest_states_in_order) {
+   DynamicsStateHistory history;
+   history.SetPolicy(DynamicsStateHistory::Policy::RING, 3);
+   for (int cycle = 0; cycle < 20; ++cycle) {
+      SimulationTime time;
+      time.SetCycle(cycle);
+      DynamicsState state{};
+      state.id = cycle;
+      history.Record(time, state);
+
+      const auto retained = history.GetRetainedStates();
+      ASSERT_EQ(retained.size(), std::min(cycle + 1, 3));
+      for (std::size_t i = 0; i < retained.size(); ++i) {
+         EXPECT_EQ(retained[i].state.id, cycle - static_cast<int>(retained.size() - 1 - i));
+         EXPECT_EQ(retained[i].time.GetCycle(), retained[i].state.id);
+      }
+      EXPECT_EQ(history.GetLatestState().id, cycle);
+   }
+}
+
+TEST(DynamicsStateHistory, none_keeps_only_latest) {
+   DynamicsStateHistory history;
+   history.SetPolicy(DynamicsStateHistory::Policy::NONE);
+   EXPECT_TRUE(history.IsEmpty());
+
+   SimulationTime time;
+   for (int cycle = 0; cycle < 5; ++cycle) {
+      time.SetCycle(cycle);
+      DynamicsState state{};
+      state.id = cycle;
+      history.Record(time, state);
+   }
+   EXPECT_TRUE(history.GetRetainedStates().empty());
+   EXPECT_EQ(history.GetLatestState().id, 4);
+
+   // a repeated time does not replace the recorded state
+   DynamicsState repeated{};
+   repeated.id = -1;
+   history.Record(time, repeated);
+   EXPECT_EQ(history.GetLatestState().id, 4);
+}
+
+TEST(DynamicsStateHistory, policy_from_string) {
+   EXPECT_EQ(DynamicsStateHistory::PolicyFromString("NONE"), DynamicsStateHistory::Policy::NONE);
+   EXPECT_EQ(DynamicsStateHistory::PolicyFromString("ring"), DynamicsStateHistory::Policy::RING);
+   EXPECT_EQ(DynamicsStateHistory::PolicyFromString("full"), DynamicsStateHistory::Policy::FULL);
+   EXPECT_THROW(DynamicsStateHistory::PolicyFromString("map"), std::runtime_error);
+   EXPECT_THROW(DynamicsStateHistory().SetPolicy(DynamicsStateHistory::Policy::RING, 0), std::runtime_error);
+}
+
+TEST(EquationsOfMotionKernel, matches_units_equations) {
+   // Reference: the Units-typed equations of motion previously evaluated by ThreeDOFDynamics
+   typedef EquationsOfMotionKernel Kernel;
+   const Kernel::AircraftConstants aircraft{65000.0, 122.6};
+   Kernel::StepInputs inputs{};
+   inputs.density_kg_m3 = 0.58;
+   inputs.wind_east_mps = 12.5;
+   inputs.wind_north_mps = -7.25;
+   inputs.wind_gradient_east_hz = 2.1e-3;
+   inputs.wind_gradient_north_hz = -1.4e-3;
+   inputs.cd0 = 0.0242;
+   inputs.cd2 = 0.0469;
+   inputs.gear_drag = 0.0;
+   inputs.k_flight_path_angle_hz = 0.25;
+   inputs.k_thrust_hz = 0.4;
+   inputs.k_roll_hz = 0.5;
+   inputs.k_speed_brake = 0.1;
+   inputs.flight_path_angle_command_rad = 0.05;
+   inputs.thrust_command_newtons = 30000.0;
+   inputs.roll_angle_command_rad = -0.3;
+   inputs.speed_brake_command = 0.5;
+
+   const Units::Mass ac_mass = Units::KilogramsMass(aircraft.mass_kg);
+   const Units::Area wing_area = Units::MetersArea(aircraft.wing_area_m2);
+   const Units::Density rho = Units::KilogramsMeterDensity(inputs.density_kg_m3);
+   const Units::Speed wind_east = Units::MetersPerSecondSpeed(inputs.wind_east_mps);
+   const Units::Speed wind_north = Units::MetersPerSecondSpeed(inputs.wind_north_mps);
+   const Units::Frequency dVwx_dh = Units::HertzFrequency(inputs.wind_gradient_east_hz);
+   const Units::Frequency dVwy_dh = Units::HertzFrequency(inputs.wind_gradient_north_hz);
+   const Units::Frequency k_gamma = Units::HertzFrequency(inputs.k_flight_path_angle_hz);
+   const Units::Frequency k_t = Units::HertzFrequency(inputs.k_thrust_hz);
+   const Units::Frequency k_phi = Units::HertzFrequency(inputs.k_roll_hz);
+   const Units::Angle gamma_command = Units::RadiansAngle(inputs.flight_path_angle_command_rad);
+   const Units::Force thrust_command = Units::NewtonsForce(inputs.thrust_command_newtons);
+   const Units::Angle roll_command = Units::RadiansAngle(inputs.roll_angle_command_rad);
+
+   const std::vector<Kernel::State> states{
+         {1000.0, -2000.0, 10000.0, 230.0, 0.0, 0.3, 40000.0, 0.0, 0.0},
+         {-5000.0, 300.0, 6000.0, 180.0, 0.052, -2.1, 15000.0, 0.2, 0.0},
+         {0.0, 0.0, 3000.0, 140.0, -0.035, 3.0, 8000.0, -0.45, 0.35},
+   };
+   for (const Kernel::State &state : states) {
+      const Units::Speed true_airspeed = Units::MetersPerSecondSpeed(state[Kernel::TRUE_AIRSPEED]);
+      const Units::Angle gamma = Units::RadiansAngle(state[Kernel::GAMMA]);
+      const Units::Angle psi = Units::RadiansAngle(state[Kernel::PSI]);
+      const Units::Force thrust = Units::NewtonsForce(state[Kernel::THRUST]);
+      const Units::Angle phi = Units::RadiansAngle(state[Kernel::PHI]);
+      const double speed_brake = state[Kernel::SPEED_BRAKE];
+
+      const double cL =
+            (2. * ac_mass * Units::ONE_G_ACCELERATION) / (rho * Units::sqr(true_airspeed) * wing_area * cos(phi));
+      double cD = inputs.cd0 + inputs.gear_drag + inputs.cd2 * pow(cL, 2);
+      if (speed_brake != 0.0) {
+         cD = (1.0 + 0.6 * speed_brake) * cD;
+      }
+      const Units::Force drag = 1. / 2. * rho * cD * Units::sqr(true_airspeed) * wing_area;
+      const Units::Force lift = 1. / 2. * rho * cL * Units::sqr(true_airspeed) * wing_area;
+
+      const Kernel::State expected{
+            Units::MetersPerSecondSpeed(true_airspeed * cos(gamma) * cos(psi) + wind_east).value(),
+            Units::MetersPerSecondSpeed(true_airspeed * cos(gamma) * sin(psi) + wind_north).value(),
+            Units::MetersPerSecondSpeed(-true_airspeed * sin(gamma)).value(),
+            Units::MetersSecondAcceleration(
+                  (thrust - drag) / ac_mass + Units::ONE_G_ACCELERATION * sin(gamma) +
+                  true_airspeed * (dVwx_dh * cos(psi) + dVwy_dh * sin(psi)) * sin(gamma) * cos(gamma))
+                  .value(),
+            Units::RadiansPerSecondAngularSpeed(
+                  k_gamma * (gamma_command - gamma) -
+                  (dVwx_dh * cos(psi) + dVwy_dh * sin(psi)) * pow(sin(gamma), 2) * Units::ONE_RADIAN_ANGLE)
+                  .value(),
+            Units::RadiansPerSecondAngularSpeed((-lift * sin(phi) / (ac_mass * true_airspeed * cos(gamma)) -
+                                                 (dVwx_dh * sin(psi) - dVwy_dh * cos(psi)) * tan(gamma)) *
+                                                Units::ONE_RADIAN_ANGLE)
+                  .value(),
+            Units::NewtonsPerSecondForceChange(k_t * (thrust_command - thrust)).value(),
+            Units::RadiansPerSecondAngularSpeed(k_phi * (roll_command - phi)).value(),
+            inputs.k_speed_brake * (inputs.speed_brake_command - speed_brake)};
+
+      const Kernel::KineticForces forces = Kernel::CalculateKineticForces(aircraft, inputs, state);
+      EXPECT_NEAR(forces.lift_newtons, Units::NewtonsForce(lift).value(), 1e-9 * std::abs(forces.lift_newtons));
+      EXPECT_NEAR(forces.drag_newtons, Units::NewtonsForce(drag).value(), 1e-9 * std::abs(forces.drag_newtons));
+
+      const Kernel::State derivative = Kernel::Derivative(aircraft, inputs, state);
+      for (std::size_t i = 0; i < Kernel::STATE_SIZE; ++i) {
+         EXPECT_NEAR(derivative[i], expected[i], 1e-12 + 1e-9 * std::abs(expected[i])) << "state index " << i;
+      }
+   }
+}
+
+TEST(PhiloxRandomGenerator, matches_reference_vector) {
+   // Philox4x32-10 of a zero counter and key is 6627e8d5 e169c58d bc57ac4c 9b00dbd8 (Random123 known answers)
+   PhiloxRandomGenerator random_generator(0, 0);
+   EXPECT_EQ(random_generator.UniformSample(), ((0x6627e8d5e169c58dULL >> 11) + 0.5) * 0x1.0p-53);
+   EXPECT_EQ(random_generator.UniformSample(), ((0xbc57ac4c9b00dbd8ULL >> 11) + 0.5) * 0x1.0p-53);
+}
+
+TEST(PhiloxRandomGenerator, uniform_sample_moments) {
+   PhiloxRandomGenerator random_generator(15);
+   double s1 = 0, s2 = 0;
+   const int n = 100000;
+   for (int i = 0; i < n; i++) {
+      double x = random_generator.UniformSample();
+      EXPECT_GT(x, 0);
+      EXPECT_LT(x, 1);
+      s1 += x;
+      s2 += x * x;
+   }
+   double ee = sqrt(1 / (double)n);
+   EXPECT_NEAR(.5, s1 / n, ee);
+   EXPECT_NEAR(1.0 / 3.0, s2 / n, ee);
+}
+
+TEST(PhiloxRandomGenerator, split_streams_are_repeatable_and_independent_of_position) {
+   PhiloxRandomGenerator parent(2024);
+   PhiloxRandomGenerator first_split = parent.Split(7);
+   parent.UniformSample();
+   parent.Discard(1000);
+   PhiloxRandomGenerator second_split = parent.Split(7);
+   PhiloxRandomGenerator other_split = parent.Split(8);
+   for (int i = 0; i < 100; ++i) {
+      const double sample = first_split.UniformSample();
+      EXPECT_EQ(sample, second_split.UniformSample());
+      EXPECT_NE(sample, other_split.UniformSample());
+   }
+}
+
+TEST(PhiloxRandomGenerator, discard_jumps_ahead) {
+   PhiloxRandomGenerator stepped(99, 3), jumped(99, 3);
+   for (int i = 0; i < 2 * 500; ++i) {
+      stepped.UniformSample();
+   }
+   jumped.Discard(500);
+   EXPECT_EQ(stepped.UniformSample(), jumped.UniformSample());
+}
+
+TEST(PhiloxRandomGenerator, batch_fill_matches_single_samples) {
+   PhiloxRandomGenerator batch(5), single(5);
+   batch.UniformSample();
+   single.UniformSample();
+
+   std::vector<double> samples(1001);
+   batch.FillUniform(samples);
+   for (double sample : samples) {
+      EXPECT_EQ(sample, single.UniformSample());
+   }
+   batch.FillGaussian(samples);
+   for (double sample : samples) {
+      EXPECT_EQ(sample, single.GaussianSample());
+   }
+   batch.FillTruncatedGaussian(samples, 2.0);
+   for (double sample : samples) {
+      EXPECT_EQ(sample, single.TruncatedGaussianSample(2.0));
+      EXPECT_LE(std::abs(sample), 2.0);
+   }
+}
+
 TEST(RandomGenerator, uniformSample) {
 
    double seed = 15;
@@ -652,6 +1001,17 @@ TEST(RandomGenerator, truncateGaussConsistencyTest) {
    EXPECT_DOUBLE_EQ(seed, ScenarioUtils::RANDOM_NUMBER_GENERATOR.GetSeed());
 }
 
+TEST(RandomGenerator, default_generators_share_one_sequence) {
+   RandomGenerator generator;
+   double other_thread_sample = 0;
+   std::thread other_thread([&other_thread_sample]() {
+      RandomGenerator other_generator;
+      other_thread_sample = other_generator.UniformSample();
+   });
+   other_thread.join();
+   EXPECT_EQ(generator.UniformSample(), other_thread_sample);
+}
+
 TEST(DVector, access) {
    DVector v(1000, 1003);
    for (int i = v.GetMin(); i <= v.GetMax(); i++) {
@@ -676,6 +1036,36 @@ TEST(DMatrix, multiply) {
    delete &ba;
 }
 
+TEST(Mat3, matches_dmatrix_rotations) {
+   static_assert(Mat3::Identity() * Mat3::Identity() == Mat3::Identity());
+
+   OldCustomMath cm;
+   const Units::DegreesAngle theta(38.7);
+   const Mat3 rotation = CreateRotationMatrix(0.3, -1, 0.2, theta);
+   DMatrix &old_rotation = cm.createRotationMatrix(0.3, -1, 0.2, theta);
+   DMatrix &old_product = old_rotation * old_rotation;
+   const Mat3 product = rotation * rotation;
+   for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+         EXPECT_EQ(old_rotation[i][j], rotation[i][j]);
+         EXPECT_EQ(old_product[i][j], product[i][j]);
+      }
+   }
+   delete &old_rotation;
+   delete &old_product;
+
+   // a rotation and its reverse are inverses; its transpose is the reverse
+   const Mat3 reverse = CreateRotationMatrix(0.3, -1, 0.2, -theta);
+   const Vec3 v = {1200.0, -350.5, 42.0};
+   const Vec3 round_trip = reverse * (rotation * v);
+   for (int i = 0; i < 3; ++i) {
+      EXPECT_NEAR(v[i], round_trip[i], 1e-9);
+      for (int j = 0; j < 3; ++j) {
+         EXPECT_NEAR(reverse[i][j], rotation.Transpose()[i][j], 1e-15);
+      }
+   }
+}
+
 TEST(AircraftState, extrapolate) {
    const auto state_in = AircraftState::Builder(0, 0)
                                .GroundSpeed(Units::FeetPerSecondSpeed(100), Units::FeetPerSecondSpeed(-100))
@@ -696,6 +1086,51 @@ TEST(AircraftState, extrapolate) {
    EXPECT_DOUBLE_EQ(Units::FeetLength(state_out.GetAltitudeMsl()).value(), 1000.0);
 }
 
+TEST(AircraftState, deferred_position_resolves_on_first_read) {
+   int resolve_count = 0;
+   const auto deferred_position = std::make_shared<const DeferredGeodeticPosition>(
+         [&resolve_count](EarthModel::GeodeticPosition &position, LatLonDerivative &position_rate) {
+            ++resolve_count;
+            position = EarthModel::GeodeticPosition::Of(Units::DegreesAngle(38.0), Units::DegreesAngle(-77.0));
+            position_rate.latitude_time_derivative = Units::DegreesPerSecondAngularSpeed(0.001);
+            position_rate.longitude_time_derivative = Units::DegreesPerSecondAngularSpeed(-0.002);
+         });
+   const auto state_in = AircraftState::Builder(0, 0).DeferredPosition(deferred_position)->Build();
+   const auto state_copy = state_in;
+   EXPECT_EQ(resolve_count, 0);
+
+   EXPECT_DOUBLE_EQ(Units::DegreesAngle(state_copy.GetLatitude()).value(), 38.0);
+   EXPECT_DOUBLE_EQ(Units::DegreesAngle(state_in.GetLongitude()).value(), -77.0);
+   EXPECT_EQ(resolve_count, 1);
+
+   AircraftState state_out;
+   state_out.Extrapolate(state_in, Units::SecondsTime(10.0));
+   EXPECT_NEAR(Units::DegreesAngle(state_out.GetLatitude()).value(), 38.01, 1e-12);
+   EXPECT_NEAR(Units::DegreesAngle(state_out.GetLongitude()).value(), -77.02, 1e-12);
+
+   const auto overridden_state = AircraftState::Builder(state_in).Latitude(Units::DegreesAngle(39.0))->Build();
+   EXPECT_DOUBLE_EQ(Units::DegreesAngle(overridden_state.GetLatitude()).value(), 39.0);
+   EXPECT_DOUBLE_EQ(Units::DegreesAngle(overridden_state.GetLongitude()).value(), -77.0);
+   EXPECT_EQ(resolve_count, 1);
+}
+
+TEST(AircraftState, resolve_deferred_position_converts_once) {
+   int resolve_count = 0;
+   const auto deferred_position = std::make_shared<const DeferredGeodeticPosition>(
+         [&resolve_count](EarthModel::GeodeticPosition &position, LatLonDerivative &position_rate) {
+            ++resolve_count;
+            position = EarthModel::GeodeticPosition::Of(Units::DegreesAngle(38.0), Units::DegreesAngle(-77.0));
+         });
+   auto state = AircraftState::Builder(0, 0).DeferredPosition(deferred_position)->Build();
+
+   state.ResolveDeferredPosition();
+   EXPECT_EQ(resolve_count, 1);
+   state.ResolveDeferredPosition();
+   EXPECT_DOUBLE_EQ(Units::DegreesAngle(state.GetLatitude()).value(), 38.0);
+   EXPECT_DOUBLE_EQ(Units::DegreesAngle(state.GetLongitude()).value(), -77.0);
+   EXPECT_EQ(resolve_count, 1);
+}
+
 TEST(Units, CustomUnits) {
    Units::InvertedLength pm1 = Units::PerMeterInvertedLength(.25);
    Units::Length pm2 = Units::MetersLength(1);
@@ -922,6 +1357,64 @@ TEST(AlongPathDistanceCalculator, consistency_check_two_public_methods) {
                tol_crs.value());
 }
 
+TEST(AircraftCalculations, node_index_matches_exhaustive_search) {
+   // A long zig-zag route with many short legs, the case the node index exists for
+   const int node_count = 300;
+   std::vector<HorizontalPath> horizontal_trajectory(node_count);
+   for (int i = 0; i < node_count; ++i) {
+      horizontal_trajectory[i].m_segment_type = HorizontalPath::SegmentType::STRAIGHT;
+      horizontal_trajectory[i].SetXYPositionMeters(i * 2000.0, (i % 2) * 300.0);
+   }
+   for (int i = 0; i < node_count; ++i) {
+      const int from = i < node_count - 1 ? i : i - 1;
+      const double dx = horizontal_trajectory[from + 1].GetXPositionMeters() -
+                        horizontal_trajectory[from].GetXPositionMeters();
+      const double dy = horizontal_trajectory[from + 1].GetYPositionMeters() -
+                        horizontal_trajectory[from].GetYPositionMeters();
+      horizontal_trajectory[i].m_path_course = atan2(dy, dx);
+      if (i > 0) {
+         horizontal_trajectory[i].m_path_length_cumulative_meters =
+               horizontal_trajectory[i - 1].m_path_length_cumulative_meters + hypot(dx, dy);
+      }
+   }
+   const HorizontalPathNodeIndex node_index(horizontal_trajectory);
+   const Units::NauticalMilesLength cross_track_tolerance(2.5);
+
+   for (double x = -3000; x < node_count * 2000.0 + 3000; x += 700) {
+      for (double y = -6000; y <= 6000; y += 1500) {
+         const auto tracked_index = static_cast<std::vector<HorizontalPath>::size_type>(
+               std::clamp(x / 2000.0, 0.0, static_cast<double>(node_count - 1)));
+         for (auto starting_index : {std::vector<HorizontalPath>::size_type{0}, tracked_index}) {
+            Units::Length expected_distance, actual_distance;
+            Units::Angle expected_course, actual_course;
+            std::vector<HorizontalPath>::size_type expected_index, actual_index;
+            bool expected_throw = false, actual_throw = false;
+            try {
+               AircraftCalculations::CalculateDistanceAlongPathFromPosition(
+                     cross_track_tolerance, Units::MetersLength(x), Units::MetersLength(y), horizontal_trajectory,
+                     starting_index, expected_distance, expected_course, expected_index);
+            } catch (std::logic_error &) {
+               expected_throw = true;
+            }
+            try {
+               AircraftCalculations::CalculateDistanceAlongPathFromPosition(
+                     cross_track_tolerance, Units::MetersLength(x), Units::MetersLength(y), horizontal_trajectory,
+                     node_index, starting_index, actual_distance, actual_course, actual_index);
+            } catch (std::logic_error &) {
+               actual_throw = true;
+            }
+
+            ASSERT_EQ(expected_throw, actual_throw) << x << "," << y << " from " << starting_index;
+            if (!expected_throw) {
+               ASSERT_EQ(expected_index, actual_index) << x << "," << y << " from " << starting_index;
+               EXPECT_EQ(Units::MetersLength(expected_distance).value(), Units::MetersLength(actual_distance).value());
+               EXPECT_EQ(Units::RadiansAngle(expected_course).value(), Units::RadiansAngle(actual_course).value());
+            }
+         }
+      }
+   }
+}
+
 /* Broken because we cannot access bada classes from here
 TEST(WindZero, test_for_zero_behavior) {
    std::shared_ptr<Atmosphere>
@@ -1030,6 +1523,59 @@ TEST(TestHorizontalPathTracker, check_is_on_node_distance) {
    }
 }
 
+TEST(TestHorizontalPathTracker, trackers_share_extended_path) {
+   const std::vector<HorizontalPath> horizontal_trajectory =
+         aaesim::test::utils::PublicUtils::CreateStraightHorizontalPath(aaesim::test::utils::Quadrant::FIRST);
+   const auto extended_path = ExtendedHorizontalPath::Of(horizontal_trajectory);
+   ASSERT_EQ(horizontal_trajectory.size() + 2, extended_path->GetExtendedPath().size());
+
+   PositionCalculator position_calculator(extended_path, TrajectoryIndexProgressionDirection::DECREMENTING);
+   AlongPathDistanceCalculator distance_calculator(extended_path, TrajectoryIndexProgressionDirection::DECREMENTING);
+   EXPECT_EQ(extended_path, position_calculator.GetExtendedHorizontalPath());
+   EXPECT_EQ(extended_path, distance_calculator.GetExtendedHorizontalPath());
+   EXPECT_EQ(&extended_path->GetUnmodifiedPath(), &distance_calculator.GetHorizontalPath());
+
+   // each tracker keeps its own index into the shared path
+   const HorizontalPath &hp = horizontal_trajectory[horizontal_trajectory.size() - 2];
+   Units::Length distance_along_path;
+   distance_calculator.CalculateAlongPathDistanceFromPosition(Units::MetersLength(hp.GetXPositionMeters()),
+                                                              Units::MetersLength(hp.GetYPositionMeters()),
+                                                              distance_along_path);
+   EXPECT_NEAR(hp.m_path_length_cumulative_meters, Units::MetersLength(distance_along_path).value(), 1e-9);
+   EXPECT_EQ(horizontal_trajectory.size() - 2, distance_calculator.GetCurrentTrajectoryIndex());
+   EXPECT_EQ(horizontal_trajectory.size() - 1, position_calculator.GetCurrentTrajectoryIndex());
+}
+
+TEST(TestHorizontalPathTracker, update_follows_active_segment) {
+   const std::vector<HorizontalPath> horizontal_trajectory =
+         aaesim::test::utils::PublicUtils::CreateStraightHorizontalPath(aaesim::test::utils::Quadrant::FIRST);
+   ASSERT_GE(horizontal_trajectory.size(), 3);
+   TestHorizontalPathTracker tracker(horizontal_trajectory, TrajectoryIndexProgressionDirection::DECREMENTING);
+   const auto active_index = horizontal_trajectory.size() - 2;
+   const HorizontalPath &hp = horizontal_trajectory[active_index];
+   ASSERT_TRUE(tracker.TestIsPositionOnNode(Units::MetersLength(hp.GetXPositionMeters()),
+                                            Units::MetersLength(hp.GetYPositionMeters())));
+   ASSERT_EQ(active_index, tracker.GetCurrentTrajectoryIndex());
+
+   // the same path again
+   const auto same_path = tracker.GetExtendedHorizontalPath();
+   tracker.UpdateHorizontalTrajectory(same_path);
+   EXPECT_EQ(active_index, tracker.GetCurrentTrajectoryIndex());
+
+   // a slight change away from the active segment
+   std::vector<HorizontalPath> changed_trajectory = horizontal_trajectory;
+   changed_trajectory.front().m_path_course += 1e-3;
+   tracker.UpdateHorizontalTrajectory(changed_trajectory);
+   EXPECT_EQ(active_index, tracker.GetCurrentTrajectoryIndex());
+   EXPECT_NE(same_path, tracker.GetExtendedHorizontalPath());
+
+   // the active segment moved to another index
+   std::vector<HorizontalPath> shortened_trajectory(changed_trajectory.begin() + 1, changed_trajectory.end());
+   tracker.UpdateHorizontalTrajectory(shortened_trajectory);
+   EXPECT_EQ(active_index - 1, tracker.GetCurrentTrajectoryIndex());
+   EXPECT_EQ(shortened_trajectory.size(), tracker.GetHorizontalPath().size());
+}
+
 TEST(AircraftState, GetHeadingCcwFromEastRadians) {
    const Units::SecondsTime delta_time{1};
    for (int q = Quadrant::FIRST; q <= Quadrant::FOURTH; ++q) {
@@ -1285,6 +1831,327 @@ TEST(CustomUnits, ToSigned) {
    ASSERT_DOUBLE_EQ(-45, quad4_signed_angle.value());
 }
 
+static std::vector<HorizontalPath> MakeDescentHorizontalPath() {
+   std::vector<HorizontalPath> horizontal_path;
+   for (int i = 0; i <= 4; ++i) {
+      HorizontalPath path_point;
+      path_point.m_segment_type = HorizontalPath::SegmentType::STRAIGHT;
+      path_point.m_path_length_cumulative_meters = Units::MetersLength(Units::NauticalMilesLength(50 * i)).value();
+      path_point.m_path_course = 0;
+      path_point.SetXYPositionMeters(path_point.m_path_length_cumulative_meters, 0);
+      horizontal_path.push_back(path_point);
+   }
+   return horizontal_path;
+}
+
+static std::vector<PrecalcWaypoint> MakeDescentWaypoints() {
+   const double distance_nm[] = {0, 15, 40, 90, 200};
+   const double altitude_low_ft[] = {1800, 5000, 8000, 11000, 0};
+   const double altitude_high_ft[] = {1800, 7000, 10000, 18000, 50000};
+   const double speed_high_kts[] = {170, 210, 250, 280, 400};
+   std::vector<PrecalcWaypoint> precalc_waypoints(5);
+   for (int i = 0; i < 5; ++i) {
+      PrecalcConstraint &constraints = precalc_waypoints[i].m_precalc_constraints;
+      constraints.constraint_along_path_distance = Units::NauticalMilesLength(distance_nm[i]);
+      constraints.constraint_altLow = Units::FeetLength(altitude_low_ft[i]);
+      constraints.constraint_altHi = Units::FeetLength(altitude_high_ft[i]);
+      constraints.constraint_speedHi = Units::KnotsSpeed(speed_high_kts[i]);
+      constraints.constraint_speedLow = Units::KnotsSpeed(0);
+      constraints.index = i;
+      precalc_waypoints[i].m_x_pos_meters = Units::NauticalMilesLength(distance_nm[i]);
+   }
+   return precalc_waypoints;
+}
+
+static KinematicDescent4DPredictor MakeDescentPredictor(const std::shared_ptr<Atmosphere> &atmosphere) {
+   KinematicDescent4DPredictor predictor;
+   predictor.SetMembers(0.78, Units::KnotsSpeed(290), Units::FeetLength(37000), Units::FeetLength(29000));
+   predictor.SetConditionsAtEndOfRoute(Units::FeetLength(1800), Units::KnotsSpeed(170));
+   predictor.SetAtmosphere(atmosphere);
+   return predictor;
+}
+
+static void ExpectSameVerticalPath(const VerticalPath &expected, const VerticalPath &actual) {
+   EXPECT_EQ(expected.along_path_distance_m, actual.along_path_distance_m);
+   EXPECT_EQ(expected.altitude_m, actual.altitude_m);
+   EXPECT_EQ(expected.cas_mps, actual.cas_mps);
+   EXPECT_EQ(expected.mach, actual.mach);
+   EXPECT_EQ(expected.altitude_rate_mps, actual.altitude_rate_mps);
+   EXPECT_EQ(expected.tas_rate_mps, actual.tas_rate_mps);
+   EXPECT_EQ(expected.theta_radians, actual.theta_radians);
+   EXPECT_EQ(expected.gs_mps, actual.gs_mps);
+   EXPECT_EQ(expected.time_to_go_sec, actual.time_to_go_sec);
+   EXPECT_EQ(expected.mass_kg, actual.mass_kg);
+   EXPECT_EQ(expected.algorithm_type, actual.algorithm_type);
+   EXPECT_EQ(expected.flap_setting, actual.flap_setting);
+   EXPECT_TRUE(expected.true_airspeed == actual.true_airspeed);
+   EXPECT_TRUE(expected.wind_velocity_east == actual.wind_velocity_east);
+   EXPECT_TRUE(expected.wind_velocity_north == actual.wind_velocity_north);
+}
+
+TEST(KinematicDescent4DPredictor, reused_predictor_matches_fresh_predictor) {
+   const auto atmosphere = std::make_shared<USStandardAtmosphere1976>(Units::CelsiusTemperature(0));
+   WeatherPrediction weather_prediction = WeatherPrediction::CreateZeroWindPrediction(atmosphere);
+   std::vector<HorizontalPath> horizontal_path = MakeDescentHorizontalPath();
+   std::vector<PrecalcWaypoint> precalc_waypoints = MakeDescentWaypoints();
+   KinematicDescent4DPredictor reused_predictor = MakeDescentPredictor(atmosphere);
+   auto inputs_match_cache = [&]() {
+      return reused_predictor.CachedInputsMatch(
+            reused_predictor.CapturePredictionSettings(weather_prediction),
+            KinematicDescent4DPredictor::FingerprintPredictionInputs(horizontal_path, precalc_waypoints,
+                                                                     weather_prediction),
+            horizontal_path, precalc_waypoints, weather_prediction);
+   };
+   auto predict_and_compare = [&](double distance_to_go_nm, double altitude_ft) {
+      const Units::NauticalMilesLength distance_to_go(distance_to_go_nm);
+      const Units::FeetLength altitude(altitude_ft);
+      reused_predictor.BuildVerticalPrediction(horizontal_path, precalc_waypoints, weather_prediction, altitude,
+                                               distance_to_go);
+      KinematicDescent4DPredictor fresh_predictor = MakeDescentPredictor(atmosphere);
+      fresh_predictor.BuildVerticalPrediction(horizontal_path, precalc_waypoints, weather_prediction, altitude,
+                                              distance_to_go);
+      ASSERT_LT(1, fresh_predictor.GetVerticalPath().Size());
+      ExpectSameVerticalPath(fresh_predictor.GetVerticalPath(), reused_predictor.GetVerticalPath());
+   };
+
+   EXPECT_FALSE(inputs_match_cache());
+   predict_and_compare(190, 37000);
+
+   // unchanged inputs and aircraft state keep the previous prediction
+   EXPECT_TRUE(inputs_match_cache());
+   predict_and_compare(190, 37000);
+
+   // further along the route, the prediction resumes from a checkpoint partway up the descent
+   EXPECT_TRUE(inputs_match_cache());
+   const auto *checkpoint = reused_predictor.FindResumableCheckpoint(Units::NauticalMilesLength(150));
+   ASSERT_NE(nullptr, checkpoint);
+   EXPECT_LT(1, checkpoint->path_size);
+   predict_and_compare(150, 37000);
+   predict_and_compare(100, 25000);
+
+   // a wind change invalidates the cached prediction
+   weather_prediction.east_west().Insert(4, Units::FeetLength(30000), Units::KnotsSpeed(40));
+   EXPECT_FALSE(inputs_match_cache());
+   predict_and_compare(100, 25000);
+
+   // so does a constraint change, which the fingerprint does not cover
+   precalc_waypoints[2].m_precalc_constraints.constraint_altLow = Units::FeetLength(7000);
+   EXPECT_FALSE(inputs_match_cache());
+   predict_and_compare(60, 16000);
+   predict_and_compare(30, 9000);
+}
+
+TEST(CsvCursor, splits_lines_like_getline) {
+   std::istringstream input("\xEF\xBB\xBF"
+                            "a,b,c\r\n1.5, 2,+3\n\nx,,y,\nlast,row");
+   aaesim::open_source::CsvCursor csv_row(aaesim::open_source::CsvFile::Read(input));
+
+   ASSERT_TRUE(csv_row.Advance());
+   ASSERT_EQ(3, csv_row.Size());
+   EXPECT_EQ("a", csv_row[0]);
+   EXPECT_EQ("c", csv_row[2]);
+
+   ASSERT_TRUE(csv_row.Advance());
+   ASSERT_EQ(3, csv_row.Size());
+   EXPECT_DOUBLE_EQ(1.5, csv_row.GetDouble(0));
+   EXPECT_DOUBLE_EQ(2, csv_row.GetDouble(1));
+   EXPECT_DOUBLE_EQ(3, csv_row.GetDouble(2));
+   EXPECT_DOUBLE_EQ(0, csv_row.GetDouble(3));
+
+   ASSERT_TRUE(csv_row.Advance());
+   EXPECT_EQ(0, csv_row.Size());
+
+   ASSERT_TRUE(csv_row.Advance());
+   ASSERT_EQ(3, csv_row.Size());
+   EXPECT_EQ("", csv_row[1]);
+   EXPECT_EQ("y", csv_row[2]);
+
+   ASSERT_TRUE(csv_row.Advance());
+   ASSERT_EQ(2, csv_row.Size());
+   EXPECT_EQ("row", csv_row[1]);
+   EXPECT_FALSE(csv_row.Advance());
+}
+
+TEST(CsvCursor, parses_numbers_like_atof) {
+   using aaesim::open_source::CsvCursor;
+   EXPECT_DOUBLE_EQ(-12.25, CsvCursor::ParseDouble("-12.25"));
+   EXPECT_DOUBLE_EQ(1e-3, CsvCursor::ParseDouble(" 1e-3"));
+   EXPECT_DOUBLE_EQ(7, CsvCursor::ParseDouble("7kts"));
+   EXPECT_DOUBLE_EQ(0, CsvCursor::ParseDouble("abc"));
+   EXPECT_DOUBLE_EQ(0, CsvCursor::ParseDouble(""));
+}
+
+TEST(CsvCursor, out_of_range_numbers_match_atof) {
+   using aaesim::open_source::CsvCursor;
+   EXPECT_EQ(HUGE_VAL, CsvCursor::ParseDouble("1e400"));
+   EXPECT_EQ(-HUGE_VAL, CsvCursor::ParseDouble(" -1e400"));
+   EXPECT_EQ(HUGE_VAL, CsvCursor::ParseDouble("+1e400,"));
+   EXPECT_EQ(atof("1e-400"), CsvCursor::ParseDouble("1e-400"));
+   EXPECT_EQ(atof("-1e-400"), CsvCursor::ParseDouble("-1e-400"));
+}
+
+TEST(CsvCursor, maps_file_from_disk) {
+   const std::string file_name = testing::TempDir() + "csv_cursor_test.csv";
+   {
+      std::ofstream os(file_name);
+      os << "time,value\n0,1.25\n1,2.5\n";
+   }
+   auto csv_file = aaesim::open_source::CsvFile::Open(file_name);
+   ASSERT_NE(nullptr, csv_file);
+   aaesim::open_source::CsvCursor csv_row(csv_file);
+   csv_row.SkipLines(1);
+   double sum = 0;
+   while (csv_row.Advance()) {
+      sum += csv_row.GetDouble(1);
+   }
+   EXPECT_DOUBLE_EQ(3.75, sum);
+   std::remove(file_name.c_str());
+
+   EXPECT_EQ(nullptr, aaesim::open_source::CsvFile::Open(file_name));
+}
+
+TEST(CsvCursor, last_duplicate_header_wins) {
+   std::istringstream input("time,speed,time\n");
+   aaesim::open_source::CsvCursor csv_row(aaesim::open_source::CsvFile::Read(input));
+   ASSERT_TRUE(csv_row.Advance());
+   const auto column_index = csv_row.BuildColumnIndex();
+   EXPECT_EQ(2, column_index.size());
+   EXPECT_EQ(2, column_index.at("time"));
+   EXPECT_EQ(1, column_index.at("speed"));
+}
+
+TEST(DataReader, maps_columns_from_header) {
+   auto input = std::make_shared<std::istringstream>(
+         "tRec[sec],ACID,TargetType,TOAp[sec],Lat[degrees],Lon[degrees],Alt[feet],EWVel[knots],NSVel[knots],"
+         "TOAv[sec],NACp,NIC,NACv,SIL,SDA,VertRate[fpm]\r\n"
+         "12,3,1,11.5,38.5,-77.25,10000,250,-100,11.75,9,8,2,3,2,-1500\r\n");
+   aaesim::open_source::TvReader tv_reader(input, 1);
+   ASSERT_TRUE(tv_reader.Advance());
+   EXPECT_DOUBLE_EQ(12, Units::SecondsTime(tv_reader.GetTimeOfReceipt()).value());
+   EXPECT_EQ(3, tv_reader.GetAcid());
+   EXPECT_DOUBLE_EQ(-77.25, Units::DegreesAngle(tv_reader.GetLon()).value());
+   EXPECT_DOUBLE_EQ(-1500, Units::FeetPerMinuteSpeed(tv_reader.GetVertRate()).value());
+   EXPECT_FALSE(tv_reader.Advance());
+}
+
+TEST(KinematicDescent4DPredictor, matches_baseline_prediction) {
+   // sampled rows of the path that the implementation without prediction reuse built for this route and wind
+   struct BaselineRow {
+      std::size_t row;
+      double along_path_distance_m;
+      double altitude_m;
+      double cas_mps;
+      double time_to_go_sec;
+      double gs_mps;
+   };
+   const std::size_t baseline_size = 2185;
+   const std::vector<BaselineRow> baseline_rows = {
+      {0, 0, 548.63999999999999, 87.455555555555563, 0, 89.215219525742882},
+      {200, 10178.97508724098, 781.12368072842662, 108.06474272901011, 100, 111.328727152564},
+      {400, 21452.56726895578, 1356.6770409378976, 107.95991235887793, 200, 114.20907857729814},
+      {600, 33281.736130613303, 1774.9299836304453, 118.10310196338658, 300, 127.84178548043941},
+      {800, 47071.391156130107, 2262.6792253429653, 128.56031470551977, 400, 142.77234224819779},
+      {1000, 61651.20041500809, 2964.2554464521309, 128.6103729078898, 500, 148.9056212726002},
+      {1200, 76619.901547321759, 3091.6897650926348, 131.92677745705757, 600, 153.89852610741067},
+      {1400, 93182.434911587319, 3618.2555276804246, 144.07916647293499, 700, 173.27159787271438},
+      {1600, 111001.68794151446, 4555.596074772775, 144.0370883471482, 800, 183.13502105421696},
+      {1800, 129798.84822875983, 5417.5142134828784, 144.10772483847245, 900, 191.93477459664388},
+      {2000, 149006.93314918497, 5454.1590328465927, 144.07901704324945, 1000, 192.22496615284996},
+      {2184, 166703.84638111334, 5486.4520481305944, 144.05360282088324, 1092, 192.47783630377444},
+   };
+
+   const auto atmosphere = std::make_shared<USStandardAtmosphere1976>(Units::CelsiusTemperature(0));
+   WeatherPrediction weather_prediction = WeatherPrediction::CreateZeroWindPrediction(atmosphere);
+   weather_prediction.east_west().Insert(4, Units::FeetLength(30000), Units::KnotsSpeed(40));
+   std::vector<HorizontalPath> horizontal_path = MakeDescentHorizontalPath();
+   std::vector<PrecalcWaypoint> precalc_waypoints = MakeDescentWaypoints();
+   KinematicDescent4DPredictor predictor = MakeDescentPredictor(atmosphere);
+
+   // the second prediction resumes from a checkpoint of the first
+   for (const double distance_to_go_nm : {190.0, 150.0}) {
+      predictor.BuildVerticalPrediction(horizontal_path, precalc_waypoints, weather_prediction,
+                                        Units::FeetLength(37000), Units::NauticalMilesLength(distance_to_go_nm));
+      const VerticalPath &vertical_path = predictor.GetVerticalPath();
+      ASSERT_EQ(baseline_size, vertical_path.Size()) << "distance to go " << distance_to_go_nm;
+      for (const BaselineRow &expected : baseline_rows) {
+         SCOPED_TRACE("distance to go " + std::to_string(distance_to_go_nm) + ", row " + std::to_string(expected.row));
+         EXPECT_DOUBLE_EQ(expected.along_path_distance_m, vertical_path.along_path_distance_m[expected.row]);
+         EXPECT_DOUBLE_EQ(expected.altitude_m, vertical_path.altitude_m[expected.row]);
+         EXPECT_DOUBLE_EQ(expected.cas_mps, vertical_path.cas_mps[expected.row]);
+         EXPECT_DOUBLE_EQ(expected.time_to_go_sec, vertical_path.time_to_go_sec[expected.row]);
+         EXPECT_DOUBLE_EQ(expected.gs_mps, vertical_path.gs_mps[expected.row]);
+      }
+   }
+}
+
 }  // namespace open_source
 }  // namespace test
 }  // namespace aaesim
+
+static void AppendVerticalPathRecord(VerticalPath &vertical_path, double value) {
+   vertical_path.along_path_distance_m.push_back(value);
+   vertical_path.altitude_m.push_back(value);
+   vertical_path.cas_mps.push_back(value);
+   vertical_path.mach.push_back(value);
+   vertical_path.altitude_rate_mps.push_back(value);
+   vertical_path.true_airspeed.push_back(Units::MetersPerSecondSpeed(value));
+   vertical_path.tas_rate_mps.push_back(value);
+   vertical_path.theta_radians.push_back(value);
+   vertical_path.gs_mps.push_back(value);
+   vertical_path.time_to_go_sec.push_back(value);
+   vertical_path.mass_kg.push_back(value);
+   vertical_path.wind_velocity_east.push_back(Units::MetersPerSecondSpeed(value));
+   vertical_path.wind_velocity_north.push_back(Units::MetersPerSecondSpeed(value));
+   vertical_path.algorithm_type.push_back(VerticalPath::CONSTANT_CAS);
+   vertical_path.flap_setting.push_back(aaesim::open_source::bada_utils::FlapConfiguration::UNDEFINED);
+}
+
+static void ExpectVerticalPathColumnSizes(const VerticalPath &vertical_path, std::size_t size) {
+   EXPECT_EQ(size, vertical_path.Size());
+   EXPECT_EQ(size, vertical_path.along_path_distance_m.size());
+   EXPECT_EQ(size, vertical_path.altitude_m.size());
+   EXPECT_EQ(size, vertical_path.cas_mps.size());
+   EXPECT_EQ(size, vertical_path.mach.size());
+   EXPECT_EQ(size, vertical_path.altitude_rate_mps.size());
+   EXPECT_EQ(size, vertical_path.true_airspeed.size());
+   EXPECT_EQ(size, vertical_path.tas_rate_mps.size());
+   EXPECT_EQ(size, vertical_path.theta_radians.size());
+   EXPECT_EQ(size, vertical_path.gs_mps.size());
+   EXPECT_EQ(size, vertical_path.time_to_go_sec.size());
+   EXPECT_EQ(size, vertical_path.mass_kg.size());
+   EXPECT_EQ(size, vertical_path.wind_velocity_east.size());
+   EXPECT_EQ(size, vertical_path.wind_velocity_north.size());
+   EXPECT_EQ(size, vertical_path.algorithm_type.size());
+   EXPECT_EQ(size, vertical_path.flap_setting.size());
+}
+
+TEST(VerticalPath, truncate_shortens_every_column) {
+   VerticalPath vertical_path;
+   for (int index = 0; index < 10; ++index) {
+      AppendVerticalPathRecord(vertical_path, index);
+   }
+   ExpectVerticalPathColumnSizes(vertical_path, 10);
+
+   vertical_path.Truncate(4);
+   ExpectVerticalPathColumnSizes(vertical_path, 4);
+   EXPECT_DOUBLE_EQ(3, vertical_path.mach.back());
+   EXPECT_DOUBLE_EQ(3, vertical_path.along_path_distance_m.back());
+
+   // truncating to a longer size leaves the path alone
+   vertical_path.Truncate(8);
+   ExpectVerticalPathColumnSizes(vertical_path, 4);
+}
+
+TEST(VerticalPath, clear_keeps_reserved_capacity) {
+   VerticalPath vertical_path;
+   vertical_path.Reserve(64);
+   for (int index = 0; index < 10; ++index) {
+      AppendVerticalPathRecord(vertical_path, index);
+   }
+
+   vertical_path.Clear();
+   ExpectVerticalPathColumnSizes(vertical_path, 0);
+   EXPECT_LE(64, vertical_path.mach.capacity());
+   EXPECT_LE(64, vertical_path.flap_setting.capacity());
+   EXPECT_LE(64, vertical_path.along_path_distance_m.capacity());
+}
@@ -18,11 +18,14 @@
 // ****************************************************************************
 
 #include <gtest/gtest.h>
+#include <random>
 
 #include "public/SingleTangentPlaneSequence.h"
+#include "public/SortedAxisNearestPoint.h"
 #include "public/TangentPlaneSequence.h"
 #include "public/Waypoint.h"
 #include "public/AircraftIntent.h"
+#include "public/LegacyPositionEstimator.h"
 
 namespace aaesim {
 namespace open_source {
@@ -122,6 +125,135 @@ TEST(TangentPlaneSequence, LineSequenceConsistency2) {
    std::for_each(zipped_route.begin(), zipped_route.end(), enu_comparator_high_tolerance);
 }
 
+TEST(SortedAxisNearestPoint, MatchesLinearScan) {
+   std::mt19937 generator(20240601);
+   std::uniform_real_distribution<double> coordinate(-5e5, 5e5);
+   std::vector<SortedAxisNearestPoint<3>::Point> points(60);
+   for (auto &point : points) point = {coordinate(generator), coordinate(generator) / 10, coordinate(generator)};
+   points[17] = points[42];  // an exact tie must resolve to the lower index
+   const SortedAxisNearestPoint<3> nearest_point(points);
+
+   auto linear_scan = [&points](const SortedAxisNearestPoint<3>::Point &query) {
+      std::vector<double> distances;
+      for (const auto &point : points) {
+         const double dx = query[0] - point[0], dy = query[1] - point[1], dz = query[2] - point[2];
+         distances.push_back(dx * dx + dy * dy + dz * dz);
+      }
+      return static_cast<std::size_t>(std::min_element(distances.begin(), distances.end()) - distances.begin());
+   };
+
+   std::vector<SortedAxisNearestPoint<3>::Point> queries = {points[42], {NAN, 0, 0}, {INFINITY, 0, 0}};
+   for (auto i = 0; i < 2000; ++i) {
+      queries.push_back({coordinate(generator) * 1.5, coordinate(generator), coordinate(generator)});
+   }
+   std::size_t hint = 0;
+   for (const auto &query : queries) {
+      const std::size_t expected = linear_scan(query);
+      EXPECT_EQ(expected, nearest_point.FindNearest(query, 0));
+      EXPECT_EQ(expected, nearest_point.FindNearest(query, points.size() + 5));
+      hint = nearest_point.FindNearest(query, hint);
+      EXPECT_EQ(expected, hint);
+   }
+}
+
+TEST(TangentPlaneSequence, BatchConversionsMatchSinglePointConversions) {
+   std::list<Waypoint> waypoints;
+   for (auto i = 0; i < 40; ++i) {
+      waypoints.push_back(Waypoint{"wp" + std::to_string(i), Units::DegreesAngle(35.0 + 0.1 * i),
+                                   Units::DegreesAngle(-77.0 + 0.2 * i)});
+   }
+   const TangentPlaneSequence tangent_plane_sequence(waypoints);
+
+   std::vector<EarthModel::LocalPositionEnu> local_positions;
+   for (const auto &enu : tangent_plane_sequence.GetLocalPositionsFromInitialization()) {
+      for (auto offset : {-7000.0, 0.0, 12000.0}) {
+         EarthModel::LocalPositionEnu position = enu;
+         position.x += Units::MetersLength(offset);
+         position.y -= Units::MetersLength(offset / 2);
+         local_positions.push_back(position);
+      }
+   }
+
+   std::vector<EarthModel::GeodeticPosition> geo_positions;
+   tangent_plane_sequence.ConvertLocalToGeodetic(local_positions, geo_positions);
+   std::vector<EarthModel::LocalPositionEnu> round_trip_positions;
+   tangent_plane_sequence.ConvertGeodeticToLocal(geo_positions, round_trip_positions);
+   ASSERT_EQ(local_positions.size(), geo_positions.size());
+   ASSERT_EQ(local_positions.size(), round_trip_positions.size());
+
+   for (auto i = 0; i < local_positions.size(); ++i) {
+      EarthModel::GeodeticPosition geo_position;
+      tangent_plane_sequence.ConvertLocalToGeodetic(local_positions[i], geo_position);
+      EXPECT_EQ(Units::RadiansAngle(geo_position.latitude).value(),
+                Units::RadiansAngle(geo_positions[i].latitude).value());
+      EXPECT_EQ(Units::RadiansAngle(geo_position.longitude).value(),
+                Units::RadiansAngle(geo_positions[i].longitude).value());
+
+      EarthModel::LocalPositionEnu local_position;
+      tangent_plane_sequence.ConvertGeodeticToLocal(geo_positions[i], local_position);
+      EXPECT_EQ(Units::MetersLength(local_position.x).value(), Units::MetersLength(round_trip_positions[i].x).value());
+      EXPECT_EQ(Units::MetersLength(local_position.y).value(), Units::MetersLength(round_trip_positions[i].y).value());
+   }
+}
+
+TEST(LegacyPositionEstimator, deferred_position_matches_computed_position) {
+   Waypoint start_waypoint{"start", Units::DegreesAngle(35.0), Units::DegreesAngle(-77.0)};
+   Waypoint wp1{"wp1", Units::DegreesAngle(37.5), Units::DegreesAngle(-76.0)};
+   Waypoint end_waypoint{"end", Units::DegreesAngle(40.0), Units::DegreesAngle(-70.0)};
+   auto waypoints = std::list<Waypoint>{start_waypoint, wp1, end_waypoint};
+   const auto tangent_plane_sequence = std::make_shared<TangentPlaneSequence>(waypoints);
+   const auto initial_position =
+         EarthModel::GeodeticPosition::Of(Units::DegreesAngle(35.0), Units::DegreesAngle(-77.0));
+   LegacyPositionEstimator computing_estimator(tangent_plane_sequence, initial_position);
+   LegacyPositionEstimator deferring_estimator(tangent_plane_sequence, initial_position);
+
+   std::vector<EarthModel::GeodeticPosition> computed_positions;
+   std::vector<LatLonDerivative> computed_rates;
+   std::vector<std::shared_ptr<const DeferredGeodeticPosition>> deferred_positions;
+   EquationsOfMotionState eqm_state{};
+   for (auto step = 0; step < 5; ++step) {
+      eqm_state.enu_x = Units::MetersLength(1000.0 + 200.0 * step);
+      eqm_state.enu_y = Units::MetersLength(3000.0 + 150.0 * step);
+      eqm_state.altitude_msl = Units::FeetLength(10000.0);
+      const auto simtime = SimulationTime::Of(Units::SecondsTime(step));
+      EarthModel::GeodeticPosition position;
+      LatLonDerivative position_rate;
+      computing_estimator.ComputePosition(simtime, eqm_state, EquationsOfMotionStateDeriv{}, position, position_rate);
+      computed_positions.push_back(position);
+      computed_rates.push_back(position_rate);
+      deferred_positions.push_back(
+            deferring_estimator.DeferPosition(simtime, eqm_state, EquationsOfMotionStateDeriv{}));
+   }
+
+   // Resolve out of order so that some steps find their predecessor unresolved
+   EXPECT_FALSE(deferred_positions[3]->IsResolved());
+   for (auto step : {3, 4, 0, 1, 2}) {
+      const auto &position = deferred_positions[step]->GetPosition();
+      const auto &position_rate = deferred_positions[step]->GetPositionRate();
+      EXPECT_TRUE(deferred_positions[step]->IsResolved());
+      EXPECT_NEAR(Units::RadiansAngle(position.latitude).value(),
+                  Units::RadiansAngle(computed_positions[step].latitude).value(), 1e-15);
+      EXPECT_NEAR(Units::RadiansAngle(position.longitude).value(),
+                  Units::RadiansAngle(computed_positions[step].longitude).value(), 1e-15);
+      EXPECT_NEAR(Units::RadiansPerSecondAngularSpeed(position_rate.latitude_time_derivative).value(),
+                  Units::RadiansPerSecondAngularSpeed(computed_rates[step].latitude_time_derivative).value(), 1e-15);
+      EXPECT_NEAR(Units::RadiansPerSecondAngularSpeed(position_rate.longitude_time_derivative).value(),
+                  Units::RadiansPerSecondAngularSpeed(computed_rates[step].longitude_time_derivative).value(), 1e-15);
+   }
+
+   // Switching back to computing picks up the last deferred position for the rate
+   eqm_state.enu_x += Units::MetersLength(200.0);
+   EarthModel::GeodeticPosition computed_position, position_after_deferral;
+   LatLonDerivative computed_rate, rate_after_deferral;
+   const auto simtime = SimulationTime::Of(Units::SecondsTime(5));
+   computing_estimator.ComputePosition(simtime, eqm_state, EquationsOfMotionStateDeriv{}, computed_position,
+                                       computed_rate);
+   deferring_estimator.ComputePosition(simtime, eqm_state, EquationsOfMotionStateDeriv{}, position_after_deferral,
+                                       rate_after_deferral);
+   EXPECT_NEAR(Units::RadiansPerSecondAngularSpeed(rate_after_deferral.longitude_time_derivative).value(),
+               Units::RadiansPerSecondAngularSpeed(computed_rate.longitude_time_derivative).value(), 1e-15);
+}
+
 }  // namespace test
 }  // namespace open_source
 }  // namespace aaesim
@@ -207,6 +207,29 @@ TEST(WindStack, AscendSort) {
    EXPECT_EQ(Units::MetersLength(test_stack.GetAltitude(4)).value(), Units::MetersLength(200).value());
 }
 
+TEST(WindStack, high_altitude_band) {
+   // bounds as set for a 40,000 ft altitude band in WeatherTruthFromStaticData
+   WindStack test_stack(39, 43);
+   for (auto ix = test_stack.GetMinRow(); ix <= test_stack.GetMaxRow(); ++ix) {
+      test_stack.Insert(ix, Units::FeetLength((ix - 1) * 1000), Units::KnotsSpeed(ix));
+   }
+
+   EXPECT_EQ(Units::FeetLength(test_stack.GetAltitude(39)).value(), 38000);
+   EXPECT_EQ(Units::KnotsSpeed(test_stack.GetSpeed(43)).value(), 43);
+   EXPECT_EQ(Units::FeetLength(test_stack.GetAltitude(0)).value(), std::numeric_limits<double>::infinity());
+   EXPECT_THROW(test_stack.GetSpeed(44), std::out_of_range);
+   EXPECT_THROW(test_stack.Insert(38, Units::ZERO_LENGTH, Units::ZERO_SPEED), std::out_of_range);
+
+   // growing past the inline capacity and shrinking back must keep the data addressable
+   WindStack copied_stack = test_stack;
+   copied_stack.SetBounds(1, 8);
+   copied_stack.Insert(8, Units::FeetLength(7000), Units::KnotsSpeed(8));
+   copied_stack.SetBounds(39, 43);
+   EXPECT_EQ(Units::KnotsSpeed(copied_stack.GetSpeed(41)).value(), std::numeric_limits<double>::infinity());
+   copied_stack = test_stack;
+   EXPECT_EQ(copied_stack, test_stack);
+}
+
 }  // namespace open_source
 }  // namespace test
 }  // namespace aaesim
\ No newline at end of file